@@ -26,20 +26,26 @@
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * \author André M. P. de Mattos <andre.mattos@spacelab.ufsc.br>
  *
- * \version 0.2.17
+ * \version 0.3.15
  *
- * \date 2021/03/31
+ * \date 2026/10/17
  *
  * \addgroup epd_data
  * \{
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
 #include <FreeRTOS.h>
 #include <task.h>
 #include <system/sys_log/sys_log.h>
 #include <system/system.h>
 
 #include "eps2_data.h"
+#include "eps2_history.h"
+#include "eps2_stats.h"
 
 eps_data_t eps_data_buff = {
     // EPS data buffer initial/default values
@@ -67,511 +73,1319 @@ eps_data_t eps_data_buff = {
     .device_id = 0xEEE2
 };
 
-int eps_buffer_write(uint8_t id, uint32_t *value)
-{
-    taskENTER_CRITICAL();
-	switch(id)
-    {
-        case EPS2_PARAM_ID_TIMESTAMP:
-            eps_data_buff.timestamp = *value;
-            system_set_time(*value);
-            break;
-        case EPS2_PARAM_ID_MCU_TEMP:
-            eps_data_buff.eps_mcu_temp_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_EPS_CURRENT:
-            eps_data_buff.eps_beacon_ma = *value;
-            break;
-        case EPS2_PARAM_ID_LAST_RESET_CAUSE:
-            eps_data_buff.last_reset_cause = *value;
-            break;
-        case EPS2_PARAM_ID_RESET_COUNTER:
-            eps_data_buff.reset_counter = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
-            eps_data_buff.minus_y_plus_x_solar_panel_mv = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
-            eps_data_buff.minus_x_plus_z_solar_panel_mv = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
-            eps_data_buff.minus_z_plus_y_solar_panel_mv = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MY_CURRENT:
-            eps_data_buff.minus_y_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_SP_PY_CURRENT:
-            eps_data_buff.plus_y_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MX_CURRENT:
-            eps_data_buff.minus_x_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_SP_PX_CURRENT:
-            eps_data_buff.plus_x_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_CURRENT:
-            eps_data_buff.minus_z_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_SP_PZ_CURRENT:
-            eps_data_buff.plus_z_solar_panel_ma = *value;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE:
-            eps_data_buff.mppt_1_duty_cycle = *value;
-            break;
-        case EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE:
-            eps_data_buff.mppt_2_duty_cycle = *value;
-            break;
-        case EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE:
-            eps_data_buff.mppt_3_duty_cycle = *value;
-            break;
-        case EPS2_PARAM_ID_SP_VOLTAGE_MPPT:
-            eps_data_buff.total_solar_panels_mv = *value;
-            break;
-        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
-            eps_data_buff.main_power_buss_mv = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_0_TEMP:
-            eps_data_buff.batteries_rtd0_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_1_TEMP:
-            eps_data_buff.batteries_rtd1_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_2_TEMP:
-            eps_data_buff.batteries_rtd2_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_3_TEMP:
-            eps_data_buff.batteries_rtd3_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_4_TEMP:
-            eps_data_buff.solar_panels_rtd4_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_5_TEMP:
-            eps_data_buff.solar_panels_rtd5_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_RTD_6_TEMP:
-            eps_data_buff.solar_panels_rtd6_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_VOLTAGE:
-            eps_data_buff.batteries_mv = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_CURRENT:
-            eps_data_buff.batteries_ma = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
-            eps_data_buff.batteries_average_ma = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
-            eps_data_buff.batteries_accumulated_ma = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_CHARGE:
-            eps_data_buff.batteries_charge_mah = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
-            eps_data_buff.bm_temp_kelvin = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
-            eps_data_buff.bm_status_reg = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
-            eps_data_buff.bm_protection_reg = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
-            eps_data_buff.bm_cycle_counter_reg = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
-            eps_data_buff.bm_raac_mah = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
-            eps_data_buff.bm_rsac_mah = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
-            eps_data_buff.bm_rarc_percent = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
-            eps_data_buff.bm_rsrc_percent = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE:
-            eps_data_buff.heater1_duty_cycle = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE:
-            eps_data_buff.heater2_duty_cycle = *value;
-            break;
-        case EPS2_PARAM_ID_HW_VERSION:
-            eps_data_buff.hardware_version = *value;
-            break;
-        case EPS2_PARAM_ID_FW_VERSION:
-            eps_data_buff.firmware_version = *value;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_MODE:
-            eps_data_buff.mppt_1_mode = *value;
-            if (eps_data_buff.mppt_1_mode == 1) // MPPT is set to manual mode
-            {
-                eps_data_buff.mppt_1_duty_cycle = 40;
-            }
-            break;
-        case EPS2_PARAM_ID_MPPT_2_MODE:
-            eps_data_buff.mppt_2_mode = *value;
-            if (eps_data_buff.mppt_2_mode == 1) // MPPT is set to manual mode
-            {
-                eps_data_buff.mppt_2_duty_cycle = 40;
-            }
-            break;
-        case EPS2_PARAM_ID_MPPT_3_MODE:
-            eps_data_buff.mppt_3_mode = *value;
-            if (eps_data_buff.mppt_3_mode == 1) // MPPT is set to manual mode
-            {
-                eps_data_buff.mppt_3_duty_cycle = 40;
-            }
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:
-            eps_data_buff.heater1_mode = *value;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:
-            eps_data_buff.heater2_mode = *value;
-            break;
-        case EPS2_PARAM_ID_DEVICE_ID:
-            eps_data_buff.device_id = *value;
-            break;
-        case EPS2_PARAM_ID_BEACON_ENABLE:
-            eps_data_buff.beacon_enable = *value;
-            break;
-        default:
-            sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Unknown parameter ID!");
-            sys_log_new_line();
-            return -1;
-    }
-    taskEXIT_CRITICAL();
+/**
+ * \brief Builds a parameter descriptor from an eps_data_t field.
+ */
+#define EPS_PARAM(field, access, hook)      { offsetof(eps_data_t, field), sizeof(((eps_data_t*)0)->field), (access), (hook) }
 
-    return 0;
-}
+/**
+ * \brief Descriptor of an ID without storage in the data buffer (command parameters).
+ */
+#define EPS_PARAM_NONE                      { 0, 0, 0, NULL }
 
-int eps_buffer_read(uint8_t id, uint32_t *value)
-{
-    taskENTER_CRITICAL();
+/**
+ * \brief Descriptor of a derived parameter (read-only, computed by eps_buffer_derive()).
+ */
+#define EPS_PARAM_DERIVED_R(signedness)     { 0, sizeof(uint32_t), (EPS_PARAM_ACCESS_R | EPS_PARAM_DERIVED | (signedness)), NULL }
 
-    #if CONFIG_SET_DUMMY_EPS == 1
-    switch(id)
-    {
-        case EPS2_PARAM_ID_TIMESTAMP:
-            *value = 0;
-            break;
-        case EPS2_PARAM_ID_MCU_TEMP:
-            *value = 1;
-            break;
-        case EPS2_PARAM_ID_EPS_CURRENT:
-            *value = 2;
-            break;
-        case EPS2_PARAM_ID_LAST_RESET_CAUSE:
-            *value = 3;
-            break;
-        case EPS2_PARAM_ID_RESET_COUNTER:
-            *value = 4;
-            break;
-        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
-            *value = 5;
-            break;
-        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
-            *value = 6;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
-            *value = 7;
-            break;
-        case EPS2_PARAM_ID_SP_MY_CURRENT:
-            *value = 8;
-            break;
-        case EPS2_PARAM_ID_SP_PY_CURRENT:
-            *value = 9;
-            break;
-        case EPS2_PARAM_ID_SP_MX_CURRENT:
-            *value = 10;
-            break;
-        case EPS2_PARAM_ID_SP_PX_CURRENT:
-            *value = 11;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_CURRENT:
-            *value = 12;
-            break;
-        case EPS2_PARAM_ID_SP_PZ_CURRENT:
-            *value = 13;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE:
-            *value = 14;
-            break;
-        case EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE:
-            *value = 15;
-            break;
-        case EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE:
-            *value = 16;
-            break;
-        case EPS2_PARAM_ID_SP_VOLTAGE_MPPT:
-            *value = 17;
-            break;
-        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
-            *value = 18;
-            break;
-        case EPS2_PARAM_ID_RTD_0_TEMP:
-            *value = 19;
-            break;
-        case EPS2_PARAM_ID_RTD_1_TEMP:
-            *value = 20;
-            break;
-        case EPS2_PARAM_ID_RTD_2_TEMP:
-            *value = 21;
-            break;
-        case EPS2_PARAM_ID_RTD_3_TEMP:
-            *value = 22;
-            break;
-        case EPS2_PARAM_ID_RTD_4_TEMP:
-            *value = 23;
-            break;
-        case EPS2_PARAM_ID_RTD_5_TEMP:
-            *value = 24;
-            break;
-        case EPS2_PARAM_ID_RTD_6_TEMP:
-            *value = 25;
-            break;
-        case EPS2_PARAM_ID_BAT_VOLTAGE:
-            *value = 26;
-            break;
-        case EPS2_PARAM_ID_BAT_CURRENT:
-            *value = 27;
-            break;
-        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
-            *value = 28;
-            break;
-        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
-            *value = 29;
-            break;
-        case EPS2_PARAM_ID_BAT_CHARGE:
-            *value = 30;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
-            *value = 31;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
-            *value = 32;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
-            *value = 33;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
-            *value = 34;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
-            *value = 35;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
-            *value = 36;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
-            *value = 37;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
-            *value = 38;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE:
-            *value = 39;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE:
-            *value = 40;
-            break;
-        case EPS2_PARAM_ID_HW_VERSION:
-            *value = 41;
-            break;
-        case EPS2_PARAM_ID_FW_VERSION:
-            *value = 42;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_MODE:
-            *value = 43;
-            break;
-        case EPS2_PARAM_ID_MPPT_2_MODE:
-            *value = 44;
-            break;
-        case EPS2_PARAM_ID_MPPT_3_MODE:
-            *value = 45;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:
-            *value = 0;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:
-            *value = 0;
-            break;
-        case EPS2_PARAM_ID_DEVICE_ID:
-            *value = 0xEEE2U;
-            break;
-        case EPS2_PARAM_ID_BEACON_ENABLE:
-            *value = 1;
-            break;
-        default:
-            sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Unknown parameter ID!");
-            sys_log_new_line();
-            return -1;
-    }
+/**
+ * \brief Descriptor of a command (written parameter without storage, handled by its write hook).
+ */
+#define EPS_PARAM_CMD(hook)                 { 0, 0, EPS_PARAM_ACCESS_W, (hook) }
 
-    return 0;
-    #endif
+/**
+ * \brief Descriptor of a field of the latched statistics (read-only, returned by eps_stats_read()).
+ */
+#define EPS_PARAM_STATS_R(signedness)       { 0, sizeof(uint32_t), (EPS_PARAM_ACCESS_R | EPS_PARAM_STATS | (signedness)), NULL }
 
-	switch(id)
-    {
-        case EPS2_PARAM_ID_TIMESTAMP:
-        	*value = eps_data_buff.timestamp;
-            break;
-        case EPS2_PARAM_ID_MCU_TEMP:
-            *value = eps_data_buff.eps_mcu_temp_kelvin;
-            break;
-        case EPS2_PARAM_ID_EPS_CURRENT:
-            *value = eps_data_buff.eps_beacon_ma;
-            break;
-        case EPS2_PARAM_ID_LAST_RESET_CAUSE:
-            *value = eps_data_buff.last_reset_cause;
-            break;
-        case EPS2_PARAM_ID_RESET_COUNTER:
-            *value = eps_data_buff.reset_counter;
-            break;
-        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
-            *value = eps_data_buff.minus_y_plus_x_solar_panel_mv;
-            break;
-        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
-            *value = eps_data_buff.minus_x_plus_z_solar_panel_mv;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
-            *value = eps_data_buff.minus_z_plus_y_solar_panel_mv;
-            break;
-        case EPS2_PARAM_ID_SP_MY_CURRENT:
-            *value = eps_data_buff.minus_y_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_SP_PY_CURRENT:
-            *value = eps_data_buff.plus_y_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_SP_MX_CURRENT:
-            *value = eps_data_buff.minus_x_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_SP_PX_CURRENT:
-            *value = eps_data_buff.plus_x_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_SP_MZ_CURRENT:
-            *value = eps_data_buff.minus_z_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_SP_PZ_CURRENT:
-            *value = eps_data_buff.plus_z_solar_panel_ma;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE:
-            *value = eps_data_buff.mppt_1_duty_cycle;
-            break;
-        case EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE:
-            *value = eps_data_buff.mppt_2_duty_cycle;
-            break;
-        case EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE:
-            *value = eps_data_buff.mppt_3_duty_cycle;
-            break;
-        case EPS2_PARAM_ID_SP_VOLTAGE_MPPT:
-            *value = eps_data_buff.total_solar_panels_mv;
-            break;
-        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
-            *value = eps_data_buff.main_power_buss_mv;
-            break;
-        case EPS2_PARAM_ID_RTD_0_TEMP:
-            *value = eps_data_buff.batteries_rtd0_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_1_TEMP:
-            *value = eps_data_buff.batteries_rtd1_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_2_TEMP:
-            *value = eps_data_buff.batteries_rtd2_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_3_TEMP:
-            *value = eps_data_buff.batteries_rtd3_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_4_TEMP:
-            *value = eps_data_buff.solar_panels_rtd4_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_5_TEMP:
-            *value = eps_data_buff.solar_panels_rtd5_kelvin;
-            break;
-        case EPS2_PARAM_ID_RTD_6_TEMP:
-            *value = eps_data_buff.solar_panels_rtd6_kelvin;
-            break;
-        case EPS2_PARAM_ID_BAT_VOLTAGE:
-            *value = eps_data_buff.batteries_mv;
-            break;
-        case EPS2_PARAM_ID_BAT_CURRENT:
-            *value = eps_data_buff.batteries_ma;
-            break;
-        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
-            *value = eps_data_buff.batteries_average_ma;
-            break;
-        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
-            *value = eps_data_buff.batteries_accumulated_ma;
-            break;
-        case EPS2_PARAM_ID_BAT_CHARGE:
-            /* DEPRECATED PARAMETER! Returns the accumulated current value. */
-            *value = eps_data_buff.batteries_accumulated_ma;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
-            *value = eps_data_buff.bm_temp_kelvin;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
-            *value = eps_data_buff.bm_status_reg;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
-            *value = eps_data_buff.bm_protection_reg;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
-            *value = eps_data_buff.bm_cycle_counter_reg;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
-            *value = eps_data_buff.bm_raac_mah;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
-            *value = eps_data_buff.bm_rsac_mah;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
-            *value = eps_data_buff.bm_rarc_percent;
-            break;
-        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
-            *value = eps_data_buff.bm_rsrc_percent;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE:
-            *value = eps_data_buff.heater1_duty_cycle;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE:
-            *value = eps_data_buff.heater2_duty_cycle;
-            break;
-        case EPS2_PARAM_ID_HW_VERSION:
-            *value = eps_data_buff.hardware_version;
-            break;
-        case EPS2_PARAM_ID_FW_VERSION:
-            *value = eps_data_buff.firmware_version;
-            break;
-        case EPS2_PARAM_ID_MPPT_1_MODE:
-            *value = eps_data_buff.mppt_1_mode;
-            break;
-        case EPS2_PARAM_ID_MPPT_2_MODE:
-            *value = eps_data_buff.mppt_2_mode;
-            break;
-        case EPS2_PARAM_ID_MPPT_3_MODE:
-            *value = eps_data_buff.mppt_3_mode;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:
-            *value = eps_data_buff.heater1_mode;
-            break;
-        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:
-            *value = eps_data_buff.heater2_mode;
-            break;
-        case EPS2_PARAM_ID_DEVICE_ID:
-            *value = eps_data_buff.device_id;
-            break;
-        case EPS2_PARAM_ID_BEACON_ENABLE:
-            *value = eps_data_buff.beacon_enable;
-            break;
-        default:
-            sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Unknown parameter ID!");
-            sys_log_new_line();
-			return -1;
-    }
-    taskEXIT_CRITICAL();
+/**
+ * \brief Descriptor of a field of the latched history sample (read-only, returned by eps_history_read()).
+ */
+#define EPS_PARAM_HISTORY_R(signedness)     { 0, sizeof(uint32_t), (EPS_PARAM_ACCESS_R | EPS_PARAM_HISTORY | (signedness)), NULL }
 
-    return 0;
+/**
+ * \brief Bit of a derived parameter in the cache validity mask.
+ */
+#define EPS_DATA_DERIVED_BIT(id)            ((uint8_t)(1U << ((id) - EPS2_PARAM_ID_FIRST_DERIVED)))
+
+/**
+ * \brief Compile-time check (C11 _Static_assert, or a negative array size on older dialects).
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define EPS_DATA_STATIC_ASSERT(cond, msg)   _Static_assert(cond, msg)
+#else
+#define EPS_DATA_STATIC_ASSERT_CAT(a, b)    a##b
+#define EPS_DATA_STATIC_ASSERT_LINE(a, b)   EPS_DATA_STATIC_ASSERT_CAT(a, b)
+#define EPS_DATA_STATIC_ASSERT(cond, msg)   typedef char EPS_DATA_STATIC_ASSERT_LINE(eps_data_static_assert_, __LINE__)[(cond) ? 1 : -1]
+#endif
+
+EPS_DATA_STATIC_ASSERT(EPS_DATA_BLOCK_SIZE(firmware_version, timestamp) == EPS_DATA_MISC_BYTES, "EPS data misc block is over its budget!");
+EPS_DATA_STATIC_ASSERT(EPS_DATA_BLOCK_SIZE(timestamp, bm_status_reg) == EPS_DATA_MCU_BYTES, "EPS data MCU block is over its budget!");
+EPS_DATA_STATIC_ASSERT(EPS_DATA_BLOCK_SIZE(bm_status_reg, minus_y_plus_x_solar_panel_mv) == EPS_DATA_BM_BYTES, "EPS data battery monitor block is over its budget!");
+EPS_DATA_STATIC_ASSERT(EPS_DATA_BLOCK_SIZE(minus_y_plus_x_solar_panel_mv, batteries_mv) == EPS_DATA_SOLAR_BYTES, "EPS data solar panels block is over its budget!");
+EPS_DATA_STATIC_ASSERT((sizeof(eps_data_t) - offsetof(eps_data_t, batteries_mv)) == EPS_DATA_BAT_BYTES, "EPS data batteries block is over its budget!");
+EPS_DATA_STATIC_ASSERT(sizeof(eps_data_t) == EPS_DATA_BYTES, "EPS data has padding or is over its budget!");
+EPS_DATA_STATIC_ASSERT(EPS_DATA_DERIVED_QTY <= 8U, "The derived parameters validity mask is 8 bits wide!");
+EPS_DATA_STATIC_ASSERT((EPS2_PARAM_ID_STATS_STDDEV - EPS2_PARAM_ID_STATS_PARAM_ID) == EPS_STATS_FIELD_STDDEV, "The statistics IDs must follow the order of eps_stats_field_e!");
+EPS_DATA_STATIC_ASSERT((EPS2_PARAM_ID_HISTORY_AVG - EPS2_PARAM_ID_HISTORY_TIME) == EPS_HISTORY_FIELD_AVG, "The history IDs must follow the order of eps_history_field_e!");
+
+/**
+ * \brief Write hook of the timestamp parameter (keeps the system time in sync).
+ *
+ * \param[in] id is the written parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \return None.
+ */
+static void eps_buffer_on_timestamp_write(uint8_t id, uint32_t value);
+
+/**
+ * \brief Write hook of the accumulated current (also returned as the deprecated battery charge).
+ *
+ * \param[in] id is the written parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \return None.
+ */
+static void eps_buffer_on_bat_acc_current_write(uint8_t id, uint32_t value);
+
+/**
+ * \brief Write hook of the statistics selection command (latches the statistics of the given parameter).
+ *
+ * \param[in] id is the written parameter ID.
+ *
+ * \param[in] value is the ID of the parameter to latch.
+ *
+ * \return None.
+ */
+static void eps_buffer_on_stats_select_write(uint8_t id, uint32_t value);
+
+/**
+ * \brief Parameters descriptors table, indexed by the parameter ID.
+ */
+static const eps_param_desc_t eps_param_table[EPS2_PARAM_ID_QTY] = {
+    [EPS2_PARAM_ID_TIMESTAMP]                 = EPS_PARAM(timestamp, EPS_PARAM_ACCESS_RW, eps_buffer_on_timestamp_write),
+    [EPS2_PARAM_ID_MCU_TEMP]                  = EPS_PARAM(eps_mcu_temp_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_EPS_CURRENT]               = EPS_PARAM(eps_beacon_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_LAST_RESET_CAUSE]          = EPS_PARAM(last_reset_cause, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RESET_COUNTER]             = EPS_PARAM(reset_counter, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MY_PX_VOLTAGE]          = EPS_PARAM(minus_y_plus_x_solar_panel_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE]          = EPS_PARAM(minus_x_plus_z_solar_panel_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE]          = EPS_PARAM(minus_z_plus_y_solar_panel_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MY_CURRENT]             = EPS_PARAM(minus_y_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_PY_CURRENT]             = EPS_PARAM(plus_y_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MX_CURRENT]             = EPS_PARAM(minus_x_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_PX_CURRENT]             = EPS_PARAM(plus_x_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_MZ_CURRENT]             = EPS_PARAM(minus_z_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_PZ_CURRENT]             = EPS_PARAM(plus_z_solar_panel_ma, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE]         = EPS_PARAM(mppt_1_duty_cycle, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE]         = EPS_PARAM(mppt_2_duty_cycle, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE]         = EPS_PARAM(mppt_3_duty_cycle, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_VOLTAGE_MPPT]           = EPS_PARAM(total_solar_panels_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE]    = EPS_PARAM(main_power_buss_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_0_TEMP]                = EPS_PARAM(batteries_rtd0_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_1_TEMP]                = EPS_PARAM(batteries_rtd1_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_2_TEMP]                = EPS_PARAM(batteries_rtd2_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_3_TEMP]                = EPS_PARAM(batteries_rtd3_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_4_TEMP]                = EPS_PARAM(solar_panels_rtd4_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_5_TEMP]                = EPS_PARAM(solar_panels_rtd5_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RTD_6_TEMP]                = EPS_PARAM(solar_panels_rtd6_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_VOLTAGE]               = EPS_PARAM(batteries_mv, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_CURRENT]               = EPS_PARAM(batteries_ma, EPS_PARAM_ACCESS_RW | EPS_PARAM_STORAGE_SIGNED, NULL),
+    [EPS2_PARAM_ID_BAT_AVERAGE_CURRENT]       = EPS_PARAM(batteries_average_ma, EPS_PARAM_ACCESS_RW | EPS_PARAM_STORAGE_SIGNED, NULL),
+    [EPS2_PARAM_ID_BAT_ACC_CURRENT]           = EPS_PARAM(batteries_accumulated_ma, EPS_PARAM_ACCESS_RW, eps_buffer_on_bat_acc_current_write),
+    [EPS2_PARAM_ID_BAT_CHARGE]                = EPS_PARAM(batteries_accumulated_ma, EPS_PARAM_ACCESS_R, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_TEMP]          = EPS_PARAM(bm_temp_kelvin, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_STATUS]        = EPS_PARAM(bm_status_reg, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_PROTECT]       = EPS_PARAM(bm_protection_reg, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER] = EPS_PARAM(bm_cycle_counter_reg, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_RAAC]          = EPS_PARAM(bm_raac_mah, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_RSAC]          = EPS_PARAM(bm_rsac_mah, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_RARC]          = EPS_PARAM(bm_rarc_percent, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_MONITOR_RSRC]          = EPS_PARAM(bm_rsrc_percent, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE]   = EPS_PARAM(heater1_duty_cycle, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE]   = EPS_PARAM(heater2_duty_cycle, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_HW_VERSION]                = EPS_PARAM(hardware_version, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_FW_VERSION]                = EPS_PARAM(firmware_version, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_1_MODE]               = EPS_PARAM(mppt_1_mode, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_2_MODE]               = EPS_PARAM(mppt_2_mode, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_MPPT_3_MODE]               = EPS_PARAM(mppt_3_mode, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_HEATER_1_MODE]         = EPS_PARAM(heater1_mode, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_BAT_HEATER_2_MODE]         = EPS_PARAM(heater2_mode, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_DEVICE_ID]                 = EPS_PARAM(device_id, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_RESET_EPS]                 = EPS_PARAM_NONE,
+    [EPS2_PARAM_ID_PAYLOAD_ENABLE]            = EPS_PARAM_NONE,
+    [EPS2_PARAM_ID_BEACON_ENABLE]             = EPS_PARAM(beacon_enable, EPS_PARAM_ACCESS_RW, NULL),
+    [EPS2_PARAM_ID_SP_INPUT_POWER]            = EPS_PARAM_DERIVED_R(0),
+    [EPS2_PARAM_ID_MPPT_1_POWER]              = EPS_PARAM_DERIVED_R(0),
+    [EPS2_PARAM_ID_MPPT_2_POWER]              = EPS_PARAM_DERIVED_R(0),
+    [EPS2_PARAM_ID_MPPT_3_POWER]              = EPS_PARAM_DERIVED_R(0),
+    [EPS2_PARAM_ID_MAIN_POWER_BUS_POWER]      = EPS_PARAM_DERIVED_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_MPPT_EFFICIENCY]           = EPS_PARAM_DERIVED_R(0),
+    [EPS2_PARAM_ID_STATS_SELECT]              = EPS_PARAM_CMD(eps_buffer_on_stats_select_write),
+    [EPS2_PARAM_ID_STATS_PARAM_ID]            = EPS_PARAM_STATS_R(0),
+    [EPS2_PARAM_ID_STATS_COUNT]               = EPS_PARAM_STATS_R(0),
+    [EPS2_PARAM_ID_STATS_MIN]                 = EPS_PARAM_STATS_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_STATS_MAX]                 = EPS_PARAM_STATS_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_STATS_MEAN]                = EPS_PARAM_STATS_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_STATS_STDDEV]              = EPS_PARAM_STATS_R(0),
+    [EPS2_PARAM_ID_CAL_GAIN]                  = EPS_PARAM_NONE,
+    [EPS2_PARAM_ID_CAL_OFFSET]                = EPS_PARAM_NONE,
+    [EPS2_PARAM_ID_CAL_SAVE]                  = EPS_PARAM_NONE,
+    [EPS2_PARAM_ID_HISTORY_SELECT]            = EPS_PARAM_CMD(NULL),
+    [EPS2_PARAM_ID_HISTORY_NEXT]              = EPS_PARAM_CMD(NULL),
+    [EPS2_PARAM_ID_HISTORY_TIME]              = EPS_PARAM_HISTORY_R(0),
+    [EPS2_PARAM_ID_HISTORY_MIN]               = EPS_PARAM_HISTORY_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_HISTORY_MAX]               = EPS_PARAM_HISTORY_R(EPS_PARAM_SIGNED),
+    [EPS2_PARAM_ID_HISTORY_AVG]               = EPS_PARAM_HISTORY_R(EPS_PARAM_SIGNED),
+};
+
+/**
+ * \brief Data buffer sequence counter (odd while a write is in progress).
+ */
+static volatile uint16_t eps_data_seq = 0;
+
+/**
+ * \brief Change subscriptions (tasks notified when one of their watched parameters is written).
+ */
+static eps_data_subscriber_t eps_data_subscribers[EPS_DATA_MAX_SUBSCRIBERS];
+
+/**
+ * \brief Union of the watched parameters of all subscribers (fast path of the writes).
+ */
+static uint8_t eps_data_watched_mask[(EPS2_PARAM_ID_QTY + 7U) / 8U];
+
+/**
+ * \brief Bitmap of the parameters written at least once since the initialization.
+ */
+static volatile uint8_t eps_data_written_mask[(EPS2_PARAM_ID_QTY + 7U) / 8U];
+
+/**
+ * \brief Parameter refreshed on demand.
+ */
+typedef struct
+{
+    eps_param_acquire_t acquire;                /**< Acquisition callback. */
+    TickType_t max_age;                         /**< Maximum age of the value in ticks. */
+    TickType_t last_update;                     /**< Tick of the last write. */
+    uint8_t id;                                 /**< Parameter ID. */
+    bool written;                               /**< The parameter was written at least once. */
+} eps_data_acquirer_t;
+
+/**
+ * \brief Parameters refreshed on demand (registered with eps_buffer_set_acquire()).
+ */
+static eps_data_acquirer_t eps_data_acquirers[EPS_DATA_MAX_ACQUIRERS];
+
+/**
+ * \brief Number of registered parameters refreshed on demand.
+ */
+static uint8_t eps_data_acquirers_qty = 0;
+
+/**
+ * \brief Bitmap of the parameters refreshed on demand (fast path of the reads and writes).
+ */
+static uint8_t eps_data_lazy_mask[(EPS2_PARAM_ID_QTY + 7U) / 8U];
+
+/**
+ * \brief Cached values of the derived parameters (indexed by ID - EPS2_PARAM_ID_FIRST_DERIVED).
+ */
+static uint32_t eps_data_derived_cache[EPS_DATA_DERIVED_QTY];
+
+/**
+ * \brief Derived parameters with a valid cached value (cleared when a source is written).
+ */
+static volatile uint8_t eps_data_derived_valid = 0;
+
+/**
+ * \brief Beacon parameters IDs, in the order of the beacon packet.
+ */
+static const uint8_t eps_data_beacon_ids[] = {BEACON_PARAM_ID_LIST};
+
+EPS_DATA_STATIC_ASSERT(sizeof(eps_data_beacon_ids) == BEACON_PARAM_ID_QTY, "BEACON_PARAM_ID_QTY does not match BEACON_PARAM_ID_LIST!");
+
+/**
+ * \brief Position + 1 of each parameter in the beacon wire image (0 if it is not in the beacon).
+ */
+static uint8_t eps_data_beacon_slot[EPS2_PARAM_ID_QTY];
+
+/**
+ * \brief Beacon parameters in the wire format (big-endian, 4 bytes per parameter).
+ */
+static uint8_t eps_data_beacon_wire[EPS_DATA_BEACON_BYTES];
+
+/**
+ * \brief Notifies the subscribers watching any of the written parameters.
+ *
+ * The task that made the write is not notified about its own changes.
+ *
+ * \note Must be called outside the critical section.
+ *
+ * \param[in] ids is the list of written parameters IDs.
+ *
+ * \param[in] n is the number of parameters in the list.
+ *
+ * \return None.
+ */
+static void eps_buffer_notify(const uint8_t *ids, uint8_t n);
+
+/**
+ * \brief Stores a parameter in the data buffer and runs its write hook.
+ *
+ * \note Must be called between two increments of the sequence counter.
+ *
+ * \param[in] id is a valid and writable parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \return None.
+ */
+static void eps_buffer_store(uint8_t id, uint32_t value);
+
+/**
+ * \brief Stores a parameter in the data buffer without running its write hook.
+ *
+ * \note Must be called between two increments of the sequence counter.
+ *
+ * \param[in] id is a valid and writable parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \return None.
+ */
+static void eps_buffer_store_field(uint8_t id, uint32_t value);
+
+/**
+ * \brief Gets the write chained to a parameter write.
+ *
+ * The chained write is published after the original one, through eps_buffer_write(), so it
+ * gets its own version, history, statistics and notifications. Setting an MPPT to manual mode
+ * resets its duty cycle to EPS_DATA_MPPT_MANUAL_DUTY.
+ *
+ * \param[in] id is the written parameter ID.
+ *
+ * \param[in] value is the written value.
+ *
+ * \param[out] chained_value is the value of the chained write.
+ *
+ * \return The parameter ID of the chained write, or EPS2_PARAM_ID_QTY if there is none.
+ */
+static uint8_t eps_buffer_chained_write(uint8_t id, uint32_t value, uint32_t *chained_value);
+
+/**
+ * \brief Runs the part of a command write that is too long for the critical section.
+ *
+ * The history commands walk the history rings to find the sample to latch, so they run
+ * after the write is published, and only the found sample is latched in a critical section.
+ *
+ * \note Must be called outside the critical section.
+ *
+ * \param[in] id is the written parameter ID (ignored if it is not such a command).
+ *
+ * \param[in] value is the written value.
+ *
+ * \return None.
+ */
+static void eps_buffer_run_command(uint8_t id, uint32_t value);
+
+/**
+ * \brief Gets the on demand refresh entry of a parameter.
+ *
+ * \param[in] id is a parameter ID with the bit set in eps_data_lazy_mask.
+ *
+ * \return The entry of the parameter or NULL if it is not registered.
+ */
+static eps_data_acquirer_t *eps_buffer_get_acquirer(uint8_t id);
+
+/**
+ * \brief Refreshes a parameter if it is refreshed on demand and its value is too old.
+ *
+ * \note Must be called outside the critical section.
+ *
+ * \param[in] id is a valid and readable parameter ID.
+ *
+ * \return None.
+ */
+#if CONFIG_SET_DUMMY_EPS == 0
+static void eps_buffer_refresh(uint8_t id);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+/**
+ * \brief Caches the value of a derived parameter.
+ *
+ * The value is discarded if the data buffer changed since it was computed.
+ *
+ * \note Must be called outside the critical section.
+ *
+ * \param[in] id is a valid parameter ID (ignored if it is not a derived parameter).
+ *
+ * \param[in] value is the computed value.
+ *
+ * \param[in] seq is the sequence counter of the version the value was computed from.
+ *
+ * \return None.
+ */
+#if CONFIG_SET_DUMMY_EPS == 0
+static void eps_buffer_derived_cache(uint8_t id, uint32_t value, uint16_t seq);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+/**
+ * \brief Gets the derived parameters computed from a parameter.
+ *
+ * \param[in] id is a valid parameter ID.
+ *
+ * \return The bitmask of the dependent derived parameters (EPS_DATA_DERIVED_BIT).
+ */
+static uint8_t eps_buffer_derived_deps(uint8_t id);
+
+/**
+ * \brief Computes a derived parameter.
+ *
+ * \param[in] data is the data buffer with the source parameters.
+ *
+ * \param[in] id is a derived parameter ID.
+ *
+ * \return The value of the derived parameter.
+ */
+static uint32_t eps_buffer_derive(const eps_data_t *data, uint8_t id);
+
+/**
+ * \brief Computes the input power of a MPPT channel (voltage times the sum of the two panels currents).
+ *
+ * \param[in] data is the data buffer with the source parameters.
+ *
+ * \param[in] v_id is the channel voltage parameter ID (mV).
+ *
+ * \param[in] i0_id is the first panel current parameter ID (mA).
+ *
+ * \param[in] i1_id is the second panel current parameter ID (mA).
+ *
+ * \return The input power in mW.
+ */
+static uint32_t eps_buffer_mppt_power(const eps_data_t *data, uint8_t v_id, uint8_t i0_id, uint8_t i1_id);
+
+/**
+ * \brief Updates the wire image of a parameter, if it is a beacon parameter.
+ *
+ * \note Must be called between two increments of the sequence counter.
+ *
+ * \param[in] id is a valid parameter ID.
+ *
+ * \return None.
+ */
+static void eps_buffer_wire_update(uint8_t id);
+
+/**
+ * \brief Loads a parameter from a data buffer.
+ *
+ * \param[in] data is the data buffer to read from.
+ *
+ * \param[in] id is a valid and readable parameter ID.
+ *
+ * \return The parameter value, sign-extended if the parameter is signed.
+ */
+static uint32_t eps_buffer_load(const eps_data_t *data, uint8_t id);
+
+/**
+ * \brief Loads a parameter from a data buffer as a signed integer.
+ *
+ * The fields of the signed parameters (see eps_buffer_is_signed()) are sign-extended
+ * from their width, the other ones are returned as is.
+ *
+ * \param[in] data is the data buffer to read from.
+ *
+ * \param[in] id is a valid and readable parameter ID.
+ *
+ * \return The parameter value.
+ */
+static int32_t eps_buffer_load_int(const eps_data_t *data, uint8_t id);
+
+/**
+ * \brief Logs a rejected access to the data buffer.
+ *
+ * \param[in] id is the rejected parameter ID.
+ *
+ * \return None.
+ */
+static void eps_buffer_log_invalid_access(uint8_t id);
+
+#if CONFIG_SET_DUMMY_EPS == 1
+/**
+ * \brief Dummy value of a parameter (the parameter ID itself, except for a few IDs).
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return The dummy value of the given parameter.
+ */
+static uint32_t eps_buffer_dummy_value(uint8_t id);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+int eps_buffer_init(void)
+{
+    uint8_t i = 0;
+
+    taskENTER_CRITICAL();
+
+    eps_data_seq++;     /* Odd: update in progress */
+
+    for(i = 0; i < BEACON_PARAM_ID_QTY; i++)
+    {
+        uint8_t id = eps_data_beacon_ids[i];
+
+        /* Parameters without storage are sent as zero */
+        if (eps_param_table[id].size > 0U)
+        {
+            eps_data_beacon_slot[id] = i + 1U;
+
+            eps_buffer_wire_update(id);
+        }
+    }
+
+    eps_data_seq++;     /* Even: new version published */
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+int eps_buffer_write(uint8_t id, uint32_t *value)
+{
+    if ((id >= EPS2_PARAM_ID_QTY) || ((eps_param_table[id].access & EPS_PARAM_ACCESS_W) == 0U))
+    {
+        eps_buffer_log_invalid_access(id);
+
+        return -1;
+    }
+
+    taskENTER_CRITICAL();
+
+    eps_data_seq++;     /* Odd: update in progress */
+
+    eps_buffer_store(id, *value);
+
+    eps_data_seq++;     /* Even: new version published */
+
+    taskEXIT_CRITICAL();
+
+    eps_buffer_run_command(id, *value);
+
+#if CONFIG_HISTORY_ENABLED == 1
+    eps_history_push(id, *value, system_get_time());
+#endif /* CONFIG_HISTORY_ENABLED */
+
+#if CONFIG_STATS_ENABLED == 1
+    eps_stats_push(id, *value);
+#endif /* CONFIG_STATS_ENABLED */
+
+    eps_buffer_notify(&id, 1);
+
+    uint32_t chained_value = 0;
+    uint8_t chained_id = eps_buffer_chained_write(id, *value, &chained_value);
+
+    if (chained_id < EPS2_PARAM_ID_QTY)
+    {
+        eps_buffer_write(chained_id, &chained_value);
+    }
+
+    return 0;
+}
+
+int eps_buffer_read(uint8_t id, uint32_t *value)
+{
+    if ((id >= EPS2_PARAM_ID_QTY) || ((eps_param_table[id].access & EPS_PARAM_ACCESS_R) == 0U))
+    {
+        eps_buffer_log_invalid_access(id);
+
+        return -1;
+    }
+
+#if CONFIG_SET_DUMMY_EPS == 1
+    *value = eps_buffer_dummy_value(id);
+#else
+    eps_buffer_refresh(id);
+
+    uint16_t seq = 0;
+    uint8_t retries = 0;
+
+    do
+    {
+        if (retries++ >= EPS_DATA_SEQ_MAX_RETRIES)
+        {
+            /* The writers are too busy, fall back to the critical section */
+            taskENTER_CRITICAL();
+
+            seq = eps_data_seq;
+
+            *value = eps_buffer_load(&eps_data_buff, id);
+
+            taskEXIT_CRITICAL();
+
+            break;
+        }
+
+        seq = eps_data_seq;
+
+        *value = eps_buffer_load(&eps_data_buff, id);
+    } while((seq & 1U) || (seq != eps_data_seq));
+
+    eps_buffer_derived_cache(id, *value, seq);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    return 0;
+}
+
+int eps_buffer_write_many(const uint8_t *ids, uint8_t n, const uint32_t *values)
+{
+    uint8_t i = 0;
+
+    if ((ids == NULL) || (values == NULL))
+    {
+        return -1;
+    }
+
+    /* The IDs are checked before any change, so the list is written entirely or not at all */
+    for(i = 0; i < n; i++)
+    {
+        if ((ids[i] >= EPS2_PARAM_ID_QTY) || ((eps_param_table[ids[i]].access & EPS_PARAM_ACCESS_W) == 0U))
+        {
+            eps_buffer_log_invalid_access(ids[i]);
+
+            return -1;
+        }
+    }
+
+    taskENTER_CRITICAL();
+
+    eps_data_seq++;     /* Odd: update in progress */
+
+    for(i = 0; i < n; i++)
+    {
+        eps_buffer_store(ids[i], values[i]);
+    }
+
+    eps_data_seq++;     /* Even: new version published */
+
+    taskEXIT_CRITICAL();
+
+    for(i = 0; i < n; i++)
+    {
+        eps_buffer_run_command(ids[i], values[i]);
+    }
+
+#if CONFIG_HISTORY_ENABLED == 1
+    sys_time_t now = system_get_time();
+
+    for(i = 0; i < n; i++)
+    {
+        eps_history_push(ids[i], values[i], now);
+    }
+#endif /* CONFIG_HISTORY_ENABLED */
+
+#if CONFIG_STATS_ENABLED == 1
+    for(i = 0; i < n; i++)
+    {
+        eps_stats_push(ids[i], values[i]);
+    }
+#endif /* CONFIG_STATS_ENABLED */
+
+    eps_buffer_notify(ids, n);
+
+    for(i = 0; i < n; i++)
+    {
+        uint32_t chained_value = 0;
+        uint8_t chained_id = eps_buffer_chained_write(ids[i], values[i], &chained_value);
+
+        if (chained_id < EPS2_PARAM_ID_QTY)
+        {
+            eps_buffer_write(chained_id, &chained_value);
+        }
+    }
+
+    return 0;
+}
+
+int eps_buffer_read_many(const uint8_t *ids, uint8_t n, uint32_t *out)
+{
+    uint8_t i = 0;
+
+    if ((ids == NULL) || (out == NULL))
+    {
+        return -1;
+    }
+
+    for(i = 0; i < n; i++)
+    {
+        if ((ids[i] >= EPS2_PARAM_ID_QTY) || ((eps_param_table[ids[i]].access & EPS_PARAM_ACCESS_R) == 0U))
+        {
+            eps_buffer_log_invalid_access(ids[i]);
+
+            return -1;
+        }
+    }
+
+#if CONFIG_SET_DUMMY_EPS == 1
+    for(i = 0; i < n; i++)
+    {
+        out[i] = eps_buffer_dummy_value(ids[i]);
+    }
+#else
+    for(i = 0; i < n; i++)
+    {
+        eps_buffer_refresh(ids[i]);
+    }
+
+    uint16_t seq = 0;
+    uint8_t retries = 0;
+
+    do
+    {
+        if (retries++ >= EPS_DATA_SEQ_MAX_RETRIES)
+        {
+            /* The writers are too busy, fall back to the critical section */
+            taskENTER_CRITICAL();
+
+            seq = eps_data_seq;
+
+            for(i = 0; i < n; i++)
+            {
+                out[i] = eps_buffer_load(&eps_data_buff, ids[i]);
+            }
+
+            taskEXIT_CRITICAL();
+
+            break;
+        }
+
+        seq = eps_data_seq;
+
+        for(i = 0; i < n; i++)
+        {
+            out[i] = eps_buffer_load(&eps_data_buff, ids[i]);
+        }
+    } while((seq & 1U) || (seq != eps_data_seq));
+
+    for(i = 0; i < n; i++)
+    {
+        eps_buffer_derived_cache(ids[i], out[i], seq);
+    }
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    return 0;
+}
+
+int eps_buffer_set_acquire(uint8_t id, eps_param_acquire_t acquire, uint32_t max_age_ms)
+{
+    eps_data_acquirer_t *acq = NULL;
+
+    if (acquire == NULL)
+    {
+        return -1;
+    }
+
+    if ((id >= EPS2_PARAM_ID_QTY) || ((eps_param_table[id].access & EPS_PARAM_ACCESS_W) == 0U))
+    {
+        eps_buffer_log_invalid_access(id);
+
+        return -1;
+    }
+
+    taskENTER_CRITICAL();
+
+    if (eps_data_lazy_mask[id / 8U] & (1U << (id % 8U)))
+    {
+        acq = eps_buffer_get_acquirer(id);
+    }
+    else if (eps_data_acquirers_qty < EPS_DATA_MAX_ACQUIRERS)
+    {
+        acq = &eps_data_acquirers[eps_data_acquirers_qty++];
+    }
+    else
+    {
+        /* No free slot */
+    }
+
+    if (acq != NULL)
+    {
+        acq->id = id;
+        acq->acquire = acquire;
+        acq->max_age = pdMS_TO_TICKS(max_age_ms);
+        acq->written = false;
+
+        eps_data_lazy_mask[id / 8U] |= (uint8_t)(1U << (id % 8U));
+    }
+
+    taskEXIT_CRITICAL();
+
+    if (acq == NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "No free acquisition slot!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    return 0;
+}
+
+int eps_buffer_read_beacon(uint8_t *buf)
+{
+    if (buf == NULL)
+    {
+        return -1;
+    }
+
+#if CONFIG_SET_DUMMY_EPS == 1
+    uint8_t i = 0;
+
+    for(i = 0; i < BEACON_PARAM_ID_QTY; i++)
+    {
+        uint32_t val = eps_buffer_dummy_value(eps_data_beacon_ids[i]);
+
+        buf[(4U * i) + 0U] = (val >> 24) & 0xFF;
+        buf[(4U * i) + 1U] = (val >> 16) & 0xFF;
+        buf[(4U * i) + 2U] = (val >> 8)  & 0xFF;
+        buf[(4U * i) + 3U] = (val >> 0)  & 0xFF;
+    }
+#else
+    /* A single block copy, short enough to be done in the critical section */
+    taskENTER_CRITICAL();
+
+    memcpy(buf, eps_data_beacon_wire, EPS_DATA_BEACON_BYTES);
+
+    taskEXIT_CRITICAL();
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    return 0;
+}
+
+int eps_buffer_publish_time(void)
+{
+    taskENTER_CRITICAL();
+
+    eps_data_seq++;     /* Odd: update in progress */
+
+    /* The clock is read in the critical section, so a concurrent time set is never rolled back */
+    eps_buffer_store_field(EPS2_PARAM_ID_TIMESTAMP, system_get_time());
+
+    eps_data_seq++;     /* Even: new version published */
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+bool eps_buffer_is_written(uint8_t id)
+{
+    if (id >= EPS2_PARAM_ID_QTY)
+    {
+        return false;
+    }
+
+    return (eps_data_written_mask[id / 8U] & (1U << (id % 8U))) != 0U;
+}
+
+bool eps_buffer_is_signed(uint8_t id)
+{
+    if (id >= EPS2_PARAM_ID_QTY)
+    {
+        return false;
+    }
+
+    return (eps_param_table[id].access & (EPS_PARAM_SIGNED | EPS_PARAM_STORAGE_SIGNED)) != 0U;
+}
+
+int eps_buffer_subscribe(TaskHandle_t task, const uint8_t *ids, uint8_t n, uint32_t notify_bits)
+{
+    eps_data_subscriber_t *sub = NULL;
+    uint8_t i = 0;
+
+    if ((task == NULL) || (ids == NULL) || (notify_bits == 0U))
+    {
+        return -1;
+    }
+
+    for(i = 0; i < n; i++)
+    {
+        if (ids[i] >= EPS2_PARAM_ID_QTY)
+        {
+            eps_buffer_log_invalid_access(ids[i]);
+
+            return -1;
+        }
+    }
+
+    taskENTER_CRITICAL();
+
+    /* A task can extend its previous subscription or take a free slot */
+    for(i = 0; i < EPS_DATA_MAX_SUBSCRIBERS; i++)
+    {
+        if (eps_data_subscribers[i].task == task)
+        {
+            sub = &eps_data_subscribers[i];
+            break;
+        }
+
+        if ((sub == NULL) && (eps_data_subscribers[i].task == NULL))
+        {
+            sub = &eps_data_subscribers[i];
+        }
+    }
+
+    if (sub != NULL)
+    {
+        sub->task = task;
+        sub->notify_bits = notify_bits;
+
+        for(i = 0; i < n; i++)
+        {
+            sub->ids_mask[ids[i] / 8U] |= (uint8_t)(1U << (ids[i] % 8U));
+            eps_data_watched_mask[ids[i] / 8U] |= (uint8_t)(1U << (ids[i] % 8U));
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    if (sub == NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "No free subscription slot!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    return 0;
+}
+
+static void eps_buffer_notify(const uint8_t *ids, uint8_t n)
+{
+    TaskHandle_t self = NULL;
+    bool self_known = false;
+    uint8_t i = 0;
+    uint8_t j = 0;
+
+    /* Fast path: none of the written parameters is watched */
+    for(j = 0; j < n; j++)
+    {
+        if (eps_data_watched_mask[ids[j] / 8U] & (1U << (ids[j] % 8U)))
+        {
+            break;
+        }
+    }
+
+    if (j == n)
+    {
+        return;
+    }
+
+    for(i = 0; i < EPS_DATA_MAX_SUBSCRIBERS; i++)
+    {
+        const eps_data_subscriber_t *sub = &eps_data_subscribers[i];
+
+        if (sub->task == NULL)
+        {
+            continue;
+        }
+
+        for(j = 0; j < n; j++)
+        {
+            if (sub->ids_mask[ids[j] / 8U] & (1U << (ids[j] % 8U)))
+            {
+                /* The writer is only looked up when there is someone to notify */
+                if (!self_known)
+                {
+                    self = xTaskGetCurrentTaskHandle();
+                    self_known = true;
+                }
+
+                if (sub->task != self)
+                {
+                    xTaskNotify(sub->task, sub->notify_bits, eSetBits);
+                }
+
+                break;
+            }
+        }
+    }
+}
+
+static void eps_buffer_store(uint8_t id, uint32_t value)
+{
+    eps_buffer_store_field(id, value);
+
+    if (eps_param_table[id].on_write != NULL)
+    {
+        eps_param_table[id].on_write(id, value);
+    }
+}
+
+static void eps_buffer_store_field(uint8_t id, uint32_t value)
+{
+    const eps_param_desc_t *desc = &eps_param_table[id];
+    volatile uint8_t *field = (volatile uint8_t*)&eps_data_buff + desc->offset;
+
+    switch(desc->size)
+    {
+        case 0U:                /* Command, no storage */                       break;
+        case sizeof(uint8_t):   *field = (uint8_t)value;                        break;
+        case sizeof(uint16_t):  *(volatile uint16_t*)field = (uint16_t)value;   break;
+        default:                *(volatile uint32_t*)field = value;             break;
+    }
+
+    eps_buffer_wire_update(id);
+
+    eps_data_written_mask[id / 8U] |= (uint8_t)(1U << (id % 8U));
+
+    eps_data_derived_valid &= (uint8_t)~eps_buffer_derived_deps(id);
+
+    if (eps_data_lazy_mask[id / 8U] & (1U << (id % 8U)))
+    {
+        eps_data_acquirer_t *acq = eps_buffer_get_acquirer(id);
+
+        acq->last_update = xTaskGetTickCount();
+        acq->written = true;
+    }
+}
+
+static uint8_t eps_buffer_chained_write(uint8_t id, uint32_t value, uint32_t *chained_value)
+{
+    *chained_value = EPS_DATA_MPPT_MANUAL_DUTY;
+
+    if (value != 1U)    /* Only the manual mode of the MPPTs has a chained write */
+    {
+        return EPS2_PARAM_ID_QTY;
+    }
+
+    switch(id)
+    {
+        case EPS2_PARAM_ID_MPPT_1_MODE: return EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE;
+        case EPS2_PARAM_ID_MPPT_2_MODE: return EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE;
+        case EPS2_PARAM_ID_MPPT_3_MODE: return EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE;
+        default:                        return EPS2_PARAM_ID_QTY;
+    }
+}
+
+static void eps_buffer_wire_update(uint8_t id)
+{
+    uint8_t slot = eps_data_beacon_slot[id];
+
+    if (slot == 0U)
+    {
+        return;
+    }
+
+    uint32_t val = eps_buffer_load(&eps_data_buff, id);
+    uint8_t *dst = &eps_data_beacon_wire[4U * (slot - 1U)];
+
+    dst[0] = (val >> 24) & 0xFF;
+    dst[1] = (val >> 16) & 0xFF;
+    dst[2] = (val >> 8)  & 0xFF;
+    dst[3] = (val >> 0)  & 0xFF;
+}
+
+static eps_data_acquirer_t *eps_buffer_get_acquirer(uint8_t id)
+{
+    uint8_t i = 0;
+
+    for(i = 0; i < eps_data_acquirers_qty; i++)
+    {
+        if (eps_data_acquirers[i].id == id)
+        {
+            return &eps_data_acquirers[i];
+        }
+    }
+
+    return NULL;
+}
+
+#if CONFIG_SET_DUMMY_EPS == 0
+static void eps_buffer_refresh(uint8_t id)
+{
+    if ((eps_data_lazy_mask[id / 8U] & (1U << (id % 8U))) == 0U)
+    {
+        return;
+    }
+
+    eps_param_acquire_t acquire = NULL;
+
+    taskENTER_CRITICAL();
+
+    eps_data_acquirer_t *acq = eps_buffer_get_acquirer(id);
+
+    if (!acq->written || ((xTaskGetTickCount() - acq->last_update) >= acq->max_age))
+    {
+        acquire = acq->acquire;
+    }
+
+    taskEXIT_CRITICAL();
+
+    if (acquire != NULL)
+    {
+        uint32_t val = 0;
+
+        if (acquire(id, &val) == 0)
+        {
+            eps_buffer_write(id, &val);
+        }
+        else
+        {
+            /* The last value is kept */
+            sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Error acquiring parameter ");
+            sys_log_print_uint(id);
+            sys_log_print_msg("!");
+            sys_log_new_line();
+        }
+    }
+}
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+static uint32_t eps_buffer_load(const eps_data_t *data, uint8_t id)
+{
+    const eps_param_desc_t *desc = &eps_param_table[id];
+    const volatile uint8_t *field = (const volatile uint8_t*)data + desc->offset;
+    uint32_t val = 0;
+
+    if (desc->access & EPS_PARAM_STATS)
+    {
+        return eps_stats_read((eps_stats_field_e)(id - EPS2_PARAM_ID_STATS_PARAM_ID));
+    }
+
+    if (desc->access & EPS_PARAM_HISTORY)
+    {
+        return eps_history_read((eps_history_field_e)(id - EPS2_PARAM_ID_HISTORY_TIME));
+    }
+
+    if (desc->access & EPS_PARAM_DERIVED)
+    {
+        /* The cache only holds values computed from the live data buffer */
+        if ((data == &eps_data_buff) && (eps_data_derived_valid & EPS_DATA_DERIVED_BIT(id)))
+        {
+            return eps_data_derived_cache[id - EPS2_PARAM_ID_FIRST_DERIVED];
+        }
+
+        return eps_buffer_derive(data, id);
+    }
+
+    switch(desc->size)
+    {
+        case sizeof(uint8_t):   val = *field;                               break;
+        case sizeof(uint16_t):  val = *(const volatile uint16_t*)field;     break;
+        default:                val = *(const volatile uint32_t*)field;     break;
+    }
+
+    if (desc->access & EPS_PARAM_SIGNED)
+    {
+        /* Sign extension of the narrower fields */
+        if ((desc->size == sizeof(uint8_t)) && (val & 0x80UL))
+        {
+            val |= 0xFFFFFF00UL;
+        }
+        else if ((desc->size == sizeof(uint16_t)) && (val & 0x8000UL))
+        {
+            val |= 0xFFFF0000UL;
+        }
+    }
+
+    return val;
+}
+
+static int32_t eps_buffer_load_int(const eps_data_t *data, uint8_t id)
+{
+    uint32_t val = eps_buffer_load(data, id);
+
+    if (eps_buffer_is_signed(id))
+    {
+        switch(eps_param_table[id].size)
+        {
+            case sizeof(uint8_t):   return (int8_t)val;
+            case sizeof(uint16_t):  return (int16_t)val;
+            default:                break;
+        }
+    }
+
+    return (int32_t)val;
+}
+
+#if CONFIG_SET_DUMMY_EPS == 0
+static void eps_buffer_derived_cache(uint8_t id, uint32_t value, uint16_t seq)
+{
+    if (((eps_param_table[id].access & EPS_PARAM_DERIVED) == 0U) || (eps_data_derived_valid & EPS_DATA_DERIVED_BIT(id)))
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+
+    /* A write between the computation and this point may have invalidated the value */
+    if (seq == eps_data_seq)
+    {
+        eps_data_derived_cache[id - EPS2_PARAM_ID_FIRST_DERIVED] = value;
+        eps_data_derived_valid |= EPS_DATA_DERIVED_BIT(id);
+    }
+
+    taskEXIT_CRITICAL();
+}
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+static uint8_t eps_buffer_derived_deps(uint8_t id)
+{
+    switch(id)
+    {
+        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
+        case EPS2_PARAM_ID_SP_MY_CURRENT:
+        case EPS2_PARAM_ID_SP_PX_CURRENT:
+            return EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_1_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_SP_INPUT_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_EFFICIENCY);
+        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
+        case EPS2_PARAM_ID_SP_MX_CURRENT:
+        case EPS2_PARAM_ID_SP_PZ_CURRENT:
+            return EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_2_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_SP_INPUT_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_EFFICIENCY);
+        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
+        case EPS2_PARAM_ID_SP_MZ_CURRENT:
+        case EPS2_PARAM_ID_SP_PY_CURRENT:
+            return EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_3_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_SP_INPUT_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_EFFICIENCY);
+        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
+        case EPS2_PARAM_ID_BAT_CURRENT:
+        case EPS2_PARAM_ID_EPS_CURRENT:
+            return EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MAIN_POWER_BUS_POWER) | EPS_DATA_DERIVED_BIT(EPS2_PARAM_ID_MPPT_EFFICIENCY);
+        default:
+            return 0;
+    }
+}
+
+static uint32_t eps_buffer_derive(const eps_data_t *data, uint8_t id)
+{
+    uint32_t p_in = 0;
+    int32_t p_bus = 0;
+
+    switch(id)
+    {
+        case EPS2_PARAM_ID_MPPT_1_POWER:
+            return eps_buffer_mppt_power(data, EPS2_PARAM_ID_SP_MY_PX_VOLTAGE, EPS2_PARAM_ID_SP_MY_CURRENT, EPS2_PARAM_ID_SP_PX_CURRENT);
+        case EPS2_PARAM_ID_MPPT_2_POWER:
+            return eps_buffer_mppt_power(data, EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE, EPS2_PARAM_ID_SP_MX_CURRENT, EPS2_PARAM_ID_SP_PZ_CURRENT);
+        case EPS2_PARAM_ID_MPPT_3_POWER:
+            return eps_buffer_mppt_power(data, EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE, EPS2_PARAM_ID_SP_MZ_CURRENT, EPS2_PARAM_ID_SP_PY_CURRENT);
+        default:
+            break;
+    }
+
+    p_in = eps_buffer_derive(data, EPS2_PARAM_ID_MPPT_1_POWER) +
+           eps_buffer_derive(data, EPS2_PARAM_ID_MPPT_2_POWER) +
+           eps_buffer_derive(data, EPS2_PARAM_ID_MPPT_3_POWER);
+
+    if (id == EPS2_PARAM_ID_SP_INPUT_POWER)
+    {
+        return p_in;
+    }
+
+    /* Power delivered to the main bus: charge of the batteries (signed, in mA) and EPS/beacon consumption */
+    int32_t v_bus = eps_buffer_load_int(data, EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE);
+
+    p_bus = ((v_bus * eps_buffer_load_int(data, EPS2_PARAM_ID_BAT_CURRENT)) / 1000L) +
+            (int32_t)(((uint32_t)v_bus * eps_buffer_load(data, EPS2_PARAM_ID_EPS_CURRENT)) / 1000UL);
+
+    if (id == EPS2_PARAM_ID_MAIN_POWER_BUS_POWER)
+    {
+        return (uint32_t)p_bus;
+    }
+
+    /* Efficiency in permille, limited to [0, 1000] (the loads of the other modules are not measured) */
+    if ((p_in == 0U) || (p_bus <= 0L))
+    {
+        return 0;
+    }
+
+    if ((uint32_t)p_bus >= p_in)
+    {
+        return 1000UL;
+    }
+
+    return ((uint32_t)p_bus * 1000UL) / p_in;
+}
+
+static uint32_t eps_buffer_mppt_power(const eps_data_t *data, uint8_t v_id, uint8_t i0_id, uint8_t i1_id)
+{
+    uint32_t v = eps_buffer_load(data, v_id);
+
+    /* mV * mA = uW, each product fits in 32 bits (16-bit operands) */
+    return ((v * eps_buffer_load(data, i0_id)) / 1000UL) + ((v * eps_buffer_load(data, i1_id)) / 1000UL);
+}
+
+static void eps_buffer_log_invalid_access(uint8_t id)
+{
+    if ((id >= EPS2_PARAM_ID_QTY) || (eps_param_table[id].access == 0U))
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Unknown parameter ID!");
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_DATA_NAME, "Access denied to parameter ");
+        sys_log_print_uint(id);
+        sys_log_print_msg("!");
+    }
+
+    sys_log_new_line();
+}
+
+static void eps_buffer_on_timestamp_write(uint8_t id, uint32_t value)
+{
+    system_set_time(value);
+}
+
+static void eps_buffer_on_bat_acc_current_write(uint8_t id, uint32_t value)
+{
+    /* The deprecated battery charge shares the field of the accumulated current */
+    eps_buffer_wire_update(EPS2_PARAM_ID_BAT_CHARGE);
+}
+
+static void eps_buffer_on_stats_select_write(uint8_t id, uint32_t value)
+{
+    /* An ID without statistics is latched with no samples */
+    eps_stats_latch((uint8_t)value);
+}
+
+static void eps_buffer_run_command(uint8_t id, uint32_t value)
+{
+    eps_history_sample_t sample;
+
+    switch(id)
+    {
+        case EPS2_PARAM_ID_HISTORY_SELECT:
+            /* An ID without history or an invalid tier is latched with no sample */
+            eps_history_select((uint8_t)(value >> 8), (eps_history_tier_e)(value & 0xFFUL), &sample);
+            break;
+        case EPS2_PARAM_ID_HISTORY_NEXT:
+            eps_history_next(&sample);
+            break;
+        default:
+            return;
+    }
+
+    /* Only the copy of the found sample is done in the critical section, as a new version of the data buffer */
+    taskENTER_CRITICAL();
+
+    eps_data_seq++;     /* Odd: update in progress */
+
+    eps_history_latch(&sample);
+
+    eps_data_seq++;     /* Even: new version published */
+
+    taskEXIT_CRITICAL();
+}
+
+#if CONFIG_SET_DUMMY_EPS == 1
+static uint32_t eps_buffer_dummy_value(uint8_t id)
+{
+    switch(id)
+    {
+        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:   return 0;
+        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:   return 0;
+        case EPS2_PARAM_ID_DEVICE_ID:           return 0xEEE2U;
+        case EPS2_PARAM_ID_BEACON_ENABLE:       return 1;
+        default:                                return id;
+    }
 }
+#endif /* CONFIG_SET_DUMMY_EPS */
 
 /** \} End of eps_data group */
@@ -26,9 +26,9 @@
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * \author André M. P. de Mattos <andre.mattos@spacelab.ufsc.br>
  *
- * \version 0.2.5
+ * \version 0.3.12
  *
- * \date 2021/04/09
+ * \date 2026/10/17
  *
  * \defgroup epd_data EPS Data
  * \ingroup structs
@@ -38,11 +38,22 @@
 #ifndef EPS_DATA_H_
 #define EPS_DATA_H_
 
+#include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <config/config.h>
 
+#include <FreeRTOS.h>
+#include <task.h>
+
 #define EPS_DATA_NAME       "EPS2 Buffer"
 
+#define EPS_DATA_SEQ_MAX_RETRIES    4       /**< Lock-free read attempts before falling back to a critical section. */
+#define EPS_DATA_MAX_SUBSCRIBERS    4       /**< Maximum number of tasks subscribed to parameters changes. */
+#define EPS_DATA_MAX_ACQUIRERS      8       /**< Maximum number of parameters refreshed on demand. */
+#define EPS_DATA_MPPT_MANUAL_DUTY   40U     /**< Duty cycle written when an MPPT is set to manual mode. */
+#define EPS_DATA_BEACON_BYTES       (4U * BEACON_PARAM_ID_QTY)   /**< Size of the beacon parameters in the wire format. */
+
 /**
  * \brief Parameters' IDs.
  */
@@ -99,48 +110,113 @@ typedef enum
     EPS2_PARAM_ID_DEVICE_ID                 = 48,
     EPS2_PARAM_ID_RESET_EPS                 = 49,
     EPS2_PARAM_ID_PAYLOAD_ENABLE            = 50,
-    EPS2_PARAM_ID_BEACON_ENABLE             = 51
+    EPS2_PARAM_ID_BEACON_ENABLE             = 51,
+    EPS2_PARAM_ID_SP_INPUT_POWER            = 52, /* Derived: total solar panels input power in mW. */
+    EPS2_PARAM_ID_MPPT_1_POWER              = 53, /* Derived: MPPT 1 input power (-Y/+X panels) in mW. */
+    EPS2_PARAM_ID_MPPT_2_POWER              = 54, /* Derived: MPPT 2 input power (-X/+Z panels) in mW. */
+    EPS2_PARAM_ID_MPPT_3_POWER              = 55, /* Derived: MPPT 3 input power (-Z/+Y panels) in mW. */
+    EPS2_PARAM_ID_MAIN_POWER_BUS_POWER      = 56, /* Derived: main bus power (battery + EPS/beacon) in mW, signed. */
+    EPS2_PARAM_ID_MPPT_EFFICIENCY           = 57, /* Derived: main bus power over input power in permille. */
+    EPS2_PARAM_ID_STATS_SELECT              = 58, /* Command: latches and restarts the statistics of the written parameter ID. */
+    EPS2_PARAM_ID_STATS_PARAM_ID            = 59, /* Latched statistics: parameter ID. */
+    EPS2_PARAM_ID_STATS_COUNT               = 60, /* Latched statistics: number of samples. */
+    EPS2_PARAM_ID_STATS_MIN                 = 61, /* Latched statistics: minimum, signed. */
+    EPS2_PARAM_ID_STATS_MAX                 = 62, /* Latched statistics: maximum, signed. */
+    EPS2_PARAM_ID_STATS_MEAN                = 63, /* Latched statistics: mean, signed. */
+    EPS2_PARAM_ID_STATS_STDDEV              = 64, /* Latched statistics: standard deviation. */
+    EPS2_PARAM_ID_CAL_GAIN                  = 65, /* Command: sets the Q16 gain of an ADC port (bits 31-28: port, bits 27-0: signed gain). */
+    EPS2_PARAM_ID_CAL_OFFSET                = 66, /* Command: sets the Q16 offset of an ADC port (bits 31-28: port, bits 27-0: signed offset). */
+    EPS2_PARAM_ID_CAL_SAVE                  = 67, /* Command: saves the sensors calibration in the flash memory (1) or restores the seeded one (0). */
+    EPS2_PARAM_ID_HISTORY_SELECT            = 68, /* Command: latches the oldest history sample (bits 15-8: parameter ID, bits 7-0: tier). */
+    EPS2_PARAM_ID_HISTORY_NEXT              = 69, /* Command: latches the next history sample. */
+    EPS2_PARAM_ID_HISTORY_TIME              = 70, /* Latched history sample: time in seconds (0xFFFFFFFF if there is no sample). */
+    EPS2_PARAM_ID_HISTORY_MIN               = 71, /* Latched history sample: minimum, signed. */
+    EPS2_PARAM_ID_HISTORY_MAX               = 72, /* Latched history sample: maximum, signed. */
+    EPS2_PARAM_ID_HISTORY_AVG               = 73  /* Latched history sample: average, signed. */
 } eps2_param_id_e;
 
+#define EPS2_PARAM_ID_QTY           (EPS2_PARAM_ID_HISTORY_AVG + 1)     /**< Number of parameters IDs. */
+
+#define EPS2_PARAM_ID_FIRST_DERIVED (EPS2_PARAM_ID_SP_INPUT_POWER)      /**< First derived parameter ID. */
+#define EPS_DATA_DERIVED_QTY        (EPS2_PARAM_ID_MPPT_EFFICIENCY + 1 - EPS2_PARAM_ID_FIRST_DERIVED)   /**< Number of derived parameters. */
+
+/**
+ * \brief Parameters' access flags.
+ */
+#define EPS_PARAM_ACCESS_R          (1U << 0)                           /**< The parameter can be read. */
+#define EPS_PARAM_ACCESS_W          (1U << 1)                           /**< The parameter can be written. */
+#define EPS_PARAM_ACCESS_RW         (EPS_PARAM_ACCESS_R | EPS_PARAM_ACCESS_W)
+#define EPS_PARAM_SIGNED            (1U << 2)                           /**< The stored value is signed (sign-extended on read). */
+#define EPS_PARAM_DERIVED           (1U << 3)                           /**< The value is computed from other parameters (no storage). */
+#define EPS_PARAM_STATS             (1U << 4)                           /**< The value is a field of the latched statistics (no storage). */
+#define EPS_PARAM_HISTORY           (1U << 5)                           /**< The value is a field of the latched history sample (no storage). */
+#define EPS_PARAM_STORAGE_SIGNED    (1U << 6)                           /**< The stored value is a two's complement, but it is read without sign extension (protocol compatibility). */
+
 /**
  * \brief EPS data.
+ *
+ * The fields are grouped by subsystem, and ordered by width inside each group
+ * (32, 16 and 8 bits), so the structure has no padding with 16-bit or 32-bit
+ * alignment of the uint32_t fields. The 8-bit fields at the end of the MCU block
+ * are continued by the 8-bit fields at the start of the battery monitor block.
+ *
+ * The size of each block is checked against its EPS_DATA_x_BYTES budget at
+ * compile time (see eps2_data.c).
  */
 typedef struct
 {
+    /**
+     *  EPS misc related data.
+     */
+    uint32_t firmware_version;                  /**< Hard-coded firmware version of EPS. */
+    uint16_t device_id;                         /**< Hard-coded device id of EPS. */
+    uint8_t hardware_version;                   /**< Hard-coded hardware version of EPS. */
+    uint8_t beacon_enable;                      /**< Beacon enable flag. */
+
     /**
      *  EPS MCU related data.
      */
-    uint32_t timestamp;                         /**< Time counter in milliseconds. */
-    uint8_t last_reset_cause;                   /**< EPS MCU last reset cause */
+    uint32_t timestamp;                         /**< Time counter in seconds. */
     uint16_t reset_counter;                     /**< EPS MCU reset counter */
     uint16_t eps_mcu_temp_kelvin;               /**< EPS MCU temperature in kelvin. */
     uint16_t eps_beacon_ma;                     /**< EPS circuitry and Beacon MCU current in mA. */
-    uint16_t main_power_buss_mv;                /**< Main power buss voltage in mV. */
-    uint8_t mppt_1_duty_cycle;                  /**< MPPT 1 duty cycle in %. */
-    uint8_t mppt_2_duty_cycle;                  /**< MPPT 2 duty cycle in %. */
-    uint8_t mppt_3_duty_cycle;                  /**< MPPT 3 duty cycle in %. */
-    uint8_t mppt_1_mode;                        /**< MPPT 1 mode flag. */
-    uint8_t mppt_2_mode;                        /**< MPPT 2 mode flag. */
-    uint8_t mppt_3_mode;                        /**< MPPT 3 mode flag. */
-    uint8_t heater1_mode;                       /**< Heater 1 mode flag. */
-    uint8_t heater2_mode;                       /**< Heater 2 mode flag. */
+    uint8_t last_reset_cause;                   /**< EPS MCU last reset cause */
+
+    /**
+     *  Battery monitor related data.
+     */
+    uint8_t bm_status_reg;                      /**< Batteries monitor status register. */
+    uint8_t bm_protection_reg;                  /**< Batteries monitor protection register. */
+    uint8_t bm_cycle_counter_reg;               /**< Batteries monitor cycle counter register. */
+    uint8_t bm_rarc_percent;                    /**< Battery monitor Remaining Active-Relative Capacity (RARC) in %. */
+    uint8_t bm_rsrc_percent;                    /**< Battery monitor Remaining Standby-Relative Capacity (RSRC) in %. */
+    uint16_t bm_temp_kelvin;                    /**< Battery monitor IC temperature in kelvin. */
+    uint16_t bm_raac_mah;                       /**< Battery monitor Remaining Active-Absolute Capacity (RAAC) in mAh. */
+    uint16_t bm_rsac_mah;                       /**< Battery monitor Remaining Standby-Absolute Capacity (RSAC) in mAh. */
 
     /**
-     *  Solar panels related data.
+     *  Solar panels and MPPT related data.
      */
     uint16_t minus_y_plus_x_solar_panel_mv;     /**< -Y and +X sides solar panel voltage in mV. */
     uint16_t minus_x_plus_z_solar_panel_mv;     /**< -X and +Z sides solar panel voltage in mV. */
     uint16_t minus_z_plus_y_solar_panel_mv;     /**< -Z and +Y sides solar panel voltage in mV. */
     uint16_t total_solar_panels_mv;             /**< Total solar panels output voltage after MPPT in mV. */
+    uint16_t main_power_buss_mv;                /**< Main power buss voltage in mV. */
     uint16_t minus_y_solar_panel_ma;            /**< -Y side soldar panel current in mA. */
     uint16_t plus_y_solar_panel_ma;             /**< +Y side solar panel current in mA. */
     uint16_t minus_x_solar_panel_ma;            /**< -X side solar panel current in mA. */
     uint16_t plus_x_solar_panel_ma;             /**< +X side solar panel current in mA. */
     uint16_t minus_z_solar_panel_ma;            /**< -Z side solar panel current in mA. */
     uint16_t plus_z_solar_panel_ma;             /**< +Z side solar panel current in mA. */
-    uint32_t solar_panels_rtd4_kelvin;          /**< Solar panels RTD 4 temperature in kelvin. */
-    uint32_t solar_panels_rtd5_kelvin;          /**< Solar panels RTD 5 temperature in kelvin. */
-    uint32_t solar_panels_rtd6_kelvin;          /**< Solar panels RTD 6 temperature in kelvin. */
+    uint16_t solar_panels_rtd4_kelvin;          /**< Solar panels RTD 4 temperature in kelvin. */
+    uint16_t solar_panels_rtd5_kelvin;          /**< Solar panels RTD 5 temperature in kelvin. */
+    uint16_t solar_panels_rtd6_kelvin;          /**< Solar panels RTD 6 temperature in kelvin. */
+    uint8_t mppt_1_duty_cycle;                  /**< MPPT 1 duty cycle in %. */
+    uint8_t mppt_2_duty_cycle;                  /**< MPPT 2 duty cycle in %. */
+    uint8_t mppt_3_duty_cycle;                  /**< MPPT 3 duty cycle in %. */
+    uint8_t mppt_1_mode;                        /**< MPPT 1 mode flag. */
+    uint8_t mppt_2_mode;                        /**< MPPT 2 mode flag. */
+    uint8_t mppt_3_mode;                        /**< MPPT 3 mode flag. */
 
     /**
      *  Batteries related data.
@@ -148,36 +224,80 @@ typedef struct
     uint16_t batteries_mv;                      /**< Batteries voltage in mV. */
     uint16_t batteries_ma;                      /**< Batteries current in mA. */
     uint16_t batteries_average_ma;              /**< Batteries average current in 8 mA measurements. */
-    uint16_t batteries_accumulated_ma;          /**< Batteries accumulated current in mA. */
-    uint16_t batteries_charge_mah;              /**< Batteries charge in mAh. */ /* DEPRECATED PARAMETER! Returns the accumulated current value. */
-    uint32_t batteries_rtd0_kelvin;             /**< Batteries RTD 0 temperature in kelvin. */
-    uint32_t batteries_rtd1_kelvin;             /**< Batteries RTD 1 temperature in kelvin. */
-    uint32_t batteries_rtd2_kelvin;             /**< Batteries RTD 2 temperature in kelvin. */
-    uint32_t batteries_rtd3_kelvin;             /**< Batteries RTD 3 temperature in kelvin. */
+    uint16_t batteries_accumulated_ma;          /**< Batteries accumulated current in mA (also returned as the deprecated battery charge). */
+    uint16_t batteries_rtd0_kelvin;             /**< Batteries RTD 0 temperature in kelvin. */
+    uint16_t batteries_rtd1_kelvin;             /**< Batteries RTD 1 temperature in kelvin. */
+    uint16_t batteries_rtd2_kelvin;             /**< Batteries RTD 2 temperature in kelvin. */
+    uint16_t batteries_rtd3_kelvin;             /**< Batteries RTD 3 temperature in kelvin. */
     uint8_t heater1_duty_cycle;                 /**< Batteries heater 1 duty cyle in %. */
     uint8_t heater2_duty_cycle;                 /**< Batteries heater 2 duty cyle in %. */
+    uint8_t heater1_mode;                       /**< Heater 1 mode flag. */
+    uint8_t heater2_mode;                       /**< Heater 2 mode flag. */
+} eps_data_t;
 
-    /**
-     *  Battery monitor related data.
-     */
-    uint16_t bm_temp_kelvin;                    /**< Battery monitor IC temperature in kelvin. */
-    uint8_t bm_status_reg;                      /**< Batteries monitor status register. */
-    uint8_t bm_protection_reg;                  /**< Batteries monitor protection register. */
-    uint8_t bm_cycle_counter_reg;               /**< Batteries monitor cycle counter register. */
-    uint16_t bm_raac_mah;                       /**< Battery monitor Remaining Active-Absolute Capacity (RAAC) in mAh. */
-    uint16_t bm_rsac_mah;                       /**< Battery monitor Remaining Standby-Absolute Capacity (RSAC) in mAh. */
-    uint8_t bm_rarc_percent;                    /**< Battery monitor Remaining Active-Relative Capacity (RARC) in %. */
-    uint8_t bm_rsrc_percent;                    /**< Battery monitor Remaining Standby-Relative Capacity (RSRC) in %. */
+/**
+ * \brief Size budget of each eps_data_t block in bytes.
+ */
+#define EPS_DATA_MISC_BYTES         8U
+#define EPS_DATA_MCU_BYTES          11U
+#define EPS_DATA_BM_BYTES           11U
+#define EPS_DATA_SOLAR_BYTES        34U
+#define EPS_DATA_BAT_BYTES          20U
+#define EPS_DATA_BYTES              (EPS_DATA_MISC_BYTES + EPS_DATA_MCU_BYTES + EPS_DATA_BM_BYTES + EPS_DATA_SOLAR_BYTES + EPS_DATA_BAT_BYTES)
 
-    /**
-     *  EPS misc related data.
-     */
-    uint32_t firmware_version;                  /**< Hard-coded firmware version of EPS. */
-    uint8_t hardware_version;                   /**< Hard-coded hardware version of EPS. */
-    uint16_t device_id;                         /**< Hard-coded device id of EPS. */
-    uint8_t beacon_enable;                      /**< Hard-coded hardware version of EPS. */
-    
-} eps_data_t;
+/**
+ * \brief Size of the eps_data_t block that goes from the field first to the field next (exclusive).
+ */
+#define EPS_DATA_BLOCK_SIZE(first, next)    (offsetof(eps_data_t, next) - offsetof(eps_data_t, first))
+
+/**
+ * \brief Subscription to parameters changes.
+ */
+typedef struct
+{
+    TaskHandle_t task;                                  /**< Task to notify (NULL if the slot is free). */
+    uint32_t notify_bits;                               /**< Notification bits set in the task (eSetBits). */
+    uint8_t ids_mask[(EPS2_PARAM_ID_QTY + 7U) / 8U];    /**< Bitmap of the watched parameters IDs. */
+} eps_data_subscriber_t;
+
+/**
+ * \brief Parameter write hook.
+ *
+ * Called after the new value is stored, still inside the data buffer critical section.
+ */
+typedef void (*eps_param_hook_t)(uint8_t id, uint32_t value);
+
+/**
+ * \brief Acquisition callback of a parameter refreshed on demand.
+ *
+ * \param[in] id is the parameter ID to acquire.
+ *
+ * \param[out] value is the acquired value.
+ *
+ * \return The status/error code.
+ */
+typedef int (*eps_param_acquire_t)(uint8_t id, uint32_t *value);
+
+/**
+ * \brief Parameter descriptor.
+ */
+typedef struct
+{
+    uint16_t offset;                            /**< Offset of the parameter inside eps_data_t. */
+    uint8_t size;                               /**< Width of the parameter in bytes (0 if it has no storage, like the commands). */
+    uint8_t access;                             /**< Access flags (EPS_PARAM_ACCESS_x/EPS_PARAM_SIGNED/EPS_PARAM_DERIVED/EPS_PARAM_STATS/EPS_PARAM_HISTORY/EPS_PARAM_STORAGE_SIGNED). */
+    eps_param_hook_t on_write;                  /**< Optional write hook. */
+} eps_param_desc_t;
+
+/**
+ * \brief Initializes the EPS data buffer.
+ *
+ * Builds the wire image of the beacon parameters from the current content of
+ * the data buffer. Must be called before the tasks that use the data buffer.
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_init(void);
 
 /**
  * \brief Function to write a value into the EPS data buffer.
@@ -193,6 +313,9 @@ int eps_buffer_write(uint8_t id, uint32_t *value);
 /**
  * \brief Function to read a value of the EPS data buffer.
  *
+ * Derived parameters (EPS_PARAM_DERIVED) are computed from a consistent version
+ * of their source parameters, and cached until one of the sources is written.
+ *
  * \param[in] id is a value to select a variable within the data buffer.
  *
  * \param[out] value is the data that will be read from the buffer.
@@ -201,6 +324,122 @@ int eps_buffer_write(uint8_t id, uint32_t *value);
  */
 int eps_buffer_read(uint8_t id, uint32_t *value);
 
+/**
+ * \brief Writes a list of parameters into the EPS data buffer as one update.
+ *
+ * All the IDs are validated first, so either every value is written or none is.
+ *
+ * \param[in] ids is the list of parameters IDs.
+ *
+ * \param[in] n is the number of parameters in the list.
+ *
+ * \param[in] values are the new values, in the same order of ids.
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_write_many(const uint8_t *ids, uint8_t n, const uint32_t *values);
+
+/**
+ * \brief Reads a list of parameters from the same version of the EPS data buffer.
+ *
+ * \param[in] ids is the list of parameters IDs.
+ *
+ * \param[in] n is the number of parameters in the list.
+ *
+ * \param[out] out are the read values, in the same order of ids.
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_read_many(const uint8_t *ids, uint8_t n, uint32_t *out);
+
+/**
+ * \brief Subscribes a task to the changes of a list of parameters.
+ *
+ * Every time one of the given parameters is written by another task, the
+ * notify_bits are set in the task notification value (xTaskNotifyWait()).
+ * Calling it again for the same task adds parameters to its subscription.
+ *
+ * \param[in] task is the task to notify.
+ *
+ * \param[in] ids is the list of parameters IDs to watch.
+ *
+ * \param[in] n is the number of parameters in the list.
+ *
+ * \param[in] notify_bits are the bits to set in the notification value of the task.
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_subscribe(TaskHandle_t task, const uint8_t *ids, uint8_t n, uint32_t notify_bits);
+
+/**
+ * \brief Registers a parameter to be refreshed on demand.
+ *
+ * When the parameter is read with eps_buffer_read() or eps_buffer_read_many() and
+ * its last write is older than max_age_ms (or it was never written), the
+ * acquisition callback is called in the context of the reader and the acquired
+ * value is written before the read. The beacon is not refreshed.
+ *
+ * \note The callback must protect the bus it uses against the other tasks.
+ *
+ * \param[in] id is a writable parameter ID.
+ *
+ * \param[in] acquire is the acquisition callback.
+ *
+ * \param[in] max_age_ms is the maximum age of the value in milliseconds.
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_set_acquire(uint8_t id, eps_param_acquire_t acquire, uint32_t max_age_ms);
+
+/**
+ * \brief Reads the beacon parameters in the wire format.
+ *
+ * The data buffer keeps the beacon parameters in the wire format (big-endian,
+ * 4 bytes per parameter, in the BEACON_PARAM_ID_LIST order), updated on each
+ * write, so the beacon packet is built with a single block copy. All the
+ * parameters come from the same version of the data buffer.
+ *
+ * \param[out] buf is the buffer to store the parameters (EPS_DATA_BEACON_BYTES bytes).
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_read_beacon(uint8_t *buf);
+
+/**
+ * \brief Publishes the system time in the timestamp parameter.
+ *
+ * Unlike a write of EPS2_PARAM_ID_TIMESTAMP (a time set from the OBDH), it does not
+ * run the write hook that sets the system time, and it has no history, statistics
+ * or notifications. Called by the owner of the clock (time control task).
+ *
+ * \return The status/error code.
+ */
+int eps_buffer_publish_time(void);
+
+/**
+ * \brief Checks if a parameter was written at least once since the initialization.
+ *
+ * Tells a published zero apart from a parameter that was never written.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return True if the parameter was written (false for an unknown ID).
+ */
+bool eps_buffer_is_written(uint8_t id);
+
+/**
+ * \brief Checks if a parameter holds a two's complement value.
+ *
+ * The signedness comes from the parameters descriptors table (EPS_PARAM_SIGNED or
+ * EPS_PARAM_STORAGE_SIGNED), so the modules that process the values (history,
+ * statistics, filters) do not keep their own list of signed parameters.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return True if the parameter is signed (false for an unknown ID).
+ */
+bool eps_buffer_is_signed(uint8_t id);
+
 #endif /* EPS_DATA_H_ */
 
 /** \} End of eps_data group */
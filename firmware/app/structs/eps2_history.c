@@ -0,0 +1,462 @@
+/*
+ * eps2_history.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief EPS telemetry history implementation.
+ *
+ * \version 0.1.3
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup eps_history
+ * \{
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "eps2_data.h"
+#include "eps2_history.h"
+
+#define EPS_HISTORY_PARAM_QTY       (sizeof(eps_history_ids) / sizeof(eps_history_ids[0]))
+#define EPS_HISTORY_NO_SLOT         0xFFU
+
+static const uint8_t eps_history_ids[] = {HISTORY_PARAM_ID_LIST};
+
+static eps_history_t eps_history[EPS_HISTORY_PARAM_QTY];
+
+static uint8_t eps_history_cursor_id = 0;
+static eps_history_tier_e eps_history_cursor_tier = EPS_HISTORY_TIER_RAW;
+static const eps_history_sample_t eps_history_no_sample = {EPS_HISTORY_NO_SAMPLE, 0, 0, 0};
+static eps_history_sample_t eps_history_latched = {EPS_HISTORY_NO_SAMPLE, 0, 0, 0};
+
+/**
+ * \brief Gets the history slot of a parameter.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return The slot index or EPS_HISTORY_NO_SLOT if the parameter has no history.
+ */
+static uint8_t eps_history_slot(uint8_t id);
+
+/**
+ * \brief Converts a parameter value to a 16-bit code.
+ *
+ * Unsigned values are saturated to 0xFFFF. Signed values are stored as offset
+ * binary (+0x8000), so the codes keep the order of the values.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] value is the parameter value.
+ *
+ * \return The encoded value.
+ */
+static uint16_t eps_history_encode(uint8_t id, uint32_t value);
+
+/**
+ * \brief Converts a 16-bit code back to the parameter value.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] code is the encoded value.
+ *
+ * \return The decoded value.
+ */
+static int32_t eps_history_decode(uint8_t id, uint16_t code);
+
+/**
+ * \brief Adds a code to a bucket accumulator, closing the bucket if its period is over.
+ *
+ * \param[in,out] acc is the accumulator of the tier.
+ *
+ * \param[in,out] ring is the buckets ring of the tier.
+ *
+ * \param[in,out] head is the next write position of the ring.
+ *
+ * \param[in,out] count is the number of valid buckets of the ring.
+ *
+ * \param[in] depth is the capacity of the ring.
+ *
+ * \param[in] period is the period of the buckets in seconds.
+ *
+ * \param[in] code is the encoded value.
+ *
+ * \param[in] time is the sample time in seconds.
+ *
+ * \return None.
+ */
+static void eps_history_accumulate(eps_history_acc_t *acc, eps_history_bucket_t *ring, uint8_t *head, uint8_t *count,
+                                   uint8_t depth, uint32_t period, uint16_t code, uint32_t time);
+
+/**
+ * \brief Clears the history of a single parameter.
+ *
+ * \param[out] hist is the history to clear.
+ *
+ * \return None.
+ */
+static void eps_history_clear(eps_history_t *hist);
+
+/**
+ * \brief Finds the first sample of the cursor parameter/tier at or after a given time.
+ *
+ * \param[in] from is the minimum sample time in seconds.
+ *
+ * \param[out] sample is the found sample (time = EPS_HISTORY_NO_SAMPLE if there is none).
+ *
+ * \return The status/error code.
+ */
+static int eps_history_find(uint32_t from, eps_history_sample_t *sample);
+
+int eps_history_init(void)
+{
+    uint8_t i = 0;
+
+    taskENTER_CRITICAL();
+
+    for(i = 0; i < EPS_HISTORY_PARAM_QTY; i++)
+    {
+        eps_history_clear(&eps_history[i]);
+    }
+
+    eps_history_latched = eps_history_no_sample;
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+void eps_history_push(uint8_t id, uint32_t value, uint32_t time)
+{
+    uint8_t slot = eps_history_slot(id);
+
+    if (slot == EPS_HISTORY_NO_SLOT)
+    {
+        return;
+    }
+
+    eps_history_t *hist = &eps_history[slot];
+    uint16_t code = eps_history_encode(id, value);
+
+    taskENTER_CRITICAL();
+
+    if ((hist->raw_count > 0U) && (time < hist->last_time))
+    {
+        /* The system time went backwards (time sync), the old samples can not be ordered anymore */
+        eps_history_clear(hist);
+    }
+
+    /* Raw tier: the delta is stored in the previous sample, the newest one has the absolute time */
+    if (hist->raw_count > 0U)
+    {
+        uint32_t dt = time - hist->last_time;
+
+        if (dt > 0xFFFFUL)
+        {
+            /* The delta does not fit in the sample, the older raw samples are dropped */
+            hist->raw_head = 0;
+            hist->raw_count = 0;
+        }
+        else
+        {
+            hist->raw[(hist->raw_head + CONFIG_HISTORY_RAW_DEPTH - 1U) % CONFIG_HISTORY_RAW_DEPTH].dt = (uint16_t)dt;
+        }
+    }
+
+    hist->raw[hist->raw_head].dt = 0;
+    hist->raw[hist->raw_head].code = code;
+    hist->raw_head = (hist->raw_head + 1U) % CONFIG_HISTORY_RAW_DEPTH;
+
+    if (hist->raw_count < CONFIG_HISTORY_RAW_DEPTH)
+    {
+        hist->raw_count++;
+    }
+
+    hist->last_time = time;
+
+    eps_history_accumulate(&hist->acc_1min, hist->b1, &hist->b1_head, &hist->b1_count,
+                           CONFIG_HISTORY_1MIN_DEPTH, EPS_HISTORY_1MIN_PERIOD_S, code, time);
+
+    eps_history_accumulate(&hist->acc_10min, hist->b10, &hist->b10_head, &hist->b10_count,
+                           CONFIG_HISTORY_10MIN_DEPTH, EPS_HISTORY_10MIN_PERIOD_S, code, time);
+
+    taskEXIT_CRITICAL();
+}
+
+uint8_t eps_history_is_tracked(uint8_t id)
+{
+    return (eps_history_slot(id) == EPS_HISTORY_NO_SLOT) ? 0U : 1U;
+}
+
+int eps_history_query(uint8_t id, eps_history_tier_e tier, uint32_t from, uint32_t to, eps_history_sample_t *out, uint8_t max, uint8_t *n)
+{
+    uint8_t slot = eps_history_slot(id);
+
+    if ((slot == EPS_HISTORY_NO_SLOT) || (tier >= EPS_HISTORY_TIER_QTY) || (out == NULL) || (n == NULL) || (from > to))
+    {
+        return -1;
+    }
+
+    eps_history_t *hist = &eps_history[slot];
+    uint8_t count = 0;
+    uint8_t i = 0;
+
+    *n = 0;
+
+    /* The rings are small (CONFIG_HISTORY_x_DEPTH), so they are copied in a single critical section */
+    taskENTER_CRITICAL();
+
+    if (tier == EPS_HISTORY_TIER_RAW)
+    {
+        uint8_t pos = 0;
+        uint32_t time = hist->last_time;
+
+        count = hist->raw_count;
+
+        /* Rebuild the time of the oldest sample walking the deltas backwards from the newest one */
+        for(i = 1; i < count; i++)
+        {
+            pos = (hist->raw_head + CONFIG_HISTORY_RAW_DEPTH - 1U - i) % CONFIG_HISTORY_RAW_DEPTH;
+
+            time -= hist->raw[pos].dt;
+        }
+
+        for(i = 0; (i < count) && (*n < max) && (time <= to); i++)
+        {
+            pos = (hist->raw_head + CONFIG_HISTORY_RAW_DEPTH - count + i) % CONFIG_HISTORY_RAW_DEPTH;
+
+            if (time >= from)
+            {
+                out[*n].time = time;
+                out[*n].avg = eps_history_decode(id, hist->raw[pos].code);
+                out[*n].min = out[*n].avg;
+                out[*n].max = out[*n].avg;
+                (*n)++;
+            }
+
+            time += hist->raw[pos].dt;
+        }
+    }
+    else
+    {
+        const eps_history_bucket_t *ring = (tier == EPS_HISTORY_TIER_1MIN) ? hist->b1 : hist->b10;
+        uint8_t head = (tier == EPS_HISTORY_TIER_1MIN) ? hist->b1_head : hist->b10_head;
+        uint8_t depth = (tier == EPS_HISTORY_TIER_1MIN) ? CONFIG_HISTORY_1MIN_DEPTH : CONFIG_HISTORY_10MIN_DEPTH;
+        uint32_t period = (tier == EPS_HISTORY_TIER_1MIN) ? EPS_HISTORY_1MIN_PERIOD_S : EPS_HISTORY_10MIN_PERIOD_S;
+        uint32_t start = (tier == EPS_HISTORY_TIER_1MIN) ? hist->acc_1min.start : hist->acc_10min.start;
+
+        count = (tier == EPS_HISTORY_TIER_1MIN) ? hist->b1_count : hist->b10_count;
+
+        /* The closed buckets are contiguous and the newest one ends at the start of the open bucket */
+        uint32_t time = start - ((uint32_t)count * period);
+
+        for(i = 0; (i < count) && (*n < max) && (time <= to); i++)
+        {
+            const eps_history_bucket_t *bucket = &ring[(head + depth - count + i) % depth];
+
+            if ((time >= from) && (bucket->min <= bucket->max))
+            {
+                out[*n].time = time;
+                out[*n].min = eps_history_decode(id, bucket->min);
+                out[*n].max = eps_history_decode(id, bucket->max);
+                out[*n].avg = eps_history_decode(id, bucket->avg);
+                (*n)++;
+            }
+
+            time += period;
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+int eps_history_select(uint8_t id, eps_history_tier_e tier, eps_history_sample_t *sample)
+{
+    eps_history_cursor_id = id;
+    eps_history_cursor_tier = tier;
+
+    return eps_history_find(0, sample);
+}
+
+int eps_history_next(eps_history_sample_t *sample)
+{
+    uint32_t last = eps_history_latched.time;
+
+    if (last == EPS_HISTORY_NO_SAMPLE)
+    {
+        *sample = eps_history_no_sample;
+
+        return -1;
+    }
+
+    return eps_history_find(last + 1UL, sample);
+}
+
+void eps_history_latch(const eps_history_sample_t *sample)
+{
+    eps_history_latched = *sample;
+}
+
+uint32_t eps_history_read(eps_history_field_e field)
+{
+    switch(field)
+    {
+        case EPS_HISTORY_FIELD_TIME:    return eps_history_latched.time;
+        case EPS_HISTORY_FIELD_MIN:     return (uint32_t)eps_history_latched.min;
+        case EPS_HISTORY_FIELD_MAX:     return (uint32_t)eps_history_latched.max;
+        case EPS_HISTORY_FIELD_AVG:     return (uint32_t)eps_history_latched.avg;
+        default:                        return 0;
+    }
+}
+
+static uint8_t eps_history_slot(uint8_t id)
+{
+    uint8_t i = 0;
+
+    for(i = 0; i < EPS_HISTORY_PARAM_QTY; i++)
+    {
+        if (eps_history_ids[i] == id)
+        {
+            return i;
+        }
+    }
+
+    return EPS_HISTORY_NO_SLOT;
+}
+
+static uint16_t eps_history_encode(uint8_t id, uint32_t value)
+{
+    if (eps_buffer_is_signed(id))
+    {
+        return (uint16_t)value ^ 0x8000U;
+    }
+
+    return (value > 0xFFFFUL) ? 0xFFFFU : (uint16_t)value;
+}
+
+static int32_t eps_history_decode(uint8_t id, uint16_t code)
+{
+    if (eps_buffer_is_signed(id))
+    {
+        return (int32_t)code - 0x8000L;
+    }
+
+    return (int32_t)code;
+}
+
+static void eps_history_accumulate(eps_history_acc_t *acc, eps_history_bucket_t *ring, uint8_t *head, uint8_t *count,
+                                   uint8_t depth, uint32_t period, uint16_t code, uint32_t time)
+{
+    uint32_t start = time - (time % period);
+
+    if (acc->n == 0U)
+    {
+        acc->start = start;
+    }
+    else if (start != acc->start)
+    {
+        uint32_t gap = (start - acc->start) / period;
+
+        if (gap > depth)
+        {
+            /* Every closed bucket would be out of the ring, just empty it */
+            *head = 0;
+            *count = 0;
+        }
+        else
+        {
+            /* Close the open bucket, and add an empty bucket for each period without samples */
+            uint8_t i = 0;
+
+            for(i = 0; i < (uint8_t)gap; i++)
+            {
+                if (i == 0U)
+                {
+                    ring[*head].min = acc->min;
+                    ring[*head].max = acc->max;
+                    ring[*head].avg = (uint16_t)((acc->sum + (acc->n / 2U)) / acc->n);
+                }
+                else
+                {
+                    ring[*head].min = 0xFFFFU;
+                    ring[*head].max = 0U;
+                    ring[*head].avg = 0U;
+                }
+
+                *head = (*head + 1U) % depth;
+
+                if (*count < depth)
+                {
+                    (*count)++;
+                }
+            }
+        }
+
+        acc->start = start;
+        acc->sum = 0;
+        acc->n = 0;
+    }
+    else
+    {
+        /* Same bucket */
+    }
+
+    if (acc->n == 0U)
+    {
+        acc->min = code;
+        acc->max = code;
+    }
+    else
+    {
+        acc->min = (code < acc->min) ? code : acc->min;
+        acc->max = (code > acc->max) ? code : acc->max;
+    }
+
+    acc->sum += code;
+    acc->n++;
+}
+
+static void eps_history_clear(eps_history_t *hist)
+{
+    memset(hist, 0, sizeof(eps_history_t));
+}
+
+static int eps_history_find(uint32_t from, eps_history_sample_t *sample)
+{
+    uint8_t n = 0;
+
+    if ((eps_history_query(eps_history_cursor_id, eps_history_cursor_tier, from, UINT32_MAX, sample, 1, &n) != 0) || (n == 0U))
+    {
+        *sample = eps_history_no_sample;
+
+        return -1;
+    }
+
+    return 0;
+}
+
+/** \} End of eps_history group */
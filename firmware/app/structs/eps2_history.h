@@ -0,0 +1,253 @@
+/*
+ * eps2_history.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief EPS telemetry history definition.
+ *
+ * RAM history of a selected list of parameters (HISTORY_PARAM_ID_LIST), fed by
+ * the EPS data buffer writes. Each parameter keeps three ring buffers:
+ *  - Raw samples (one per write);
+ *  - 1-minute buckets with the min/max/average of the raw samples;
+ *  - 10-minute buckets with the min/max/average of the raw samples.
+ *
+ * The values are stored as 16-bit codes (saturated, offset binary for the
+ * signed parameters). The raw samples store the time as a 16-bit delta to the
+ * next sample, and the buckets are aligned to their period, so no absolute
+ * timestamp is stored per sample.
+ *
+ * The history is read through a cursor: eps_history_select() finds the
+ * oldest sample of a parameter/tier, eps_history_next() finds the one that
+ * follows the latched sample, eps_history_latch() latches a found sample and
+ * eps_history_read() returns the fields of the latched sample. The EPS data
+ * buffer exposes the cursor as the EPS2_PARAM_ID_HISTORY_x parameters.
+ *
+ * \version 0.1.2
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup eps_history EPS History
+ * \ingroup structs
+ * \{
+ */
+
+#ifndef EPS_HISTORY_H_
+#define EPS_HISTORY_H_
+
+#include <stdint.h>
+#include <config/config.h>
+
+#define EPS_HISTORY_NAME            "EPS2 History"
+
+#define EPS_HISTORY_1MIN_PERIOD_S   60UL        /**< Period of the 1-minute buckets in seconds. */
+#define EPS_HISTORY_10MIN_PERIOD_S  600UL       /**< Period of the 10-minute buckets in seconds. */
+#define EPS_HISTORY_NO_SAMPLE       0xFFFFFFFFUL /**< Time field of the cursor when no sample is latched. */
+
+/**
+ * \brief History tiers.
+ */
+typedef enum
+{
+    EPS_HISTORY_TIER_RAW = 0,                   /**< Raw samples. */
+    EPS_HISTORY_TIER_1MIN,                      /**< 1-minute min/max/average buckets. */
+    EPS_HISTORY_TIER_10MIN,                     /**< 10-minute min/max/average buckets. */
+    EPS_HISTORY_TIER_QTY                        /**< Number of tiers. */
+} eps_history_tier_e;
+
+/**
+ * \brief Fields of the latched history sample.
+ */
+typedef enum
+{
+    EPS_HISTORY_FIELD_TIME = 0,                 /**< Sample time in seconds (EPS_HISTORY_NO_SAMPLE if none). */
+    EPS_HISTORY_FIELD_MIN,                      /**< Minimum value. */
+    EPS_HISTORY_FIELD_MAX,                      /**< Maximum value. */
+    EPS_HISTORY_FIELD_AVG,                      /**< Average value. */
+    EPS_HISTORY_FIELD_QTY                       /**< Number of fields. */
+} eps_history_field_e;
+
+/**
+ * \brief Decoded history sample.
+ */
+typedef struct
+{
+    uint32_t time;                              /**< Sample time (or start of the bucket) in seconds. */
+    int32_t min;                                /**< Minimum value (equal to avg in the raw tier). */
+    int32_t max;                                /**< Maximum value (equal to avg in the raw tier). */
+    int32_t avg;                                /**< Average value (or the raw value). */
+} eps_history_sample_t;
+
+/**
+ * \brief Raw sample (compact encoding).
+ */
+typedef struct
+{
+    uint16_t dt;                                /**< Seconds since the previous sample (saturated). */
+    uint16_t code;                              /**< Encoded value. */
+} eps_history_raw_t;
+
+/**
+ * \brief Min/max/average bucket (compact encoding).
+ */
+typedef struct
+{
+    uint16_t min;                               /**< Encoded minimum (greater than max if the bucket is empty). */
+    uint16_t max;                               /**< Encoded maximum. */
+    uint16_t avg;                               /**< Encoded average. */
+} eps_history_bucket_t;
+
+/**
+ * \brief Accumulator of the open bucket of a tier.
+ */
+typedef struct
+{
+    uint32_t start;                             /**< Start time of the open bucket in seconds. */
+    uint32_t sum;                               /**< Sum of the encoded samples. */
+    uint16_t n;                                 /**< Number of samples. */
+    uint16_t min;                               /**< Encoded minimum. */
+    uint16_t max;                               /**< Encoded maximum. */
+} eps_history_acc_t;
+
+/**
+ * \brief History of a single parameter.
+ */
+typedef struct
+{
+    uint32_t last_time;                         /**< Time of the newest raw sample in seconds. */
+    uint8_t raw_head;                           /**< Next position to write in the raw ring. */
+    uint8_t raw_count;                          /**< Number of valid raw samples. */
+    uint8_t b1_head;                            /**< Next position to write in the 1-minute ring. */
+    uint8_t b1_count;                           /**< Number of valid 1-minute buckets. */
+    uint8_t b10_head;                           /**< Next position to write in the 10-minute ring. */
+    uint8_t b10_count;                          /**< Number of valid 10-minute buckets. */
+    eps_history_acc_t acc_1min;                 /**< Open 1-minute bucket. */
+    eps_history_acc_t acc_10min;                /**< Open 10-minute bucket. */
+    eps_history_raw_t raw[CONFIG_HISTORY_RAW_DEPTH];            /**< Raw samples ring. */
+    eps_history_bucket_t b1[CONFIG_HISTORY_1MIN_DEPTH];         /**< 1-minute buckets ring. */
+    eps_history_bucket_t b10[CONFIG_HISTORY_10MIN_DEPTH];       /**< 10-minute buckets ring. */
+} eps_history_t;
+
+/**
+ * \brief Clears the history of all parameters.
+ *
+ * \return The status/error code.
+ */
+int eps_history_init(void);
+
+/**
+ * \brief Adds a new sample of a parameter to its history.
+ *
+ * Parameters that are not in HISTORY_PARAM_ID_LIST are ignored.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \param[in] time is the current system time in seconds.
+ *
+ * \return None.
+ */
+void eps_history_push(uint8_t id, uint32_t value, uint32_t time);
+
+/**
+ * \brief Checks if a parameter has history.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return 1 if the parameter is in HISTORY_PARAM_ID_LIST, 0 otherwise.
+ */
+uint8_t eps_history_is_tracked(uint8_t id);
+
+/**
+ * \brief Reads the history of a parameter in a time range.
+ *
+ * The samples are returned from the oldest to the newest. Empty buckets are skipped.
+ * The open buckets (current minute and current 10 minutes) are not returned.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] tier is the history tier (EPS_HISTORY_TIER_RAW, EPS_HISTORY_TIER_1MIN or EPS_HISTORY_TIER_10MIN).
+ *
+ * \param[in] from is the start of the time range in seconds (inclusive).
+ *
+ * \param[in] to is the end of the time range in seconds (inclusive).
+ *
+ * \param[out] out is the array to store the samples.
+ *
+ * \param[in] max is the capacity of the out array.
+ *
+ * \param[out] n is the number of samples written in out.
+ *
+ * \return The status/error code.
+ */
+int eps_history_query(uint8_t id, eps_history_tier_e tier, uint32_t from, uint32_t to, eps_history_sample_t *out, uint8_t max, uint8_t *n);
+
+/**
+ * \brief Points the cursor to a parameter/tier and finds its oldest sample.
+ *
+ * The ring of the parameter is walked, so it must be called outside the critical
+ * sections. The sample is only visible after eps_history_latch().
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] tier is the history tier.
+ *
+ * \param[out] sample is the found sample (time = EPS_HISTORY_NO_SAMPLE if there is none).
+ *
+ * \return The status/error code (-1 if the parameter has no history or no sample).
+ */
+int eps_history_select(uint8_t id, eps_history_tier_e tier, eps_history_sample_t *sample);
+
+/**
+ * \brief Finds the sample following the latched one.
+ *
+ * The time resolution is 1 second, so raw samples written in the same second
+ * as the latched one are skipped. Must be called outside the critical sections.
+ *
+ * \param[out] sample is the found sample (time = EPS_HISTORY_NO_SAMPLE if there is none).
+ *
+ * \return The status/error code (-1 if there is no more samples).
+ */
+int eps_history_next(eps_history_sample_t *sample);
+
+/**
+ * \brief Latches a sample found with eps_history_select() or eps_history_next().
+ *
+ * Only copies the sample, so it can be called inside a critical section.
+ *
+ * \param[in] sample is the sample to latch.
+ *
+ * \return None.
+ */
+void eps_history_latch(const eps_history_sample_t *sample);
+
+/**
+ * \brief Reads a field of the latched sample.
+ *
+ * \param[in] field is the field to read.
+ *
+ * \return The field value (two's complement for min/max/avg).
+ */
+uint32_t eps_history_read(eps_history_field_e field);
+
+#endif /* EPS_HISTORY_H_ */
+
+/** \} End of eps_history group */
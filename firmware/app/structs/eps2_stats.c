@@ -0,0 +1,329 @@
+/*
+ * eps2_stats.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief EPS running statistics implementation.
+ *
+ * \version 0.1.3
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup eps_stats
+ * \{
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <drivers/mpy/mpy.h>
+
+#include "eps2_data.h"
+#include "eps2_stats.h"
+
+#define EPS_STATS_PARAM_QTY         (sizeof(eps_stats_ids) / sizeof(eps_stats_ids[0]))
+#define EPS_STATS_NO_SLOT           0xFFU
+
+static const uint8_t eps_stats_ids[] = {STATS_PARAM_ID_LIST};
+
+static eps_stats_acc_t eps_stats[EPS_STATS_PARAM_QTY];
+
+/**
+ * \brief Version of each accumulator, incremented on every commit and latch.
+ */
+static uint16_t eps_stats_version[EPS_STATS_PARAM_QTY];
+
+/**
+ * \brief Latched statistics (returned by eps_stats_read()).
+ */
+static eps_stats_acc_t eps_stats_latched;
+
+/**
+ * \brief ID of the parameter of the latched statistics.
+ */
+static uint8_t eps_stats_latched_id = 0;
+
+/**
+ * \brief Gets the statistics slot of a parameter.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return The slot index or EPS_STATS_NO_SLOT if the parameter has no statistics.
+ */
+static uint8_t eps_stats_slot(uint8_t id);
+
+/**
+ * \brief Converts a parameter value to a 16-bit sample.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] value is the parameter value.
+ *
+ * \return The sample (two's complement for the signed parameters, saturated otherwise).
+ */
+static int32_t eps_stats_sample(uint8_t id, uint32_t value);
+
+/**
+ * \brief Rounds a fixed-point value to the nearest integer.
+ *
+ * \param[in] val is the value with EPS_STATS_MEAN_FRAC_BITS fractional bits.
+ *
+ * \return The rounded value.
+ */
+static int32_t eps_stats_round(int32_t val);
+
+/**
+ * \brief Integer square root.
+ *
+ * \param[in] val is the radicand.
+ *
+ * \return The square root of val, rounded down.
+ */
+static uint32_t eps_stats_isqrt(uint64_t val);
+
+/**
+ * \brief Adds a sample to a copy of an accumulator (min/max and Welford update).
+ *
+ * \param[in,out] acc is the accumulator to update.
+ *
+ * \param[in] x is the sample.
+ *
+ * \return None.
+ */
+static void eps_stats_update(eps_stats_acc_t *acc, int32_t x);
+
+int eps_stats_init(void)
+{
+    taskENTER_CRITICAL();
+
+    memset(eps_stats, 0, sizeof(eps_stats));
+    memset(eps_stats_version, 0, sizeof(eps_stats_version));
+    memset(&eps_stats_latched, 0, sizeof(eps_stats_latched));
+
+    eps_stats_latched_id = 0;
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+void eps_stats_push(uint8_t id, uint32_t value)
+{
+    uint8_t slot = eps_stats_slot(id);
+
+    if (slot == EPS_STATS_NO_SLOT)
+    {
+        return;
+    }
+
+    eps_stats_acc_t *acc = &eps_stats[slot];
+    int32_t x = eps_stats_sample(id, value);
+    bool committed = false;
+
+    do
+    {
+        eps_stats_acc_t upd;
+        uint16_t version = 0;
+
+        /* The update (and its division) is computed on a copy, outside the critical section */
+        taskENTER_CRITICAL();
+
+        upd = *acc;
+        version = eps_stats_version[slot];
+
+        taskEXIT_CRITICAL();
+
+        eps_stats_update(&upd, x);
+
+        /* The copy is committed only if no other push or latch changed the accumulator meanwhile */
+        taskENTER_CRITICAL();
+
+        if (version == eps_stats_version[slot])
+        {
+            *acc = upd;
+            eps_stats_version[slot]++;
+            committed = true;
+        }
+
+        taskEXIT_CRITICAL();
+    } while(!committed);
+}
+
+uint8_t eps_stats_is_tracked(uint8_t id)
+{
+    return (eps_stats_slot(id) == EPS_STATS_NO_SLOT) ? 0U : 1U;
+}
+
+int eps_stats_latch(uint8_t id)
+{
+    uint8_t slot = eps_stats_slot(id);
+
+    taskENTER_CRITICAL();
+
+    eps_stats_latched_id = id;
+
+    if (slot == EPS_STATS_NO_SLOT)
+    {
+        memset(&eps_stats_latched, 0, sizeof(eps_stats_latched));
+    }
+    else
+    {
+        eps_stats_latched = eps_stats[slot];
+
+        memset(&eps_stats[slot], 0, sizeof(eps_stats_acc_t));
+    }
+
+    taskEXIT_CRITICAL();
+
+    return (slot == EPS_STATS_NO_SLOT) ? -1 : 0;
+}
+
+uint32_t eps_stats_read(eps_stats_field_e field)
+{
+    eps_stats_acc_t acc;
+    uint8_t id = 0;
+
+    taskENTER_CRITICAL();
+
+    acc = eps_stats_latched;
+    id = eps_stats_latched_id;
+
+    taskEXIT_CRITICAL();
+
+    if (field == EPS_STATS_FIELD_PARAM_ID)
+    {
+        return id;
+    }
+
+    if (acc.n == 0U)
+    {
+        return 0;
+    }
+
+    switch(field)
+    {
+        case EPS_STATS_FIELD_COUNT:     return acc.n;
+        case EPS_STATS_FIELD_MIN:       return (uint32_t)acc.min;
+        case EPS_STATS_FIELD_MAX:       return (uint32_t)acc.max;
+        case EPS_STATS_FIELD_MEAN:      return (uint32_t)eps_stats_round(acc.mean);
+        case EPS_STATS_FIELD_STDDEV:
+            /* Population variance, the square root halves the fractional bits back to the mean format */
+            return (uint32_t)eps_stats_round((int32_t)eps_stats_isqrt(acc.m2 / acc.n));
+        default:                        return 0;
+    }
+}
+
+static uint8_t eps_stats_slot(uint8_t id)
+{
+    uint8_t i = 0;
+
+    for(i = 0; i < EPS_STATS_PARAM_QTY; i++)
+    {
+        if (eps_stats_ids[i] == id)
+        {
+            return i;
+        }
+    }
+
+    return EPS_STATS_NO_SLOT;
+}
+
+static int32_t eps_stats_sample(uint8_t id, uint32_t value)
+{
+    /* The signed parameters are stored as two's complement in 16-bit fields */
+    if (eps_buffer_is_signed(id))
+    {
+        return (int16_t)value;
+    }
+
+    return (value > 0xFFFFUL) ? 0xFFFFL : (int32_t)value;
+}
+
+static int32_t eps_stats_round(int32_t val)
+{
+    const int32_t half = 1L << (EPS_STATS_MEAN_FRAC_BITS - 1U);
+
+    /* Division instead of a shift, the rounding is symmetric for the negative values */
+    return (val + ((val < 0) ? -half : half)) / (1L << EPS_STATS_MEAN_FRAC_BITS);
+}
+
+static uint32_t eps_stats_isqrt(uint64_t val)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while(bit > val)
+    {
+        bit >>= 2;
+    }
+
+    while(bit != 0U)
+    {
+        if (val >= res + bit)
+        {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+static void eps_stats_update(eps_stats_acc_t *acc, int32_t x)
+{
+    if (acc->n == 0U)
+    {
+        acc->min = x;
+        acc->max = x;
+    }
+    else
+    {
+        acc->min = (x < acc->min) ? x : acc->min;
+        acc->max = (x > acc->max) ? x : acc->max;
+    }
+
+    if (acc->n < UINT32_MAX)
+    {
+        /* Welford: mean += (x - mean)/n, m2 += (x - mean_old)*(x - mean_new) */
+        int32_t x_q = x * (1L << EPS_STATS_MEAN_FRAC_BITS);
+        int32_t delta = x_q - acc->mean;
+
+        acc->n++;
+        acc->mean += delta / (int32_t)acc->n;
+
+        /* Both deltas have the same sign, so the product of the magnitudes is accumulated */
+        int32_t delta_new = x_q - acc->mean;
+        uint64_t m2 = mpy_mac_u32(acc->m2, (delta < 0) ? (0UL - (uint32_t)delta) : (uint32_t)delta, (delta_new < 0) ? (0UL - (uint32_t)delta_new) : (uint32_t)delta_new);
+
+        acc->m2 = (m2 < acc->m2) ? UINT64_MAX : m2;
+    }
+}
+
+/** \} End of eps_stats group */
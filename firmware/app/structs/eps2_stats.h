@@ -0,0 +1,141 @@
+/*
+ * eps2_stats.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief EPS running statistics definition.
+ *
+ * Running statistics of a selected list of parameters (STATS_PARAM_ID_LIST),
+ * fed by the EPS data buffer writes. Each parameter keeps the number of
+ * samples, the minimum, the maximum and a Welford accumulator of the mean and
+ * the variance, in fixed point:
+ *  - The samples are 16-bit values (saturated, or two's complement for the
+ *    signed parameters);
+ *  - The mean has EPS_STATS_MEAN_FRAC_BITS fractional bits;
+ *  - The sum of the squared deviations has twice as many fractional bits,
+ *    and its products are done by the MPY32 hardware multiplier.
+ *
+ * The statistics of a parameter are read by latching them (which restarts
+ * the accumulation), so each readout covers the period since the previous one.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup eps_stats EPS Statistics
+ * \ingroup structs
+ * \{
+ */
+
+#ifndef EPS_STATS_H_
+#define EPS_STATS_H_
+
+#include <stdint.h>
+#include <config/config.h>
+
+#define EPS_STATS_NAME              "EPS2 Stats"
+
+#define EPS_STATS_MEAN_FRAC_BITS    8U          /**< Fractional bits of the running mean. */
+
+/**
+ * \brief Fields of the latched statistics.
+ */
+typedef enum
+{
+    EPS_STATS_FIELD_PARAM_ID = 0,               /**< ID of the latched parameter. */
+    EPS_STATS_FIELD_COUNT,                      /**< Number of samples. */
+    EPS_STATS_FIELD_MIN,                        /**< Minimum value. */
+    EPS_STATS_FIELD_MAX,                        /**< Maximum value. */
+    EPS_STATS_FIELD_MEAN,                       /**< Mean value (rounded). */
+    EPS_STATS_FIELD_STDDEV,                     /**< Standard deviation (rounded). */
+    EPS_STATS_FIELD_QTY                         /**< Number of fields. */
+} eps_stats_field_e;
+
+/**
+ * \brief Running statistics of a single parameter.
+ */
+typedef struct
+{
+    uint64_t m2;                                /**< Sum of the squared deviations from the mean (2*EPS_STATS_MEAN_FRAC_BITS fractional bits). */
+    int32_t mean;                               /**< Running mean (EPS_STATS_MEAN_FRAC_BITS fractional bits). */
+    uint32_t n;                                 /**< Number of samples. */
+    int32_t min;                                /**< Minimum value. */
+    int32_t max;                                /**< Maximum value. */
+} eps_stats_acc_t;
+
+/**
+ * \brief Clears the statistics of all parameters and the latched statistics.
+ *
+ * \return The status/error code.
+ */
+int eps_stats_init(void);
+
+/**
+ * \brief Adds a new sample of a parameter to its statistics.
+ *
+ * Parameters that are not in STATS_PARAM_ID_LIST are ignored. The update is computed
+ * outside the critical section, that is only taken to copy and to commit the accumulator.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] value is the new value of the parameter.
+ *
+ * \return None.
+ */
+void eps_stats_push(uint8_t id, uint32_t value);
+
+/**
+ * \brief Checks if a parameter has statistics.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return 1 if the parameter is in STATS_PARAM_ID_LIST, 0 otherwise.
+ */
+uint8_t eps_stats_is_tracked(uint8_t id);
+
+/**
+ * \brief Latches the statistics of a parameter and restarts them.
+ *
+ * The latched statistics are returned by eps_stats_read() until the next latch.
+ * A parameter without statistics is latched with no samples.
+ *
+ * \note Can be called inside a critical section.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \return The status/error code.
+ */
+int eps_stats_latch(uint8_t id);
+
+/**
+ * \brief Reads a field of the latched statistics.
+ *
+ * The values are in the units of the latched parameter, and are 0 if there are no samples.
+ *
+ * \param[in] field is the field to read (EPS_STATS_FIELD_x).
+ *
+ * \return The value of the field (signed fields as two's complement).
+ */
+uint32_t eps_stats_read(eps_stats_field_e field);
+
+#endif /* EPS_STATS_H_ */
+
+/** \} End of eps_stats group */
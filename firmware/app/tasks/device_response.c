@@ -26,9 +26,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.3
  *
- * \date 26/05/2021
+ * \date 17/10/2026
  *
  * \addtogroup device_response
  * \{
@@ -42,10 +42,8 @@
 #include "device_response.h"
 #include "startup.h"
 
-/* Number of parameters in the list to be sent to TTC */
-#define BEACON_PARAM_LIST_SIZE          30
 /* Size of the buffer: command to write (1B) + packet ID (1B) + callsign (7B) + 4B for each parameters in the list  */
-#define DEVICE_RESPONSE_BUFFER_SIZE     9 + 4 * BEACON_PARAM_LIST_SIZE
+#define DEVICE_RESPONSE_BUFFER_SIZE     (9 + EPS_DATA_BEACON_BYTES)
 
 xTaskHandle xTaskDeviceResponseHandle;
 
@@ -57,12 +55,7 @@ void vTaskDeviceResponse(void *pvParameters)
     /* Delay before the first cycle */
     vTaskDelay(pdMS_TO_TICKS(TASK_DEVICE_RESPONSE_INITIAL_DELAY_MS));
 
-    uint8_t beacon_param_list[] = {
-        BEACON_PARAM_ID_LIST,
-    };
-
     uint8_t buf[DEVICE_RESPONSE_BUFFER_SIZE] = {0};
-    uint32_t val = 0;
     uint32_t beacon_flag = 0;
     
     while(1)
@@ -76,14 +69,9 @@ void vTaskDeviceResponse(void *pvParameters)
         eps_buffer_read(EPS2_PARAM_ID_BEACON_ENABLE, &beacon_flag);
         if(beacon_flag > 0)
         {
-            for(uint8_t i = 0, j = 9; i < BEACON_PARAM_LIST_SIZE; i++, j+=4)
-            {
-                eps_buffer_read(beacon_param_list[i], &val);
-                buf[ j ] = (val >> 24) & 0xFF;
-                buf[j+1] = (val >> 16) & 0xFF;
-                buf[j+2] = (val >> 8)  & 0xFF;
-                buf[j+3] = (val >> 0)  & 0xFF;
-            }
+            /* The data buffer keeps the beacon parameters in the wire format */
+            eps_buffer_read_beacon(&buf[9]);
+
             ttc_answer_long(buf, DEVICE_RESPONSE_BUFFER_SIZE);
         }
         else
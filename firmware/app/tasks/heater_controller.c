@@ -28,14 +28,16 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  *
- * \version 0.2.36
+ * \version 0.2.42
  *
- * \date 2021/08/04
+ * \date 2026/10/17
  *
  * \addtogroup heater_controller
  * \{
  */
 
+#include <stdbool.h>
+
 #include <system/sys_log/sys_log.h>
 #include <structs/eps2_data.h>
 
@@ -74,31 +76,70 @@ xTaskHandle xTaskHeaterControllerHandle;
  */
 void heater_control(int channel, uint32_t mode, uint32_t duty_cycle);
 
+/**
+ * \brief Gets the temperature of a heater channel.
+ *
+ * The filtered value published by the RTD scan of the read sensors task is used, so the control
+ * loop does not access the SPI bus. There is no direct read as a fallback, since the ADS1248 is
+ * kept in continuous conversion mode by the scan: the read fails until the first scan publishes
+ * the temperature of the channel.
+ *
+ * \param[in] channel is the heater channel.
+ *
+ * \param[in,out] temp is the temperature in Kelvin.
+ *
+ * \return The status/error code.
+ */
+static int heater_controller_get_temp(int channel, temperature_t *temp);
+
 void vTaskHeaterController(void)
 {
-    uint32_t heater_mode = 0;
-    uint32_t heater_dt_cycle = 0;
+    static const uint8_t heater_param_ids[] = {
+        EPS2_PARAM_ID_BAT_HEATER_1_MODE, EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE,
+        EPS2_PARAM_ID_BAT_HEATER_2_MODE, EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE,
+    };
+
+    uint32_t heater_params[sizeof(heater_param_ids)] = {0};
+    bool params_changed = true;
 
     /* Wait startup task to finish */
     xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_HEATER_CONTROLLER_INIT_TIMEOUT_MS));
 
+    /* Wake up as soon as a mode or a duty cycle is changed by another task (OBDH/TTC commands) */
+    if (eps_buffer_subscribe(xTaskGetCurrentTaskHandle(), heater_param_ids, sizeof(heater_param_ids), TASK_HEATER_CONTROLLER_NOTIFY_PARAMS) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_HEATER_CONTROLLER_NAME, "Error subscribing to the heater parameters!");
+        sys_log_new_line();
+    }
+
     while(1)
     {
         TickType_t last_cycle = xTaskGetTickCount();
+        TickType_t elapsed = 0;
+        uint32_t notified_value = 0;
 
-        /* Heater 1 */
-        eps_buffer_read(EPS2_PARAM_ID_BAT_HEATER_1_MODE, &heater_mode);
-        eps_buffer_read(EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE, &heater_dt_cycle);
+        /* Modes and duty cycles of both heaters in a single access, only when they have changed */
+        if (params_changed)
+        {
+            eps_buffer_read_many(heater_param_ids, sizeof(heater_param_ids), heater_params);
+
+            params_changed = false;
+        }
 
-        heater_control(HEATER_CONTROL_LOOP_CH_0, heater_mode, heater_dt_cycle);
+        /* Heater 1 */
+        heater_control(HEATER_CONTROL_LOOP_CH_0, heater_params[0], heater_params[1]);
 
         /* Heater 2 */
-        eps_buffer_read(EPS2_PARAM_ID_BAT_HEATER_2_MODE, &heater_mode);
-        eps_buffer_read(EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE, &heater_dt_cycle);
+        heater_control(HEATER_CONTROL_LOOP_CH_1, heater_params[2], heater_params[3]);
 
-        heater_control(HEATER_CONTROL_LOOP_CH_1, heater_mode, heater_dt_cycle);
+        /* Wait for the next cycle, or less if a watched parameter is written */
+        elapsed = xTaskGetTickCount() - last_cycle;
 
-        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_HEATER_CONTROLLER_PERIOD_MS));
+        if (xTaskNotifyWait(0UL, 0xFFFFFFFFUL, &notified_value,
+                            (elapsed < pdMS_TO_TICKS(TASK_HEATER_CONTROLLER_PERIOD_MS)) ? (pdMS_TO_TICKS(TASK_HEATER_CONTROLLER_PERIOD_MS) - elapsed) : 0) == pdPASS)
+        {
+            params_changed = ((notified_value & TASK_HEATER_CONTROLLER_NOTIFY_PARAMS) != 0U);
+        }
     }
 }
 
@@ -126,7 +167,7 @@ void heater_control(int channel, uint32_t mode, uint32_t duty_cycle)
             }
             
 
-            if (heater_on_off_get_sensor(channel, &temp) == 0)
+            if (heater_controller_get_temp(channel, &temp) == 0)
             {
                 if (heater_on_off_set_actuator(channel, heater_on_off_algorithm(channel, temp)) != 0)
                 {
@@ -159,7 +200,7 @@ void heater_control(int channel, uint32_t mode, uint32_t duty_cycle)
                 }
                 last_mode[channel] = HEATER_MANUAL_MODE;
             }
-            if (heater_set_actuator(channel, (float)duty_cycle) != 0)
+            if (heater_set_actuator(channel, (uint8_t)duty_cycle) != 0)
             {
                 sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_HEATER_CONTROLLER_NAME, "Heater channel ");
                 sys_log_print_uint(channel);
@@ -177,4 +218,35 @@ void heater_control(int channel, uint32_t mode, uint32_t duty_cycle)
     }
 }
 
+static int heater_controller_get_temp(int channel, temperature_t *temp)
+{
+    /* The RTD_x_TEMP parameter IDs follow the order of the RTD channels */
+    static const uint8_t heater_temp_ids[] = {
+        EPS2_PARAM_ID_RTD_0_TEMP + HEATER_RTD_CH_0,
+        EPS2_PARAM_ID_RTD_0_TEMP + HEATER_RTD_CH_1,
+    };
+
+    uint32_t val = 0;
+
+    if ((channel < 0) || (channel >= (int)sizeof(heater_temp_ids)))
+    {
+        return -1;
+    }
+
+    /* Not published yet (the first RTD scan is not done) */
+    if (!eps_buffer_is_written(heater_temp_ids[channel]))
+    {
+        return -1;
+    }
+
+    if (eps_buffer_read(heater_temp_ids[channel], &val) != 0)
+    {
+        return -1;
+    }
+
+    *temp = (temperature_t)val;
+
+    return 0;
+}
+
 /** \} End of heater_controller group */
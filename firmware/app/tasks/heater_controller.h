@@ -47,6 +47,7 @@
 #define TASK_HEATER_CONTROLLER_PRIORITY         3               	/**< Priority. */
 #define TASK_HEATER_CONTROLLER_PERIOD_MS        2000UL             	/**< Period in milliseconds. */
 #define TASK_HEATER_CONTROLLER_INIT_TIMEOUT_MS  2000UL            	/**< Wait time to initialize the task in milliseconds. */
+#define TASK_HEATER_CONTROLLER_NOTIFY_PARAMS    (1UL << 0UL)        /**< Notification bit set when a heater mode or duty cycle is written. */
 
 /* Heater modes */
 #define HEATER_AUTOMATIC_MODE                   0
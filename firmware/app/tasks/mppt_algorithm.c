@@ -27,14 +27,16 @@
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  *
- * \version 0.2.19
+ * \version 0.2.21
  *
- * \date 2021/08/02
+ * \date 2026/10/17
  *
  * \addtogroup mppt_algorithm
  * \{
  */
 
+#include <stdbool.h>
+
 #include "mppt_algorithm.h"
 
 #include <devices/mppt/mppt.h>
@@ -45,104 +47,112 @@
 
 xTaskHandle xTaskMPPTAlgorithmHandle;
 
+/**
+ * \brief MPPT channels handled by the task, in the order of the parameters lists below.
+ */
+static const mppt_channel_t mppt_channels[] = {MPPT_CONTROL_LOOP_CH_0, MPPT_CONTROL_LOOP_CH_1, MPPT_CONTROL_LOOP_CH_2};
+
+/**
+ * \brief Mode and duty cycle parameters of each channel (mode, duty cycle, mode, ...).
+ */
+static const uint8_t mppt_param_ids[] = {
+    EPS2_PARAM_ID_MPPT_1_MODE, EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE,
+    EPS2_PARAM_ID_MPPT_2_MODE, EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE,
+    EPS2_PARAM_ID_MPPT_3_MODE, EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE,
+};
+
+#define MPPT_ALGORITHM_CHANNELS     (sizeof(mppt_channels) / sizeof(mppt_channels[0]))
+
 void vTaskMPPTAlgorithm(void *pvParameters)
 {
-    uint32_t mppt_mode       = 0;
-    uint32_t mppt_duty_cycle = 0;
+    uint32_t mppt_params[2 * MPPT_ALGORITHM_CHANNELS] = {0};
+    uint8_t duty_ids[MPPT_ALGORITHM_CHANNELS] = {0};
+    uint32_t duty_values[MPPT_ALGORITHM_CHANNELS] = {0};
+    bool params_changed = true;
 
     /* Wait startup task to finish */
     xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE,
                         pdMS_TO_TICKS(TASK_MPPT_ALGORITHM_INIT_TIMEOUT_MS));
 
+    /* Wake up as soon as a mode or a duty cycle is changed by another task (OBDH/TTC commands) */
+    if (eps_buffer_subscribe(xTaskGetCurrentTaskHandle(), mppt_param_ids, sizeof(mppt_param_ids), TASK_MPPT_ALGORITHM_NOTIFY_PARAMS) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Error subscribing to the MPPT parameters!");
+        sys_log_new_line();
+    }
+
     while (1)
     {
         TickType_t last_cycle = xTaskGetTickCount();
+        TickType_t elapsed = 0;
+        uint32_t notified_value = 0;
+        uint8_t n_duty = 0;
+        uint8_t i = 0;
 
-        eps_buffer_read(EPS2_PARAM_ID_MPPT_1_MODE, &mppt_mode);
-        switch (mppt_mode)
+        /* Modes and duty cycles of all channels in a single access, only when they have changed */
+        if (params_changed)
         {
-            case MPPT_AUTOMATIC_MODE:
-                if (mppt_algorithm(MPPT_CONTROL_LOOP_CH_0) != 0)
-                {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 0 failed!");
-                    sys_log_new_line();
-                }
-                else
-                {
-                    eps_buffer_write(EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE, mppt_get_duty_cycle(MPPT_CONTROL_LOOP_CH_0));
-                }
-                break;
-            case MPPT_MANUAL_MODE:
-                eps_buffer_read(EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE, &mppt_duty_cycle);
-                if (mppt_set_duty_cycle(MPPT_CONTROL_LOOP_CH_0, mppt_duty_cycle) != 0)
-                {
-                    sys_log_print_event_from_module( SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 0 failed to set duty cycle!");
-                    sys_log_new_line();
-                }
-                break;
-            default:
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Invalid mode!");
+            if (eps_buffer_read_many(mppt_param_ids, sizeof(mppt_param_ids), mppt_params) != 0)
+            {
+                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Error reading the MPPT parameters!");
                 sys_log_new_line();
-                break;
+            }
+
+            params_changed = false;
         }
 
-        eps_buffer_read(EPS2_PARAM_ID_MPPT_2_MODE, &mppt_mode);
-        switch (mppt_mode)
+        for(i = 0; i < MPPT_ALGORITHM_CHANNELS; i++)
         {
-            case MPPT_AUTOMATIC_MODE:
-                if (mppt_algorithm(MPPT_CONTROL_LOOP_CH_1) != 0)
-                {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 1 failed!");
-                    sys_log_new_line();                    
-                }
-                else
-                {
-                    eps_buffer_write(EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE, mppt_get_duty_cycle(MPPT_CONTROL_LOOP_CH_1));
-                }
-                break;
-            case MPPT_MANUAL_MODE:
-                eps_buffer_read(EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE, &mppt_duty_cycle);
-                if (mppt_set_duty_cycle(MPPT_CONTROL_LOOP_CH_1, mppt_duty_cycle) != 0)
-                {
-                    sys_log_print_event_from_module( SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 1 failed to set duty cycle!");
+            uint32_t mppt_mode       = mppt_params[2 * i];
+            uint32_t mppt_duty_cycle = mppt_params[(2 * i) + 1];
+
+            switch (mppt_mode)
+            {
+                case MPPT_AUTOMATIC_MODE:
+                    if (mppt_algorithm(mppt_channels[i]) != 0)
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel ");
+                        sys_log_print_uint(i);
+                        sys_log_print_msg(" failed!");
+                        sys_log_new_line();
+                    }
+                    else
+                    {
+                        duty_ids[n_duty] = mppt_param_ids[(2 * i) + 1];
+                        duty_values[n_duty] = mppt_get_duty_cycle(mppt_channels[i]);
+                        n_duty++;
+                    }
+                    break;
+                case MPPT_MANUAL_MODE:
+                    if (mppt_set_duty_cycle(mppt_channels[i], mppt_duty_cycle) != 0)
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel ");
+                        sys_log_print_uint(i);
+                        sys_log_print_msg(" failed to set duty cycle!");
+                        sys_log_new_line();
+                    }
+                    break;
+                default:
+                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Invalid mode!");
                     sys_log_new_line();
-                }
-                break;
-            default:
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Invalid mode!");
-                sys_log_new_line();
-                break;
+                    break;
+            }
         }
 
-        eps_buffer_read(EPS2_PARAM_ID_MPPT_3_MODE, &mppt_mode);
-        switch (mppt_mode)
+        /* New duty cycles of the channels in automatic mode */
+        if (n_duty > 0)
         {
-            case MPPT_AUTOMATIC_MODE:
-                if (mppt_algorithm(MPPT_CONTROL_LOOP_CH_2) != 0)
-                {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 2 failed!");
-                    sys_log_new_line();
-                }
-                else
-                {
-                    eps_buffer_write(EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE, mppt_get_duty_cycle(MPPT_CONTROL_LOOP_CH_2));
-                }
-                break;
-            case MPPT_MANUAL_MODE:
-                eps_buffer_read(EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE, &mppt_duty_cycle);
-                if (mppt_set_duty_cycle(MPPT_CONTROL_LOOP_CH_2, mppt_duty_cycle) != 0)
-                {
-                    sys_log_print_event_from_module( SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "MPPT channel 2 failed to set duty cycle!");
-                    sys_log_new_line();
-                }
-                break;
-            default:
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MPPT_ALGORITHM_NAME, "Invalid mode!");
-                sys_log_new_line();
-                break;
+            eps_buffer_write_many(duty_ids, n_duty, duty_values);
         }
 
-        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_MPPT_ALGORITHM_PERIOD_MS));
+        /* Wait for the next cycle, or less if a watched parameter is written */
+        elapsed = xTaskGetTickCount() - last_cycle;
+
+        if (xTaskNotifyWait(0UL, 0xFFFFFFFFUL, &notified_value,
+                            (elapsed < pdMS_TO_TICKS(TASK_MPPT_ALGORITHM_PERIOD_MS)) ? (pdMS_TO_TICKS(TASK_MPPT_ALGORITHM_PERIOD_MS) - elapsed) : 0) == pdPASS)
+        {
+            params_changed = ((notified_value & TASK_MPPT_ALGORITHM_NOTIFY_PARAMS) != 0U);
+        }
     }
 }
 
@@ -47,6 +47,7 @@
 #define TASK_MPPT_ALGORITHM_PRIORITY             3               	/**< Priority. */
 #define TASK_MPPT_ALGORITHM_PERIOD_MS            100UL             	/**< Period in milliseconds. */
 #define TASK_MPPT_ALGORITHM_INIT_TIMEOUT_MS      2000UL            	/**< Wait time to initialize the task in milliseconds. */
+#define TASK_MPPT_ALGORITHM_NOTIFY_PARAMS        (1UL << 0UL)       /**< Notification bit set when a MPPT mode or duty cycle is written. */
 
 #define MPPT_AUTOMATIC_MODE		0x00
 #define MPPT_MANUAL_MODE 		0x01
@@ -28,9 +28,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.41
+ * \version 0.2.42
  * 
- * \date 2021/07/24
+ * \date 2026/10/17
  * 
  * \addtogroup param_server
  * \{
@@ -46,12 +46,24 @@
 #include <devices/ttc/ttc.h>
 #include <devices/obdh/obdh.h>
 #include <devices/power_conv/power_conv.h>
+#include <devices/sensor_cal/sensor_cal.h>
 
 #include "param_server.h"
 #include "startup.h"
 
 xTaskHandle xTaskParamServerHandle;
 
+/**
+ * \brief Executes a sensors calibration command.
+ *
+ * \param[in] adr is the command parameter ID (EPS2_PARAM_ID_CAL_x).
+ *
+ * \param[in] val is the written value.
+ *
+ * \return The status/error code.
+ */
+static int param_server_write_cal(uint8_t adr, uint32_t val);
+
 void vTaskParamServer(void *pvParameters)
 {
     BaseType_t result;
@@ -94,6 +106,15 @@ void vTaskParamServer(void *pvParameters)
                                         disable_payload_power();
                                     }
                                     break;
+                                case EPS2_PARAM_ID_CAL_GAIN:
+                                case EPS2_PARAM_ID_CAL_OFFSET:
+                                case EPS2_PARAM_ID_CAL_SAVE:
+                                    if (param_server_write_cal(adr, val) != 0)
+                                    {
+                                        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_PARAM_SERVER_NAME, "OBDH calibration command has failed to complete!");
+                                        sys_log_new_line();
+                                    }
+                                    break;
                                 default:
                                     if (eps_buffer_write(adr, &val) != 0)
                                     {
@@ -191,6 +212,46 @@ void vTaskParamServer(void *pvParameters)
     }
 }
 
+static int param_server_write_cal(uint8_t adr, uint32_t val)
+{
+    adc_port_t port = (adc_port_t)(val >> 28);
+    sensor_cal_coef_t coef;
+
+    /* Signed 28-bit coefficient */
+    int32_t value = (int32_t)(val & 0x0FFFFFFFUL);
+
+    if ((value & 0x08000000L) != 0)
+    {
+        value -= 0x10000000L;
+    }
+
+    switch(adr)
+    {
+        case EPS2_PARAM_ID_CAL_GAIN:
+            if (sensor_cal_get(port, &coef) != 0)
+            {
+                return -1;
+            }
+
+            coef.gain = value;
+
+            return sensor_cal_set(port, coef);
+        case EPS2_PARAM_ID_CAL_OFFSET:
+            if (sensor_cal_get(port, &coef) != 0)
+            {
+                return -1;
+            }
+
+            coef.offset = value;
+
+            return sensor_cal_set(port, coef);
+        case EPS2_PARAM_ID_CAL_SAVE:
+            return (val > 0U) ? sensor_cal_save() : sensor_cal_reset();
+        default:
+            return -1;
+    }
+}
+
 void i2c_slave_notify_from_i2c_rx_isr(void)
 {
     /* xHigherPriorityTaskWoken must be initialised to pdFALSE. If calling
@@ -28,9 +28,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.6
+ * \version 0.2.7
  * 
- * \date 2021/07/24
+ * \date 2026/10/17
  * 
  * \defgroup param_server Parameter server
  * \ingroup tasks
@@ -44,7 +44,7 @@
 #include <task.h>
 
 #define TASK_PARAM_SERVER_NAME                      "Param Server"      /**< Task name. */
-#define TASK_PARAM_SERVER_STACK_SIZE                300                 /**< Stack size in bytes. */
+#define TASK_PARAM_SERVER_STACK_SIZE                350                 /**< Stack size in bytes. */
 #define TASK_PARAM_SERVER_PRIORITY                  4                   /**< Task priority. */
 #define TASK_PARAM_SERVER_INIT_TIMEOUT_MS           1000UL              /**< Wait time to initialize the task in milliseconds. */
 #define TASK_PARAM_SERVER_MAX_BLOCK_TIME_MS         60*1000UL           /**< Maximum block time in milliseconds. */
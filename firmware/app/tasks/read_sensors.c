@@ -29,9 +29,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.35
+ * \version 0.3.11
  * 
- * \date 2021/04/23
+ * \date 2026/10/17
  * 
  * \addtogroup read_sensors
  * \{
@@ -39,6 +39,7 @@
 
 #include <system/sys_log/sys_log.h>
 #include <system/system.h>
+#include <system/filter/filter.h>
 
 #include <devices/current_sensor/current_sensor.h>
 #include <devices/voltage_sensor/voltage_sensor.h>
@@ -50,456 +51,623 @@
 #include "read_sensors.h"
 #include "startup.h"
 
-xTaskHandle xTaskReadSensorsHandle;
+xTaskHandle xTaskReadSensorsADCHandle;
+xTaskHandle xTaskReadSensorsSPIHandle;
+xTaskHandle xTaskReadSensorsI2CHandle;
 
-void vTaskReadSensors(void)
+/* Parameters read in the current slot of each worker, published at once at the end of the slot */
+static uint8_t read_sensors_ids[READ_SENSORS_BUS_QTY][TASK_READ_SENSORS_MAX_PARAMS];
+static uint32_t read_sensors_values[READ_SENSORS_BUS_QTY][TASK_READ_SENSORS_MAX_PARAMS];
+static uint8_t read_sensors_count[READ_SENSORS_BUS_QTY] = {0};
+
+/**
+ * \brief Acquisition worker of a bus.
+ *
+ * Reads the due entries of the sensors table that belong to the given bus, and publishes
+ * them at the end of each slot. One worker runs per bus, so a slow bus does not delay the
+ * others.
+ *
+ * \param[in] bus is the bus serviced by the worker (read_sensors_bus_e).
+ *
+ * \return None.
+ */
+static void read_sensors_worker(uint8_t bus);
+
+/**
+ * \brief RTD scan engine (worker of the SPI bus).
+ *
+ * Reads all the RTD entries of the sensors table in a round-robin, with the ADS1248 in
+ * continuous conversion mode, and publishes the filtered temperatures at the end of each
+ * scan. A scan starts every TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS, so the published values
+ * are never older than one scan period.
+ *
+ * \return None.
+ */
+static void read_sensors_rtd_scan(void);
+
+/**
+ * \brief Calibration scheduler of the ADS1248 (runs between two RTD scans).
+ *
+ * A self offset calibration is run every TASK_READ_SENSORS_RTD_CAL_SCANS scans, and saved
+ * in the flash memory to be restored on the next boot. A calibration is also run (but not
+ * saved, to spare the flash memory) when the ADS1248 is not calibrated yet, or when the
+ * board (MCU) temperature moves more than TASK_READ_SENSORS_RTD_CAL_TEMP_K from the one of
+ * the last calibration. After a failed calibration, only the periodic one is retried.
+ *
+ * \param[in] periodic is true if the periodic calibration is due.
+ *
+ * \return The status/error code (-1 if a calibration was run and failed).
+ */
+static int read_sensors_rtd_cal(bool periodic);
+
+/**
+ * \brief Publishes the parameters of the current slot of a worker.
+ *
+ * \param[in] bus is the bus of the worker.
+ *
+ * \return None.
+ */
+static void read_sensors_publish(uint8_t bus);
+
+/**
+ * \brief Adds a parameter to the list of the current slot of a worker.
+ *
+ * \param[in] bus is the bus of the worker.
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in] value is the parameter value.
+ *
+ * \return None.
+ */
+static void read_sensors_stage(uint8_t bus, uint8_t id, uint32_t value);
+
+/**
+ * \brief Initializes the filters of the entries of a bus.
+ *
+ * \param[in] bus is the bus of the worker.
+ *
+ * \return None.
+ */
+static void read_sensors_filters_init(uint8_t bus);
+
+/**
+ * \brief Filters a read value.
+ *
+ * \param[in] entry is the index of the entry in the sensors table.
+ *
+ * \param[in] value is the read value.
+ *
+ * \return The filtered value (or the read value if the parameter is not filtered).
+ */
+static uint32_t read_sensors_filter(uint8_t entry, uint32_t value);
+
+/**
+ * \brief Reads the temperature of the MCU in Kelvin.
+ *
+ * \param[in] arg is not used.
+ *
+ * \param[in,out] value is the read value.
+ *
+ * \return The status/error code.
+ */
+static int read_sensors_mcu_temp(uint8_t arg, uint32_t *value);
+
+/**
+ * \brief Reads a current sensor in mA.
+ *
+ * \param[in] arg is the ADC port of the sensor.
+ *
+ * \param[in,out] value is the read value.
+ *
+ * \return The status/error code.
+ */
+static int read_sensors_current(uint8_t arg, uint32_t *value);
+
+/**
+ * \brief Reads a voltage sensor in mV.
+ *
+ * \param[in] arg is the ADC port of the sensor.
+ *
+ * \param[in,out] value is the read value.
+ *
+ * \return The status/error code.
+ */
+static int read_sensors_voltage(uint8_t arg, uint32_t *value);
+
+/**
+ * \brief Reads a RTD temperature in Kelvin during a scan.
+ *
+ * \param[in] arg is the RTD channel.
+ *
+ * \param[in,out] value is the read value.
+ *
+ * \return The status/error code.
+ */
+static int read_sensors_rtd(uint8_t arg, uint32_t *value);
+
+/**
+ * \brief Reads a battery monitor parameter.
+ *
+ * Also used to refresh the slow-changing parameters on demand, when a stale value is read
+ * (see eps_buffer_set_acquire()).
+ *
+ * \param[in] id is the parameter ID.
+ *
+ * \param[in,out] value is the read value.
+ *
+ * \return The status/error code.
+ */
+static int read_sensors_bm(uint8_t id, uint32_t *value);
+
+/**
+ * \brief Sensors table (read in this order when more than one entry is due in a slot).
+ */
+static const read_sensors_entry_t read_sensors_table[] = {
+    /* Parameter ID                             Bus                         Argument                                        Read function           Period */
+    {EPS2_PARAM_ID_SP_MY_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT,         read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_PX_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_PLUS_X_CURRENT_SENSOR_ADC_PORT,          read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_MX_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_MINUS_X_CURRENT_SENSOR_ADC_PORT,         read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_PZ_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_PLUS_Z_CURRENT_SENSOR_ADC_PORT,          read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_MZ_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_MINUS_Z_CURRENT_SENSOR_ADC_PORT,         read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_PY_CURRENT,               READ_SENSORS_BUS_ADC,       PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT,          read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_MY_PX_VOLTAGE,            READ_SENSORS_BUS_ADC,       PANNELS_MINUS_Y_PLUS_X_VOLTAGE_SENSOR_ADC_PORT, read_sensors_voltage,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE,            READ_SENSORS_BUS_ADC,       PANNELS_MINUS_X_PLUS_Z_VOLTAGE_SENSOR_ADC_PORT, read_sensors_voltage,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE,            READ_SENSORS_BUS_ADC,       PANNELS_MINUS_Z_PLUS_Y_VOLTAGE_SENSOR_ADC_PORT, read_sensors_voltage,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_SP_VOLTAGE_MPPT,             READ_SENSORS_BUS_ADC,       TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT,    read_sensors_voltage,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE,      READ_SENSORS_BUS_ADC,       MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT,         read_sensors_voltage,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_EPS_CURRENT,                 READ_SENSORS_BUS_ADC,       EPS_BEACON_CURRENT_SENSOR_ADC_PORT,             read_sensors_current,   TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_MCU_TEMP,                    READ_SENSORS_BUS_ADC,       TEMP_SENSOR_ADC_PORT,                           read_sensors_mcu_temp,  TASK_READ_SENSORS_MEDIUM_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_VOLTAGE,                 READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_VOLTAGE,                      read_sensors_bm,        TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_CURRENT,                 READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_CURRENT,                      read_sensors_bm,        TASK_READ_SENSORS_FAST_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_MONITOR_TEMP,            READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_MONITOR_TEMP,                 read_sensors_bm,        TASK_READ_SENSORS_MEDIUM_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_AVERAGE_CURRENT,         READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_AVERAGE_CURRENT,              read_sensors_bm,        TASK_READ_SENSORS_MEDIUM_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_ACC_CURRENT,             READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_ACC_CURRENT,                  read_sensors_bm,        TASK_READ_SENSORS_MEDIUM_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_MONITOR_STATUS,          READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_MONITOR_STATUS,               read_sensors_bm,        TASK_READ_SENSORS_SLOW_PERIOD_MS},
+    {EPS2_PARAM_ID_BAT_MONITOR_PROTECT,         READ_SENSORS_BUS_I2C,       EPS2_PARAM_ID_BAT_MONITOR_PROTECT,              read_sensors_bm,        TASK_READ_SENSORS_SLOW_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_0_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_0,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_1_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_1,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_2_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_2,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_3_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_3,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_4_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_4,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_5_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_5,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+    {EPS2_PARAM_ID_RTD_6_TEMP,                  READ_SENSORS_BUS_SPI,       TEMP_SENSOR_RTD_CH_6,                           read_sensors_rtd,       TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS},
+};
+
+#define READ_SENSORS_TABLE_QTY      (sizeof(read_sensors_table) / sizeof(read_sensors_table[0]))
+
+/**
+ * \brief Slot (period) of the worker of each bus in milliseconds.
+ */
+static const uint32_t read_sensors_bus_slot_ms[READ_SENSORS_BUS_QTY] = {
+    [READ_SENSORS_BUS_ADC]      = TASK_READ_SENSORS_ADC_SLOT_MS,
+    [READ_SENSORS_BUS_SPI]      = TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS,
+    [READ_SENSORS_BUS_I2C]      = TASK_READ_SENSORS_I2C_SLOT_MS,
+};
+
+/**
+ * \brief Tick of the next read of each entry of the sensors table (each entry is only accessed by the worker of its bus).
+ */
+static TickType_t read_sensors_next[READ_SENSORS_TABLE_QTY];
+
+#if defined(CONFIG_FILTERS_ENABLED) && (CONFIG_FILTERS_ENABLED == 1)
+/**
+ * \brief Filters table.
+ */
+static const read_sensors_filter_entry_t read_sensors_filter_table[] = {FILTER_PARAM_LIST};
+
+#define READ_SENSORS_FILTER_QTY     (sizeof(read_sensors_filter_table) / sizeof(read_sensors_filter_table[0]))
+#define READ_SENSORS_NO_FILTER      0xFFU
+
+/**
+ * \brief Filter instances (each one is only accessed by the worker of the bus of its parameter).
+ */
+static filter_t read_sensors_filters[READ_SENSORS_FILTER_QTY];
+
+/**
+ * \brief Filter of each entry of the sensors table (index in read_sensors_filter_table or READ_SENSORS_NO_FILTER).
+ */
+static uint8_t read_sensors_filter_slot[READ_SENSORS_TABLE_QTY];
+#endif /* CONFIG_FILTERS_ENABLED */
+
+void vTaskReadSensorsADC(void)
 {
     /* Wait startup task to finish */
     xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_READ_SENSORS_INIT_TIMEOUT_MS));
 
-    while(1)
-    {
-        TickType_t last_cycle = xTaskGetTickCount();
+    read_sensors_worker(READ_SENSORS_BUS_ADC);
+}
 
-        uint16_t buf = 0U;
+void vTaskReadSensorsSPI(void)
+{
+    /* Wait startup task to finish */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_READ_SENSORS_INIT_TIMEOUT_MS));
 
-        /* MCU temperature.*/
-        if (temp_mcu_read_k(&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_MCU_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "MCU temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    read_sensors_rtd_scan();
+}
 
-        /* -Y Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MY_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -Y current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+void vTaskReadSensorsI2C(void)
+{
+    /* Wait startup task to finish */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_READ_SENSORS_INIT_TIMEOUT_MS));
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    /* Battery monitor parameters refreshed on demand */
+    eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RAAC, read_sensors_bm, TASK_READ_SENSORS_BM_MAX_AGE_MS);
+    eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RSAC, read_sensors_bm, TASK_READ_SENSORS_BM_MAX_AGE_MS);
+    eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RARC, read_sensors_bm, TASK_READ_SENSORS_BM_MAX_AGE_MS);
+    eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RSRC, read_sensors_bm, TASK_READ_SENSORS_BM_MAX_AGE_MS);
+    eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER, read_sensors_bm, TASK_READ_SENSORS_BM_MAX_AGE_MS);
 
-        /* +X Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_PLUS_X_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_PX_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP +X current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    read_sensors_worker(READ_SENSORS_BUS_I2C);
+}
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+static void read_sensors_worker(uint8_t bus)
+{
+    TickType_t last_slot = xTaskGetTickCount();
+    uint8_t i = 0;
 
-        /* -X Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_MINUS_X_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
+    for(i = 0; i < READ_SENSORS_TABLE_QTY; i++)
+    {
+        if (read_sensors_table[i].bus == bus)
         {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MX_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -X current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            read_sensors_next[i] = last_slot;
         }
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    read_sensors_filters_init(bus);
 
-        /* +Z Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_PLUS_Z_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_PZ_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP +Z current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    while(1)
+    {
+        TickType_t now = xTaskGetTickCount();
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        read_sensors_count[bus] = 0;
 
-        /* -Z Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_MINUS_Z_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
+        for(i = 0; i < READ_SENSORS_TABLE_QTY; i++)
         {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MZ_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -Z current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+            const read_sensors_entry_t *entry = &read_sensors_table[i];
+            uint32_t value = 0;
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+            /* Entry of another worker */
+            if (entry->bus != bus)
+            {
+                continue;
+            }
 
-        /* +Y Solar Panel current in mA.*/
-        if (current_sensor_read(PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_PY_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP +Y current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+            /* Not due yet (signed difference, the tick counter can wrap around) */
+            if ((int32_t)(now - read_sensors_next[i]) < 0)
+            {
+                continue;
+            }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+            if (entry->read(entry->arg, &value) == 0)
+            {
+                value = read_sensors_filter(i, value);
+
+                read_sensors_stage(bus, entry->id, value);
 
-        /* -Y and +X Solar Panels voltage in mV.*/
-        if (voltage_sensor_read(PANNELS_MINUS_Y_PLUS_X_VOLTAGE_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MY_PX_VOLTAGE, (uint32_t*)&buf);
             #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -Y|+X voltage: ");
-                sys_log_print_uint(buf);
+                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Parameter ");
+                sys_log_print_uint(entry->id);
+                sys_log_print_msg(": ");
+                sys_log_print_uint(value);
                 sys_log_new_line();
-            #endif
-        }
+            #endif /* CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED */
+            }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+            read_sensors_next[i] += pdMS_TO_TICKS(entry->period_ms);
 
-        /* -X and +Z Solar Panels voltage in mV.*/
-        if (voltage_sensor_read(PANNELS_MINUS_X_PLUS_Z_VOLTAGE_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -X|+Z voltage: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            /* Too late (slow bus), restart the period from now instead of reading in bursts */
+            if ((int32_t)(now - read_sensors_next[i]) >= 0)
+            {
+                read_sensors_next[i] = now + pdMS_TO_TICKS(entry->period_ms);
+            }
         }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        read_sensors_publish(bus);
 
-        /* -Z and +Y Solar Panels voltage in mV.*/
-        if (voltage_sensor_read(PANNELS_MINUS_Z_PLUS_Y_VOLTAGE_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP -Z|+Y voltage: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+        vTaskDelayUntil(&last_slot, pdMS_TO_TICKS(read_sensors_bus_slot_ms[bus]));
+    }
+}
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+static void read_sensors_rtd_scan(void)
+{
+    TickType_t last_scan = xTaskGetTickCount();
+    uint8_t scans = 0;
+    uint16_t cal_scans = 0;
+    bool cal_backoff = false;
+    uint8_t i = 0;
 
-        /* Total solar panels output voltage after MPPT in mV.*/
-        if (voltage_sensor_read(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_SP_VOLTAGE_MPPT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "SP total voltage: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    read_sensors_filters_init(READ_SENSORS_BUS_SPI);
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    while(1)
+    {
+        read_sensors_count[READ_SENSORS_BUS_SPI] = 0;
 
-        /* Main power bus voltage in mV.*/
-        if (voltage_sensor_read(MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT, &buf) == 0)
+        /* Registers of the ADS1248 checked with a single read burst from time to time */
+        if (++scans >= TASK_READ_SENSORS_RTD_VERIFY_SCANS)
         {
-            eps_buffer_write(EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Main Bus voltage: ");
-                sys_log_print_uint(buf);
+            scans = 0;
+
+            if (temp_rtd_verify() != 0)
+            {
+                sys_log_print_event_from_module(SYS_LOG_WARNING, TASK_READ_SENSORS_NAME, "The ADS1248 registers were not the expected ones and were written again!");
                 sys_log_new_line();
-            #endif
+            }
         }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        if (++cal_scans >= TASK_READ_SENSORS_RTD_CAL_SCANS)
+        {
+            cal_scans = 0;
 
-        /* EPS and TTC circuitry current in mA.*/
-        if (current_sensor_read(EPS_BEACON_CURRENT_SENSOR_ADC_PORT, &buf) == 0)
+            cal_backoff = (read_sensors_rtd_cal(true) != 0);
+        }
+        else if (!cal_backoff)
         {
-            eps_buffer_write(EPS2_PARAM_ID_EPS_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "EPS/Beacon current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            /* Calibrations on demand are suspended until the next periodic one after a failure */
+            cal_backoff = (read_sensors_rtd_cal(false) != 0);
         }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
-
-        /* RTD 0 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_0, &buf) == 0)
+        if (temp_rtd_scan_start() == 0)
         {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_0_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 0 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+            /* Round-robin over the RTD channels, in the order of the sensors table */
+            for(i = 0; i < READ_SENSORS_TABLE_QTY; i++)
+            {
+                const read_sensors_entry_t *entry = &read_sensors_table[i];
+                uint32_t value = 0;
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+                if (entry->bus != READ_SENSORS_BUS_SPI)
+                {
+                    continue;
+                }
 
-        /* RTD 1 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_1, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_1_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 1 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+                if (entry->read(entry->arg, &value) == 0)
+                {
+                    value = read_sensors_filter(i, value);
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+                    read_sensors_stage(READ_SENSORS_BUS_SPI, entry->id, value);
+                }
+            }
 
-        /* RTD 2 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_2, &buf) == 0)
+            temp_rtd_scan_stop();
+        }
+        else
         {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_2_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 2 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_READ_SENSORS_NAME, "Error starting the RTD scan!");
+            sys_log_new_line();
         }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        read_sensors_publish(READ_SENSORS_BUS_SPI);
 
-        /* RTD 3 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_3, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_3_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 3 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+        vTaskDelayUntil(&last_scan, pdMS_TO_TICKS(read_sensors_bus_slot_ms[READ_SENSORS_BUS_SPI]));
+    }
+}
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+static int read_sensors_rtd_cal(bool periodic)
+{
+    uint32_t board_temp = 0;
+    uint16_t cal_temp = temp_rtd_get_cal_temp();
 
-        /* RTD 4 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_4, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_4_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 4 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    /* Last published MCU temperature (0 until the first read of the ADC worker) */
+    if (eps_buffer_read(EPS2_PARAM_ID_MCU_TEMP, &board_temp) != 0)
+    {
+        board_temp = 0;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    if (!periodic)
+    {
+        uint16_t drift = (board_temp > cal_temp) ? ((uint16_t)board_temp - cal_temp) : (cal_temp - (uint16_t)board_temp);
 
-        /* RTD 5 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_5, &buf) == 0)
+        /* Unknown board temperature, or too close to the one of the last calibration (if any) */
+        if ((board_temp == 0U) || (temp_rtd_is_calibrated() && (drift < TASK_READ_SENSORS_RTD_CAL_TEMP_K)))
         {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_5_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 5 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            return 0;
         }
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    if (temp_rtd_calibrate((uint16_t)board_temp) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_READ_SENSORS_NAME, "Error calibrating the ADS1248!");
+        sys_log_new_line();
 
-        /* RTD 6 temperature. */
-        if (temp_rtd_read_k(TEMP_SENSOR_RTD_CH_6, &buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_RTD_6_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "RTD 6 temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+        return -1;
+    }
+
+    if (periodic && (temp_rtd_cal_save() != 0))
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_READ_SENSORS_NAME, "Error saving the ADS1248 calibration!");
+        sys_log_new_line();
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    return 0;
+}
 
-        /* Battery monitor voltage.*/
-        if (bm_get_voltage(&buf) == 0)
+static void read_sensors_publish(uint8_t bus)
+{
+    if (read_sensors_count[bus] > 0U)
+    {
+        /* Publish the whole slot as a single update of the data buffer */
+        if (eps_buffer_write_many(read_sensors_ids[bus], read_sensors_count[bus], read_sensors_values[bus]) != 0)
         {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_VOLTAGE, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor voltage: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
+            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_READ_SENSORS_NAME, "Error publishing the sensors data!");
+            sys_log_new_line();
         }
+    }
+}
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+static void read_sensors_stage(uint8_t bus, uint8_t id, uint32_t value)
+{
+    if (read_sensors_count[bus] < TASK_READ_SENSORS_MAX_PARAMS)
+    {
+        read_sensors_ids[bus][read_sensors_count[bus]] = id;
+        read_sensors_values[bus][read_sensors_count[bus]] = value;
+        read_sensors_count[bus]++;
+    }
+}
 
-        /* Battery monitor CI temperature.*/
-        if (bm_get_temperature_kelvin(&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_TEMP, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor temp: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+static void read_sensors_filters_init(uint8_t bus)
+{
+#if defined(CONFIG_FILTERS_ENABLED) && (CONFIG_FILTERS_ENABLED == 1)
+    uint8_t i = 0;
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    for(i = 0; i < READ_SENSORS_TABLE_QTY; i++)
+    {
+        uint8_t j = 0;
 
-        /* Battery monitor current.*/
-        if (bm_get_instantaneous_current((int16_t*)&buf) == 0)
+        if (read_sensors_table[i].bus != bus)
         {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor current: ");
-                sys_log_print_int((int16_t)buf);
-                sys_log_new_line();
-            #endif
+            continue;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        read_sensors_filter_slot[i] = READ_SENSORS_NO_FILTER;
 
-        /* Battery monitor average current.*/
-        if (bm_get_average_current((int16_t*)&buf) == 0)
+        for(j = 0; j < READ_SENSORS_FILTER_QTY; j++)
         {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_AVERAGE_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor avg current: ");
-                sys_log_print_int((int16_t)buf);
-                sys_log_new_line();
-            #endif
+            if (read_sensors_filter_table[j].id == read_sensors_table[i].id)
+            {
+                if (filter_init(&read_sensors_filters[j], &read_sensors_filter_table[j].config) == 0)
+                {
+                    read_sensors_filter_slot[i] = j;
+                }
+                else
+                {
+                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_READ_SENSORS_NAME, "Error initializing the filter of the parameter ");
+                    sys_log_print_uint(read_sensors_table[i].id);
+                    sys_log_print_msg("! The raw values will be published.");
+                    sys_log_new_line();
+                }
+
+                break;
+            }
         }
+    }
+#endif /* CONFIG_FILTERS_ENABLED */
+}
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+static uint32_t read_sensors_filter(uint8_t entry, uint32_t value)
+{
+#if defined(CONFIG_FILTERS_ENABLED) && (CONFIG_FILTERS_ENABLED == 1)
+    uint8_t slot = read_sensors_filter_slot[entry];
 
-        /* Battery monitor status register.*/
-        if (bm_get_status_register_data((uint8_t*)&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_STATUS, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor status reg: ");
-                sys_log_print_hex((uint8_t)buf);
-                sys_log_new_line();
-            #endif
-        }
+    if (slot == READ_SENSORS_NO_FILTER)
+    {
+        return value;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+    /* The signed parameters are stored as 16-bit two's complement values */
+    if (eps_buffer_is_signed(read_sensors_filter_table[slot].id))
+    {
+        int32_t y = filter_update(&read_sensors_filters[slot], (int16_t)value);
 
-        /* Battery monitor protection register.*/
-        if (bm_get_protection_register_data((uint8_t*)&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_PROTECT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor protection reg: ");
-                sys_log_print_hex((uint8_t)buf);
-                sys_log_new_line();
-            #endif
-        }
+        /* The EMA and the biquad can overshoot the range of the stored value */
+        y = (y > INT16_MAX) ? INT16_MAX : ((y < INT16_MIN) ? INT16_MIN : y);
 
-        /* Battery monitor accumulated current */
-        if (bm_get_acc_current_mah(&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_ACC_CURRENT, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor acc current: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+        return (uint16_t)(int16_t)y;
+    }
+    else
+    {
+        int32_t y = filter_update(&read_sensors_filters[slot], (value > 0xFFFFUL) ? 0xFFFFL : (int32_t)value);
 
-        vTaskDelay(pdMS_TO_TICKS(50));
+        return (y < 0) ? 0UL : ((y > 0xFFFFL) ? 0xFFFFUL : (uint32_t)y);
+    }
+#else
+    return value;
+#endif /* CONFIG_FILTERS_ENABLED */
+}
 
-        /* Battery monitor RAAC */
-        if (bm_get_raac_mah(&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_RAAC, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor RAAC: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+static int read_sensors_mcu_temp(uint8_t arg, uint32_t *value)
+{
+    uint16_t buf = 0U;
+    int err = temp_mcu_read_k(&buf);
 
-        /* Battery monitor RSAC */
-        vTaskDelay(pdMS_TO_TICKS(50));
+    *value = buf;
 
-        if (bm_get_rsac_mah(&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_RSAC, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor RSAC: ");
-                sys_log_print_uint(buf);
-                sys_log_new_line();
-            #endif
-        }
+    return err;
+}
 
-        /* Battery monitor RARC */
-        vTaskDelay(pdMS_TO_TICKS(50));
+static int read_sensors_current(uint8_t arg, uint32_t *value)
+{
+    uint16_t buf = 0U;
+    int err = current_sensor_read((adc_port_t)arg, &buf);
 
-        if (bm_get_rarc_percent((uint8_t*)&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_RARC, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor RARC: ");
-                sys_log_print_uint((uint8_t)buf);
-                sys_log_new_line();
-            #endif
-        }
+    *value = buf;
 
-        vTaskDelay(pdMS_TO_TICKS(50));
-        /* Battery monitor RSRC */
-        if (bm_get_rsrc_percent((uint8_t*)&buf) == 0)
-        {
-            eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_RSRC, (uint32_t*)&buf);
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor RSRC: ");
-                sys_log_print_uint((uint8_t)buf);
-                sys_log_new_line();
-            #endif
-        }
+    return err;
+}
 
-        // NOTE: The following paramteter from the battery monitor are not stored in the data structure
+static int read_sensors_voltage(uint8_t arg, uint32_t *value)
+{
+    uint16_t buf = 0U;
+    int err = voltage_sensor_read((adc_port_t)arg, &buf);
 
-        /* Battery monitor full capacity in ppm */
-        uint32_t buf32 = 0;
-        if (bm_get_full_capacity_ppm(&buf32) == 0)
-        {
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor Full(T): ");
-                sys_log_print_uint(buf32);
-                sys_log_new_line();
-            #endif
-        }
+    *value = buf;
 
-        /* Battery monitor active empty capacity in ppm */
-        buf32 = 0;
-        if (bm_get_active_empty_capacity_ppm(&buf32) == 0)
-        {
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor AE(T): ");
-                sys_log_print_uint(buf32);
-                sys_log_new_line();
-            #endif
-        }
+    return err;
+}
 
-        /* Battery monitor standby empty capacity in ppm */
-        buf32 = 0;
-        if (bm_get_standby_empty_capacity_ppm(&buf32) == 0)
-        {
-            #if defined (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED) && (CONFIG_TASK_READ_SENSORS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Bat monitor SE(T): ");
-                sys_log_print_uint(buf32);
-                sys_log_new_line();
-            #endif
-        }
+static int read_sensors_rtd(uint8_t arg, uint32_t *value)
+{
+    uint16_t buf = 0U;
+    int err = temp_rtd_scan_read_k(arg, &buf);
 
-        /* Update timestamp */
-        uint32_t timestamp = system_get_time();
-        eps_buffer_write(EPS2_PARAM_ID_TIMESTAMP, &timestamp);
+    *value = buf;
+
+    return err;
+}
 
-        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_READ_SENSORS_PERIOD_MS));
+static int read_sensors_bm(uint8_t id, uint32_t *value)
+{
+    bm_data_t data = {0};
+
+    /* All the parameters read in the same slot share the same snapshot of the battery monitor registers */
+    if (bm_get_data(&data, TASK_READ_SENSORS_BM_SNAPSHOT_AGE_MS) != 0)
+    {
+        return -1;
     }
+
+    switch(id)
+    {
+        case EPS2_PARAM_ID_BAT_VOLTAGE:
+            *value = data.voltage;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
+            *value = data.temperature;
+            break;
+        /* Stored as 16-bit two's complement values */
+        case EPS2_PARAM_ID_BAT_CURRENT:
+            *value = (uint16_t)data.current;
+            break;
+        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
+            *value = (uint16_t)data.average_current;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
+            *value = data.status;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
+            *value = data.protection;
+            break;
+        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
+            *value = data.acc_current;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
+            *value = data.raac;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
+            *value = data.rsac;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
+            *value = data.rarc;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
+            *value = data.rsrc;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
+            *value = data.cycle_counter;
+            break;
+        default:
+            return -1;
+    }
+
+    return 0;
 }
 
 /** \} End of read_sensors group */
@@ -29,9 +29,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.35
+ * \version 0.3.9
  * 
- * \date 2021/04/23
+ * \date 2026/10/17
  * 
  * \defgroup read_sensors Read sensors
  * \ingroup tasks
@@ -44,23 +44,99 @@
 #include <FreeRTOS.h>
 #include <task.h>
 
-#define TASK_READ_SENSORS_NAME                  "Read Sensors"      /**< Task name. */
-#define TASK_READ_SENSORS_STACK_SIZE            512                 /**< Stack size in bytes. */
-#define TASK_READ_SENSORS_PRIORITY              2                   /**< Task priority. */
-#define TASK_READ_SENSORS_PERIOD_MS             (60*1000UL)         /**< Task period in milliseconds. */
+#include <stdint.h>
+
+#include <config/config.h>
+#include <system/filter/filter.h>
+
+#define TASK_READ_SENSORS_NAME                  "Read Sensors"      /**< Module name (log messages). */
+#define TASK_READ_SENSORS_ADC_NAME              "Read Sensors ADC"  /**< ADC worker task name. */
+#define TASK_READ_SENSORS_SPI_NAME              "Read Sensors SPI"  /**< SPI worker task name. */
+#define TASK_READ_SENSORS_I2C_NAME              "Read Sensors I2C"  /**< I2C worker task name. */
+#define TASK_READ_SENSORS_STACK_SIZE            512                 /**< Stack size of each worker in bytes. */
+#define TASK_READ_SENSORS_PRIORITY              2                   /**< Task priority of the workers. */
 #define TASK_READ_SENSORS_INIT_TIMEOUT_MS       2000UL              /**< Wait time to initialize the task in milliseconds. */
+#define TASK_READ_SENSORS_MAX_PARAMS            16                  /**< Maximum number of parameters published per slot by each worker. */
+#define TASK_READ_SENSORS_BM_MAX_AGE_MS         1000UL              /**< Maximum age of the on-demand battery monitor parameters in milliseconds. */
+#define TASK_READ_SENSORS_BM_SNAPSHOT_AGE_MS    (TASK_READ_SENSORS_I2C_SLOT_MS/2UL) /**< Maximum age of a battery monitor snapshot shared by the parameters of a slot in milliseconds. */
+
+#define TASK_READ_SENSORS_ADC_SLOT_MS           100UL               /**< Slot (period) of the ADC worker in milliseconds. */
+#define TASK_READ_SENSORS_I2C_SLOT_MS           100UL               /**< Slot (period) of the I2C worker in milliseconds. */
+#define TASK_READ_SENSORS_FAST_PERIOD_MS        1000UL              /**< Read period of the fast signals (panels, buses, battery voltage and current) in milliseconds. */
+#define TASK_READ_SENSORS_MEDIUM_PERIOD_MS      (10*1000UL)         /**< Read period of the temperatures and battery averages in milliseconds. */
+#define TASK_READ_SENSORS_SLOW_PERIOD_MS        (60*1000UL)         /**< Read period of the battery monitor registers in milliseconds. */
+#define TASK_READ_SENSORS_RTD_SCAN_PERIOD_MS    1000UL              /**< Period of the scan of all RTDs in milliseconds (a scan takes 2 conversions per RTD). */
+#define TASK_READ_SENSORS_RTD_VERIFY_SCANS      60U                 /**< Number of RTD scans between the verifications of the ADS1248 registers. */
+#define TASK_READ_SENSORS_RTD_CAL_SCANS         (6U*3600U)          /**< Number of RTD scans between the periodic ADS1248 calibrations (saved in the flash memory). */
+#define TASK_READ_SENSORS_RTD_CAL_TEMP_K        5U                  /**< Board temperature change since the last ADS1248 calibration that triggers a new one in Kelvin. */
+
+/**
+ * \brief Buses of the sensors.
+ */
+typedef enum
+{
+    READ_SENSORS_BUS_ADC=0,                 /**< Internal ADC. */
+    READ_SENSORS_BUS_SPI,                   /**< SPI (RTDs ADC). */
+    READ_SENSORS_BUS_I2C,                   /**< I2C (battery monitor). */
+    READ_SENSORS_BUS_QTY                    /**< Number of buses. */
+} read_sensors_bus_e;
+
+/**
+ * \brief Entry of the sensors table.
+ */
+typedef struct
+{
+    uint8_t id;                                 /**< Parameter ID. */
+    uint8_t bus;                                /**< Bus of the sensor (read_sensors_bus_e). */
+    uint8_t arg;                                /**< Argument of the read function (ADC port, RTD channel or parameter ID). */
+    int (*read)(uint8_t arg, uint32_t *value);  /**< Read function. */
+    uint32_t period_ms;                         /**< Read period in milliseconds. */
+} read_sensors_entry_t;
+
+/**
+ * \brief Entry of the filters table (FILTER_PARAM_LIST).
+ */
+typedef struct
+{
+    uint8_t id;                                 /**< Parameter ID (its signedness comes from the data buffer, see eps_buffer_is_signed()). */
+    filter_config_t config;                     /**< Filter configuration. */
+} read_sensors_filter_entry_t;
+
+/**
+ * \brief ADC worker handle.
+ */
+extern xTaskHandle xTaskReadSensorsADCHandle;
+
+/**
+ * \brief SPI worker handle.
+ */
+extern xTaskHandle xTaskReadSensorsSPIHandle;
+
+/**
+ * \brief I2C worker handle.
+ */
+extern xTaskHandle xTaskReadSensorsI2CHandle;
 
 /**
- * \brief Read sensors handle.
+ * \brief Read sensors task of the internal ADC (currents, voltages and MCU temperature).
+ *
+ * \return None.
+ */
+void vTaskReadSensorsADC(void);
+
+/**
+ * \brief Read sensors task of the SPI bus (background scan of the RTDs).
+ *
+ * \return None.
  */
-extern xTaskHandle xTaskReadSensorsHandle;
+void vTaskReadSensorsSPI(void);
 
 /**
- * \brief Read onboard sensors task.
+ * \brief Read sensors task of the I2C bus (battery monitor).
  *
  * \return None.
  */
-void vTaskReadSensors(void);
+void vTaskReadSensorsI2C(void);
 
 #endif /* READ_SENSORS_H_ */
 
@@ -28,9 +28,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.25
+ * \version 0.2.29
  * 
- * \date 2021/03/09
+ * \date 2026/10/17
  * 
  * \addtogroup startup
  * \{
@@ -40,6 +40,8 @@
 
 #include <config/config.h>
 #include <app/structs/eps2_data.h>
+#include <app/structs/eps2_history.h>
+#include <app/structs/eps2_stats.h>
 #include <system/system.h>
 #include <system/sys_log/sys_log.h>
 #include <system/clocks.h>
@@ -48,6 +50,7 @@
 #include <devices/battery_monitor/battery_monitor.h>
 #include <devices/current_sensor/current_sensor.h>
 #include <devices/voltage_sensor/voltage_sensor.h>
+#include <devices/sensor_cal/sensor_cal.h>
 #include <devices/temp_sensor/temp_sensor.h>
 #include <devices/media/media.h>
 #include <devices/mppt/mppt.h>
@@ -70,6 +73,19 @@ void vTaskStartup(void *pvParameters)
     /* Logger device initialization */
     sys_log_init();
 
+    /* EPS data buffer initialization */
+    eps_buffer_init();
+
+#if CONFIG_HISTORY_ENABLED == 1
+    /* Telemetry history initialization */
+    eps_history_init();
+#endif /* CONFIG_HISTORY_ENABLED */
+
+#if CONFIG_STATS_ENABLED == 1
+    /* Running statistics initialization */
+    eps_stats_init();
+#endif /* CONFIG_STATS_ENABLED */
+
     /* Print the FreeRTOS version */
     sys_log_print_event_from_module(SYS_LOG_INFO, TASK_STARTUP_NAME, "FreeRTOS ");
     sys_log_print_msg(tskKERNEL_VERSION_NUMBER);
@@ -164,6 +180,14 @@ void vTaskStartup(void *pvParameters)
     }
 #endif /* CONFIG_DEV_VOLTAGE_SENSOR_ENABLED */
 
+#if CONFIG_DEV_SENSOR_CAL_ENABLED == 1
+    /* Sensors calibration initialization (after the ADC and the internal flash memory) */
+    if (sensor_cal_init() != 0)
+    {
+        error_counter++;
+    }
+#endif /* CONFIG_DEV_SENSOR_CAL_ENABLED */
+
 #if CONFIG_DEV_TEMP_SENSOR_ENABLED == 1
     /* Temperature sensor device initialization */
     if (temp_sensor_init() != 0)
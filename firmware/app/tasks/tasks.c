@@ -27,9 +27,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.2.37
+ * \version 0.2.39
  * 
- * \date 2021/04/09
+ * \date 2026/10/17
  * 
  * \addtogroup tasks
  * \{
@@ -93,13 +93,27 @@ void create_tasks(void)
     }
 #endif /* CONFIG_TASK_SYSTEM_RESET_ENABLED */
 
-    /* Read sensors task */
+    /* Read sensors tasks (one worker per bus) */
 #if CONFIG_TASK_READ_SENSORS_ENABLED == 1
-    xTaskCreate(vTaskReadSensors, TASK_READ_SENSORS_NAME, TASK_READ_SENSORS_STACK_SIZE, NULL, TASK_READ_SENSORS_PRIORITY, &xTaskReadSensorsHandle);
+    xTaskCreate(vTaskReadSensorsADC, TASK_READ_SENSORS_ADC_NAME, TASK_READ_SENSORS_STACK_SIZE, NULL, TASK_READ_SENSORS_PRIORITY, &xTaskReadSensorsADCHandle);
 
-    if (xTaskReadSensorsHandle == NULL)
+    if (xTaskReadSensorsADCHandle == NULL)
     {
-        /* Error creating the read sensors task */
+        /* Error creating the ADC read sensors task */
+    }
+
+    xTaskCreate(vTaskReadSensorsSPI, TASK_READ_SENSORS_SPI_NAME, TASK_READ_SENSORS_STACK_SIZE, NULL, TASK_READ_SENSORS_PRIORITY, &xTaskReadSensorsSPIHandle);
+
+    if (xTaskReadSensorsSPIHandle == NULL)
+    {
+        /* Error creating the SPI read sensors task */
+    }
+
+    xTaskCreate(vTaskReadSensorsI2C, TASK_READ_SENSORS_I2C_NAME, TASK_READ_SENSORS_STACK_SIZE, NULL, TASK_READ_SENSORS_PRIORITY, &xTaskReadSensorsI2CHandle);
+
+    if (xTaskReadSensorsI2CHandle == NULL)
+    {
+        /* Error creating the I2C read sensors task */
     }
 #endif /* CONFIG_TASK_READ_SENSORS_ENABLED */
 
@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.10
+ * \version 0.1.12
  * 
- * \date 2020/08/09
+ * \date 2026/10/17
  * 
  * \addtogroup time_control
  * \{
@@ -35,17 +35,18 @@
 
 #include <system/system.h>
 #include <system/sys_log/sys_log.h>
+#include <system/crc8/crc8.h>
 #include <devices/media/media.h>
 #include <config/config.h>
 
+#include <structs/eps2_data.h>
+
 #include "time_control.h"
 #include "startup.h"
 
 #define TIME_CONTROL_MEDIA              MEDIA_INT_FLASH
 #define TIME_CONTROL_SAVE_PERIOD_SEC    60
 #define TIME_CONTROL_MEM_ID             0x12U
-#define TIME_CONTROL_CRC8_INITIAL_VAL   0x00U       /* CRC8-CCITT initial value. */
-#define TIME_CONTROL_CRC8_POLYNOMIAL    0x07U       /* CRC8-CCITT polynomial. */
 
 xTaskHandle xTaskTimeControlHandle;
 
@@ -67,17 +68,6 @@ static int time_control_load_sys_time(sys_time_t *tm);
  */
 static int time_control_save_sys_time(sys_time_t tm);
 
-/**
- * \brief Computes the CRC-8 of a sequence of bytes.
- *
- * \param[in] data is an array of data to compute the CRC-8.
- *
- * \param[in] len is the number of bytes of the given array.
- *
- * \return The computed CRC-8 value of the given data.
- */
-static uint8_t time_control_crc8(uint8_t *data, uint8_t len);
-
 void vTaskTimeControl(void)
 {
     /* Wait startup task to finish */
@@ -109,6 +99,9 @@ void vTaskTimeControl(void)
 
         system_increment_time();
 
+        /* The time control task owns the clock, so it is the only one that publishes the timestamp parameter */
+        eps_buffer_publish_time();
+
         /* Read the current system time */
         sys_time_t sys_tm = system_get_time();
 
@@ -141,7 +134,7 @@ static int time_control_load_sys_time(sys_time_t *tm)
 
     if (media_read(TIME_CONTROL_MEDIA, CONFIG_MEM_ADR_SYS_TIME, buf, 6U) == 0)
     {
-        if ((buf[0] == TIME_CONTROL_MEM_ID) && (time_control_crc8(buf, 5U) == buf[5]))
+        if ((buf[0] == TIME_CONTROL_MEM_ID) && (crc8(buf, 5U) == buf[5]))
         {
             *tm = ((sys_time_t)buf[1] << 24) |
                   ((sys_time_t)buf[2] << 16) |
@@ -176,7 +169,7 @@ static int time_control_save_sys_time(sys_time_t tm)
     buf[2] = ((uint32_t)tm >> 16) & 0xFFU;
     buf[3] = ((uint32_t)tm >> 8) & 0xFFU;
     buf[4] = (uint32_t)tm & 0xFFU;
-    buf[5] = time_control_crc8(buf, 5U);
+    buf[5] = crc8(buf, 5U);
 
     if (media_erase(TIME_CONTROL_MEDIA, FLASH_SEG_A_ADR) == 0)
     {
@@ -192,25 +185,4 @@ static int time_control_save_sys_time(sys_time_t tm)
     return err;
 }
 
-static uint8_t time_control_crc8(uint8_t *data, uint8_t len)
-{
-    uint8_t crc = TIME_CONTROL_CRC8_INITIAL_VAL;
-
-    uint8_t i = 0U;
-    for(i = 0; i < len; i++)
-    {
-        crc ^= data[i];
-
-        uint8_t j = 0U;
-        for (j = 0U; j < 8U; j++)
-        {
-            crc = (crc << 1) ^ ((crc & 0x80U) ? TIME_CONTROL_CRC8_POLYNOMIAL : 0U);
-        }
-
-        crc &= 0xFFU;
-    }
-
-    return crc;
-}
-
 /** \} End of time_control group */
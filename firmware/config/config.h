@@ -28,9 +28,9 @@
  * \author João Cláudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  * 
- * \version 0.4.0
+ * \version 0.4.9
  * 
- * \date 2021/01/25
+ * \date 2026/10/17
  * 
  * \defgroup config Configuration
  * \{
@@ -69,6 +69,7 @@
 #define CONFIG_DEV_MEDIA_ENABLED                        1
 #define CONFIG_DEV_CURRENT_SENSOR_ENABLED               1
 #define CONFIG_DEV_VOLTAGE_SENSOR_ENABLED               1
+#define CONFIG_DEV_SENSOR_CAL_ENABLED                   1
 #define CONFIG_DEV_TEMP_SENSOR_ENABLED                  1
 #define CONFIG_DEV_OBDH_ENABLED                         1
 #define CONFIG_DEV_TTC_ENABLED                          1
@@ -76,8 +77,10 @@
 
 /* Drivers */
 #define CONFIG_DRIVERS_DEBUG_ENABLED                    0
+#define CONFIG_ADC_SCAN_ENABLED                         1           /* Continuous ADC12_A sequence scan with DMA transfer */
 
 /* List of parameter IDs to send as beacon packet. */
+#define BEACON_PARAM_ID_QTY                             30          /* Must match the size of BEACON_PARAM_ID_LIST */
 #define BEACON_PARAM_ID_LIST                            \
         EPS2_PARAM_ID_TIMESTAMP,                        \
         EPS2_PARAM_ID_MCU_TEMP,                         \
@@ -110,14 +113,67 @@
         EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE,          \
         EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE
 
+/* Telemetry history */
+#define CONFIG_HISTORY_ENABLED                          1
+#define CONFIG_HISTORY_RAW_DEPTH                        16          /* Raw samples per parameter */
+#define CONFIG_HISTORY_1MIN_DEPTH                       30          /* 1-minute buckets per parameter (30 min) */
+#define CONFIG_HISTORY_10MIN_DEPTH                      36          /* 10-minute buckets per parameter (6 h) */
+
+/* List of parameter IDs with RAM history. */
+#define HISTORY_PARAM_ID_LIST                           \
+        EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE,           \
+        EPS2_PARAM_ID_SP_VOLTAGE_MPPT,                  \
+        EPS2_PARAM_ID_BAT_VOLTAGE,                      \
+        EPS2_PARAM_ID_BAT_CURRENT,                      \
+        EPS2_PARAM_ID_RTD_0_TEMP,                       \
+        EPS2_PARAM_ID_RTD_2_TEMP
+
+/* Running statistics (min/max/mean/stddev since the last readout) */
+#define CONFIG_STATS_ENABLED                            1
+
+/* List of parameter IDs with running statistics. */
+#define STATS_PARAM_ID_LIST                             \
+        EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE,           \
+        EPS2_PARAM_ID_SP_VOLTAGE_MPPT,                  \
+        EPS2_PARAM_ID_EPS_CURRENT,                      \
+        EPS2_PARAM_ID_BAT_VOLTAGE,                      \
+        EPS2_PARAM_ID_BAT_CURRENT,                      \
+        EPS2_PARAM_ID_RTD_0_TEMP,                       \
+        EPS2_PARAM_ID_RTD_2_TEMP
+
+/* Sensor filters (applied once in the acquisition pipeline, before the values are published) */
+#define CONFIG_FILTERS_ENABLED                          1
+
+/* List of filtered parameters: {parameter ID, filter configuration}. */
+#define FILTER_PARAM_LIST                                                                   \
+        {EPS2_PARAM_ID_SP_MY_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_PY_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_MX_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_PX_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_MZ_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_PZ_CURRENT,           FILTER_EMA(0.25)},                          \
+        {EPS2_PARAM_ID_SP_VOLTAGE_MPPT,         FILTER_EMA(0.5)},                           \
+        {EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE,  FILTER_EMA(0.5)},                           \
+        {EPS2_PARAM_ID_BAT_VOLTAGE,             FILTER_BIQUAD(0.067455273889, 0.134910547778, 0.067455273889, -1.142980502540, 0.412801598096)}, /* Butterworth low-pass, fc = fs/10 */ \
+        {EPS2_PARAM_ID_BAT_CURRENT,             FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_0_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_1_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_2_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_3_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_4_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_5_TEMP,              FILTER_MEDIAN(3)},                          \
+        {EPS2_PARAM_ID_RTD_6_TEMP,              FILTER_MEDIAN(3)}
+
 /* Callsign */
 #define CONFIG_SATELLITE_CALLSIGN                       " PY0EFS"   /* The callsign field must be 7 characters long! */
 
 /* Packets IDs */
 #define CONFIG_PKT_ID_BEACON                            0x00
     
-/* Memory adresses */
-#define CONFIG_MEM_ADR_SYS_TIME                         0
+/* Memory adresses (absolute addresses in the internal flash information memory) */
+#define CONFIG_MEM_ADR_SYS_TIME                         FLASH_SEG_A_ADR     /* Info segment A (erased on each system time saving) */
+#define CONFIG_MEM_ADR_SENSOR_CAL                       FLASH_SEG_B_ADR     /* Info segment B (sensors calibration) */
+#define CONFIG_MEM_ADR_RTD_CAL                          FLASH_SEG_C_ADR     /* Info segment C (ADS1248 calibration) */
 
 #define MAX_BATTERY_CHARGE                              2450    /* [mAh] */
 #define BAT_MONITOR_CHARGE_VALUE                        (uint16_t)(MAX_BATTERY_CHARGE/0.625)    /* 0.625 is a conversion factor for the  battery monitor */
@@ -26,19 +26,24 @@
  * \author Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.3
  *
- * \date 2021/09/18
+ * \date 2026/10/17
  *
  * \addtogroup battery_monitor
  * \{
  */
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
 
 #include "battery_monitor.h"
 
 #include <system/sys_log/sys_log.h>
+#include <system/fixedpt/fixedpt.h>
 
 #include <drivers/ds277Xg/ds277Xg.h>
 #include <drivers/i2c/i2c.h>
@@ -61,6 +66,11 @@ static int bm_get_cell_two_voltage(int16_t *voltage);
 
 ds277Xg_config_t battery_monitor_config = {.port = I2C_PORT_0, .slave_adr = DS2777G_DEFAULT_SLAVE_ADDRESS};
 
+/* Last telemetry snapshot (protected by the DS277XG mutex) */
+static bm_data_t bm_data_cache = {0};
+static TickType_t bm_data_tick = 0;
+static bool bm_data_valid = false;
+
 int battery_monitor_init(void)
 {
     int err = 0;
@@ -78,6 +88,56 @@ int battery_monitor_init(void)
     return err;
 }
 
+int bm_get_data(bm_data_t *data, uint32_t max_age_ms)
+{
+    int err = 0;
+    TickType_t now = 0;
+
+    if (!ds277Xg_mutex_take()) {return -1;}
+
+    now = xTaskGetTickCount();
+
+    if (!bm_data_valid || (max_age_ms == 0UL) || ((TickType_t)(now - bm_data_tick) >= pdMS_TO_TICKS(max_age_ms)))
+    {
+        ds277Xg_snapshot_t snap = {0};
+
+        if (ds277Xg_read_snapshot(&battery_monitor_config, &snap) == 0)
+        {
+            bm_data_cache.voltage           = (uint16_t)(snap.voltage_mv[0] + snap.voltage_mv[1]);
+            bm_data_cache.current           = snap.current_ma;
+            bm_data_cache.average_current   = snap.average_current_ma;
+            bm_data_cache.temperature       = snap.temperature_kelvin;
+            bm_data_cache.acc_current       = snap.acc_current_mah;
+            bm_data_cache.status            = snap.status;
+            bm_data_cache.protection        = snap.protection;
+            bm_data_cache.raac              = (uint16_t)fixedpt_q16_scale((int32_t)snap.raac_raw, FIXEDPT_Q16_CONST(1.6));
+            bm_data_cache.rsac              = (uint16_t)fixedpt_q16_scale((int32_t)snap.rsac_raw, FIXEDPT_Q16_CONST(1.6));
+            bm_data_cache.rarc              = snap.rarc;
+            bm_data_cache.rsrc              = snap.rsrc;
+            bm_data_cache.cycle_counter     = snap.cycle_counter;
+
+            bm_data_tick = now;
+            bm_data_valid = true;
+        }
+        else
+        {
+            /* Forces a new read on the next call */
+            bm_data_valid = false;
+
+            err = -1;
+        }
+    }
+
+    if (err == 0)
+    {
+        *data = bm_data_cache;
+    }
+
+    ds277Xg_mutex_give();
+
+    return err;
+}
+
 int bm_get_cell_one_voltage(int16_t *voltage)
 {
     int err = 0;
@@ -96,45 +156,57 @@ int bm_get_voltage(uint16_t *voltage)
 {
     int err = 0;
     int16_t buf = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (bm_get_cell_one_voltage(&buf) != 0) {err += -1;}
     *voltage = buf;
     if (bm_get_cell_two_voltage(&buf) != 0) {err += -1;}
     *voltage += buf;
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_temperature_kelvin(uint16_t *temp)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_temperature_kelvin(&battery_monitor_config, temp) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_instantaneous_current(int16_t *current)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_current_ma(&battery_monitor_config, current, false) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_average_current(int16_t *current)
 {
     int err = 0; 
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_current_ma(&battery_monitor_config, current, true) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_status_register_data(uint8_t *data)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_STATUS_REGISTER, data, 1) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_protection_register_data(uint8_t *data)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_PROTECTION_REGISTER, data, 1) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
@@ -142,8 +214,10 @@ int bm_get_raac_mah(uint16_t *data)
 {
     int err = 0;
     uint8_t rd_buf[2] = {0};
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_RAAC_REGISTER_MSB, rd_buf, 2) != 0) {err += -1;}
-    *data = (uint16_t)(((rd_buf[0] << 8) + rd_buf[1]) * 1.6);
+    ds277Xg_mutex_give();
+    *data = (uint16_t)fixedpt_q16_scale((int32_t)(((uint16_t)rd_buf[0] << 8) + rd_buf[1]), FIXEDPT_Q16_CONST(1.6));
     return err;
 }
 
@@ -151,29 +225,46 @@ int bm_get_rsac_mah(uint16_t *data)
 {
     int err = 0;
     uint8_t rd_buf[2] = {0};
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_RSAC_REGISTER_MSB, rd_buf, 2) != 0) {err += -1;}
-    *data = (uint16_t)(((rd_buf[0] << 8) + rd_buf[1]) * 1.6);
+    ds277Xg_mutex_give();
+    *data = (uint16_t)fixedpt_q16_scale((int32_t)(((uint16_t)rd_buf[0] << 8) + rd_buf[1]), FIXEDPT_Q16_CONST(1.6));
     return err;
 }
 
 int bm_get_rarc_percent(uint8_t *data)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_RARC_REGISTER, data, 1) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_rsrc_percent(uint8_t *data)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_RSRC_REGISTER, data, 1) != 0) {err += -1;}
+    ds277Xg_mutex_give();
+    return err;
+}
+
+int bm_get_cycle_counter(uint8_t *data)
+{
+    int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
+    if (ds277Xg_read_data(&battery_monitor_config, DS277XG_CYCLE_COUNTER_REGISTER, data, 1) != 0) {err += -1;}
+    ds277Xg_mutex_give();
     return err;
 }
 
 int bm_get_acc_current_mah(uint16_t *data)
 {
     int err = 0;
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_accumulated_current_mah(&battery_monitor_config, data) != 0) { err += -1; }
+    ds277Xg_mutex_give();
     return err;
 }
 
@@ -181,7 +272,9 @@ int bm_get_full_capacity_ppm(uint32_t *data)
 {
     int err = 0;
     uint8_t rd_buf[2] = {0};
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_FULL_REGISTER_MSB, rd_buf, 2) != 0) { err += -1; }
+    ds277Xg_mutex_give();
     *data = (((((uint16_t)rd_buf[0] << 8) + rd_buf[1]) >> 1) * 61UL);
     return err;
 }
@@ -190,7 +283,9 @@ int bm_get_active_empty_capacity_ppm(uint32_t *data)
 {
     int err = 0;
     uint8_t rd_buf[2] = {0};
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_ACTIVE_EMPTY_REGISTER_MSB, rd_buf, 2) != 0) { err += -1; }
+    ds277Xg_mutex_give();
     *data = (((((uint16_t)rd_buf[0] << 8) + rd_buf[1]) >> 3) * 61UL);
     return err;
 }
@@ -199,7 +294,9 @@ int bm_get_standby_empty_capacity_ppm(uint32_t *data)
 {
     int err = 0;
     uint8_t rd_buf[2] = {0};
+    if (!ds277Xg_mutex_take()) {return -1;}
     if (ds277Xg_read_data(&battery_monitor_config, DS277XG_STANDBY_EMPTY_REGISTER_MSB, rd_buf, 2) != 0) { err += -1; }
+    ds277Xg_mutex_give();
     *data = (((((uint16_t)rd_buf[0] << 8) + rd_buf[1]) >> 3) * 61UL);
     return err;
 }
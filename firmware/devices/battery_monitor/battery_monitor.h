@@ -26,9 +26,9 @@
  * \author Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.2
  *
- * \date 2021/09/18
+ * \date 2026/10/17
  *
  * \defgroup battery_monitor Battery Manager
  * \ingroup devices
@@ -46,6 +46,25 @@
 
 extern ds277Xg_config_t battery_monitor_config;
 
+/**
+ * \brief Battery Monitor telemetry (all the values of the same snapshot of the DS277XG registers).
+ */
+typedef struct
+{
+    uint16_t voltage;                   /**< Batteries voltage (sum of the two cells) in mV. */
+    int16_t current;                    /**< Instantaneous current in mA. */
+    int16_t average_current;            /**< Average current in mA. */
+    uint16_t temperature;               /**< Temperature in kelvin. */
+    uint16_t acc_current;               /**< Accumulated current in mAh. */
+    uint8_t status;                     /**< Status register. */
+    uint8_t protection;                 /**< Protection register. */
+    uint16_t raac;                      /**< Remaining Active-Absolute Capacity (RAAC) in mAh. */
+    uint16_t rsac;                      /**< Remaining Standby-Absolute Capacity (RSAC) in mAh. */
+    uint8_t rarc;                       /**< Remaining Active-Relative Capacity (RARC) in %. */
+    uint8_t rsrc;                       /**< Remaining Standby-Relative Capacity (RSRC) in %. */
+    uint8_t cycle_counter;              /**< Cycle counter register. */
+} bm_data_t;
+
 /**
  * \brief Battery Monitor device initialization.
  * 
@@ -53,6 +72,19 @@ extern ds277Xg_config_t battery_monitor_config;
  */
 int battery_monitor_init(void);
 
+/**
+ * \brief Get all the battery monitor telemetry.
+ *
+ * The telemetry registers are read in burst transactions (see ds277Xg_read_snapshot()), and
+ * kept in a cache. The cached values are returned if they are younger than max_age_ms, so the
+ * parameters read in the same slot share the same bus transactions.
+ *
+ * \param[in,out] data Pointer to store the telemetry.
+ * \param[in] max_age_ms Maximum age of the cached values in milliseconds (0 to always read the device).
+ * \return int The status/error code.
+ */
+int bm_get_data(bm_data_t *data, uint32_t max_age_ms);
+
 /**
  * \brief Get the batteries voltage in mV.
  * 
@@ -133,6 +165,14 @@ int bm_get_rarc_percent(uint8_t *data);
  */
 int bm_get_rsrc_percent(uint8_t *data);
 
+/**
+ * \brief Get the battery monitor cycle counter register.
+ *
+ * \param[in,out] data Cycle counter register value.
+ * \return int The status/error code.
+ */
+int bm_get_cycle_counter(uint8_t *data);
+
 /**
  * \brief Get the battery monitor accumulated current in mAh.
  * 
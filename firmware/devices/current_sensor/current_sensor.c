@@ -25,9 +25,9 @@
  * 
  * \authors Gabriel Mariano Marcelino <gabriel.mm8@gmail.com> and Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * 
- * \version 0.2.21
+ * \version 0.2.23
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \addtogroup current_sensor
  * \{
@@ -37,6 +37,7 @@
 #include <drivers/adc/adc.h>
 
 #include <system/sys_log/sys_log.h>
+#include <devices/sensor_cal/sensor_cal.h>
 
 #include "current_sensor.h"
 
@@ -45,14 +46,31 @@ int current_sensor_init()
     sys_log_print_event_from_module(SYS_LOG_INFO, CURRENT_SENSOR_MODULE_NAME, "Initializing Current Sensor device.");
     sys_log_new_line();
     
-    static const max9934_config_t curr_sense_max9934_config = {0};
-
-    int err = max9934_init(curr_sense_max9934_config);
+    /* The solar panel currents are oversampled to reduce the noise seen by the MPPT algorithm */
+    static const max9934_config_t curr_sense_max9934_config[] = {
+        {.adc_port = PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT, .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = PANNEL_PLUS_X_CURRENT_SENSOR_ADC_PORT,  .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = PANNEL_MINUS_X_CURRENT_SENSOR_ADC_PORT, .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = PANNEL_PLUS_Z_CURRENT_SENSOR_ADC_PORT,  .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = PANNEL_MINUS_Z_CURRENT_SENSOR_ADC_PORT, .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT,  .adc_config = {.osr = CURRENT_SENSOR_SP_OSR}},
+        {.adc_port = EPS_BEACON_CURRENT_SENSOR_ADC_PORT,     .adc_config = {.osr = CURRENT_SENSOR_EPS_OSR}},
+    };
+
+    uint8_t i = 0;
+    int err = 0;
 
-    if (err != 0)
+    for(i = 0; i < sizeof(curr_sense_max9934_config) / sizeof(curr_sense_max9934_config[0]); i++)
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, CURRENT_SENSOR_MODULE_NAME, "Error initializing Current Sensor device!");
-        sys_log_new_line();
+        err = max9934_init(curr_sense_max9934_config[i]);
+
+        if (err != 0)
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, CURRENT_SENSOR_MODULE_NAME, "Error initializing Current Sensor device!");
+            sys_log_new_line();
+
+            break;
+        }
     }
 
     return err;
@@ -60,14 +78,7 @@ int current_sensor_init()
 
 uint16_t current_sensor_raw_to_ma(adc_port_t port, uint16_t raw)
 {
-    if(port == EPS_BEACON_CURRENT_SENSOR_ADC_PORT)
-    {
-        return (uint16_t)(1000UL * (uint32_t)raw * (ADC_VREF_MV / (ADC_RANGE * EPS_CURRENT_SENSOR_RL_VALUE_KOHM * EPS_CURRENT_SENSOR_GAIN * EPS_CURRENT_SENSOR_RSENSE_VALUE_MOHM)));
-    }
-    else 
-    {
-        return (uint16_t)(1000UL * (uint32_t)raw * (ADC_VREF_MV / (ADC_RANGE * SP_CURRENT_SENSOR_RL_VALUE_KOHM * SP_CURRENT_SENSOR_GAIN * SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM)));
-    }
+    return sensor_cal_convert(port, raw);
 };
 
 int current_sensor_read(adc_port_t port, uint16_t *cur)
@@ -25,9 +25,9 @@
  * 
  * \authors Gabriel Mariano Marcelino <gabriel.mm8@gmail.com> and Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * 
- * \version 0.2.15
+ * \version 0.2.17
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \defgroup current_sensor Current Sensor
  * \ingroup devices
@@ -51,6 +51,9 @@
 #define PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT 	ADC_PORT_6
 #define EPS_BEACON_CURRENT_SENSOR_ADC_PORT 		ADC_PORT_7
 
+#define CURRENT_SENSOR_SP_OSR                   16U     /**< Oversampling ratio of the solar panel current sensors. */
+#define CURRENT_SENSOR_EPS_OSR                  4U      /**< Oversampling ratio of the EPS/Beacon current sensor. */
+
 #define SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM 	20	 	/**< Solar panel Rsense resistor value in mOhms. */
 #define SP_CURRENT_SENSOR_RL_VALUE_KOHM 		3.3     /**< Solar panel RL resistor value in kOhms. */
 #define SP_CURRENT_SENSOR_GAIN 					25   	/**< Solar panel current gain of max9934 in uA/mV. */
@@ -59,6 +62,10 @@
 #define EPS_CURRENT_SENSOR_RL_VALUE_KOHM 		4.02    /**< Solar panel RL resistor value in kOhms. */
 #define EPS_CURRENT_SENSOR_GAIN 				25   	/**< Solar panel current gain of max9934 in uA/mV. */
 
+/* Nominal current per ADC count in mA (Q16), used to seed the sensors calibration */
+#define SP_CURRENT_SENSOR_GAIN_Q16              ((int32_t)(65536.0 * 1000.0 * ADC_VREF_MV / (ADC_RANGE * SP_CURRENT_SENSOR_RL_VALUE_KOHM * SP_CURRENT_SENSOR_GAIN * SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM) + 0.5))
+#define EPS_CURRENT_SENSOR_GAIN_Q16             ((int32_t)(65536.0 * 1000.0 * ADC_VREF_MV / (ADC_RANGE * EPS_CURRENT_SENSOR_RL_VALUE_KOHM * EPS_CURRENT_SENSOR_GAIN * EPS_CURRENT_SENSOR_RSENSE_VALUE_MOHM) + 0.5))
+
 /**
  * \brief Current sensor device initialization routine.
  *
@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.11
+ * \version 0.1.12
  * 
- * \date 2021/06/09
+ * \date 2026/10/17
  * 
  * \defgroup devices Devices
  * \{
@@ -40,6 +40,7 @@
 #include <devices/watchdog/watchdog.h>
 #include <devices/current_sensor/current_sensor.h>
 #include <devices/voltage_sensor/voltage_sensor.h>
+#include <devices/sensor_cal/sensor_cal.h>
 #include <devices/media/media.h>
 #include <devices/mppt/mppt.h>
 #include <devices/bat_manager/bat_manager.h>
@@ -26,9 +26,9 @@
  * \author Jo�o Cl�udio <joaoclaudiobarcellos@gmail.com>
  * \author Andr� M. P. de Mattos <andre.mattos@spacelab.ufsc.br>
  *
- * \version 0.2.27
+ * \version 0.2.29
  *
- * \date 2021/08/04
+ * \date 2026/10/17
  *
  * \addtogroup heater
  * \{
@@ -47,17 +47,17 @@ int heater_init(heater_channel_t channel)
     sys_log_new_line();   
 
     /* PID controller initialization */
-    pid_controller.tau              = PID_TAU_INIT; 
-    pid_controller.limMin           = PID_LIMIT_MINIMUM_INIT;    
-    pid_controller.limMax           = PID_LIMIT_MAXIMUM_INIT;    
-    pid_controller.limMinInt        = PID_LIMIT_MINIMUM_INTEGRATOR_INIT;        
-    pid_controller.limMaxInt        = PID_LIMIT_MAXIMUM_INTEGRATOR_INIT;        
-    pid_controller.sample_time      = PID_SAMPLE_TIME_INIT;
-    pid_controller.integrator       = PID_INTEGRATOR_INIT;        
-    pid_controller.prevError        = PID_PREVIOUS_ERROR_INIT;        
-    pid_controller.differentiator   = PID_DIFFERENTIATOR_INIT;               
-    pid_controller.prevMeasurement  = PID_PREVIOUS_MEASUREMENT_INIT;              
-    pid_controller.out              = PID_OUTPUT_INIT;
+    pid_controller.tau              = FIXEDPT_Q16_INT(PID_TAU_INIT); 
+    pid_controller.limMin           = FIXEDPT_Q16_INT(PID_LIMIT_MINIMUM_INIT);    
+    pid_controller.limMax           = FIXEDPT_Q16_INT(PID_LIMIT_MAXIMUM_INIT);    
+    pid_controller.limMinInt        = FIXEDPT_Q16_INT(PID_LIMIT_MINIMUM_INTEGRATOR_INIT);        
+    pid_controller.limMaxInt        = FIXEDPT_Q16_INT(PID_LIMIT_MAXIMUM_INTEGRATOR_INIT);        
+    pid_controller.sample_time      = FIXEDPT_Q16_INT(PID_SAMPLE_TIME_INIT);
+    pid_controller.integrator       = FIXEDPT_Q16_INT(PID_INTEGRATOR_INIT);        
+    pid_controller.prevError        = FIXEDPT_Q16_INT(PID_PREVIOUS_ERROR_INIT);        
+    pid_controller.differentiator   = FIXEDPT_Q16_INT(PID_DIFFERENTIATOR_INIT);               
+    pid_controller.prevMeasurement  = FIXEDPT_Q16_INT(PID_PREVIOUS_MEASUREMENT_INIT);              
+    pid_controller.out              = FIXEDPT_Q16_INT(PID_OUTPUT_INIT);
 
     /* Initialize the PWM parameters */
     heater_config.period_us         = HEATER_PERIOD_INIT;
@@ -92,20 +92,22 @@ int heater_init(heater_channel_t channel)
     return 0;
 }
 
-float heater_algorithm(float setpoint, float measurement) 
+q16_t heater_algorithm(q16_t setpoint, q16_t measurement) 
 {
     /* Error signal */
-    float error = setpoint - measurement;
+    q16_t error = fixedpt_q16_sub(setpoint, measurement);
 
     /* Proportional: 
      * p[n]=Kp*e[n] 
      */
-    float proportional = PID_PROPORTIONAL_CONSTANT*error;
+    q16_t proportional = fixedpt_q16_mul(FIXEDPT_Q16_INT(PID_PROPORTIONAL_CONSTANT), error);
 
     /* Integral: 
      * i[n]= ((Ki*T)/2)*(e[n]-e[n-1])+i[n-1] 
      */
-    pid_controller.integrator += 0.5f * PID_INTEGRATOR_CONSTANT * pid_controller.sample_time * (error + pid_controller.prevError);
+    q16_t ki_t = fixedpt_q16_mul(FIXEDPT_Q16_CONST(0.5 * PID_INTEGRATOR_CONSTANT), pid_controller.sample_time);
+
+    pid_controller.integrator = fixedpt_q16_add(pid_controller.integrator, fixedpt_q16_mul(ki_t, fixedpt_q16_add(error, pid_controller.prevError)));
 
     /* Anti-wind-up via integrator clamping */
     if (pid_controller.integrator > pid_controller.limMaxInt) {
@@ -121,15 +123,19 @@ float heater_algorithm(float setpoint, float measurement)
     /* Derivative (band-limited differentiator): 
      * d[n]=(2*Kd*(e[n]-e[n-1])+(2*tau-T)*d[n-1])/(2*tau+T) 
      */
-    pid_controller.differentiator = -(2.0f * PID_DIFFERENTIATOR_CONSTANT * (measurement - pid_controller.prevMeasurement)   /* Note: derivative on measurement, therefore minus sign in front of equation! */
-                        + (2.0f * pid_controller.tau - pid_controller.sample_time) * pid_controller.differentiator)
-                        / (2.0f * pid_controller.tau + pid_controller.sample_time);
+    q16_t two_tau = fixedpt_q16_add(pid_controller.tau, pid_controller.tau);
+
+    q16_t diff_num = fixedpt_q16_add(fixedpt_q16_mul(FIXEDPT_Q16_INT(2 * PID_DIFFERENTIATOR_CONSTANT), fixedpt_q16_sub(measurement, pid_controller.prevMeasurement)),
+                                     fixedpt_q16_mul(fixedpt_q16_sub(two_tau, pid_controller.sample_time), pid_controller.differentiator));
+
+    /* Note: derivative on measurement, therefore minus sign in front of equation! */
+    pid_controller.differentiator = fixedpt_q16_sub(0, fixedpt_q16_div(diff_num, fixedpt_q16_add(two_tau, pid_controller.sample_time)));
 
     /*
      * Compute output and apply limits
      * out[n]=p[n]+i[n]+d[n]
      */
-    pid_controller.out = proportional + pid_controller.integrator + pid_controller.differentiator;
+    pid_controller.out = fixedpt_q16_add(fixedpt_q16_add(proportional, pid_controller.integrator), pid_controller.differentiator);
 
     if (pid_controller.out > pid_controller.limMax) {
 
@@ -154,9 +160,9 @@ int heater_get_sensor(heater_channel_t channel, temperature_t *temp)
     switch(channel) 
     {
         case HEATER_CONTROL_LOOP_CH_0:
-            return temp_rtd_read_k(HEATER_SENSOR_CH_0, (uint16_t *)&temp);
+            return temp_rtd_read_k(HEATER_SENSOR_CH_0, temp);
         case HEATER_CONTROL_LOOP_CH_1:
-            return temp_rtd_read_k(HEATER_SENSOR_CH_1, (uint16_t *)&temp);
+            return temp_rtd_read_k(HEATER_SENSOR_CH_1, temp);
         default:
             sys_log_print_event_from_module(SYS_LOG_ERROR, HEATER_MODULE_NAME, "Invalid sensor channel!");
             sys_log_new_line();
@@ -164,7 +170,7 @@ int heater_get_sensor(heater_channel_t channel, temperature_t *temp)
     }
 }
 
-int heater_set_actuator(heater_channel_t channel, float pid_output) 
+int heater_set_actuator(heater_channel_t channel, uint8_t pid_output) 
 {
     switch(channel) 
     {
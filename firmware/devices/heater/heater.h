@@ -26,9 +26,9 @@
  * \author Jo�o Cl�udio <joaoclaudiobarcellos@gmail.com>
  * \author Andr� M. P. de Mattos <andre.mattos@spacelab.ufsc.br>
  *
- * \version 0.2.11
+ * \version 0.2.12
  *
- * \date 2021/08/04
+ * \date 2026/10/17
  *
  * \defgroup heater Heater
  * \ingroup devices
@@ -43,6 +43,7 @@
 
 #include <devices/temp_sensor/temp_sensor.h>
 #include <drivers/pwm/pwm.h>
+#include <system/fixedpt/fixedpt.h>
 
 #define HEATER_MODULE_NAME        "HEATER"
 
@@ -99,31 +100,31 @@ typedef pwm_config_t heater_config_t;
 typedef uint16_t temperature_t;
 
 /**
- * \brief PID controller variable type.
+ * \brief PID controller variable type (Q16 values).
  */
 typedef struct {
     /* Derivative low-pass filter time constant */
-    float tau;
+    q16_t tau;
 
     /* Output limits */
-    float limMin;
-    float limMax;
+    q16_t limMin;
+    q16_t limMax;
 
     /* Integrator limits */
-    float limMinInt;
-    float limMaxInt;
+    q16_t limMinInt;
+    q16_t limMaxInt;
 
     /* Sample time T (in seconds) */
-    float sample_time;
+    q16_t sample_time;
 
     /* Controller "memory" */
-    float integrator;
-    float prevError;            /* Required for integrator */
-    float differentiator;
-    float prevMeasurement;      /* Required for differentiator */
+    q16_t integrator;
+    q16_t prevError;            /* Required for integrator */
+    q16_t differentiator;
+    q16_t prevMeasurement;      /* Required for differentiator */
 
     /* Controller output */
-    float out;
+    q16_t out;
 
 } pid_controller_t;
 
@@ -139,13 +140,13 @@ int heater_init(heater_channel_t channel);
 /**
  * \brief Function to implement the PID controller algorithm.
  *
- * \param[in] setpoint is the desired temperature value.
+ * \param[in] setpoint is the desired temperature value (Q16).
  *
- * \param[in] measurement is the actual current temperature value.
+ * \param[in] measurement is the actual current temperature value (Q16).
  *
- * \return The control loop output value.
+ * \return The control loop output value (Q16).
  */
-float heater_algorithm(float setpoint, float measurement);
+q16_t heater_algorithm(q16_t setpoint, q16_t measurement);
 
 /**
  * \brief Gets the temperature sensor value in kelvin.
@@ -167,7 +168,7 @@ int heater_get_sensor(heater_channel_t channel, temperature_t *temp);
  *
  * \return The status/error code.
  */
-int heater_set_actuator(heater_channel_t channel, float pid_output);
+int heater_set_actuator(heater_channel_t channel, uint8_t pid_output);
 
 
 #endif /* HEATER_H_ */
@@ -25,9 +25,9 @@
  *
  * \author Jo�o Cl�udio <joaoclaudiobarcellos@gmail.com>
  *
- * \version 0.2.27
+ * \version 0.2.28
  *
- * \date 2021/08/04
+ * \date 2026/10/17
  *
  * \addtogroup heater_on_off
  * \{
@@ -88,7 +88,7 @@ int heater_on_off_init(heater_on_off_channel_t channel)
     return 0;
 }
 
-bool heater_on_off_algorithm(heater_on_off_channel_t channel, float measurement)
+bool heater_on_off_algorithm(heater_on_off_channel_t channel, temperature_t measurement)
 {
     static bool heater1_status = false;
     static bool heater2_status = false;
@@ -25,9 +25,9 @@
  *
  * \author Jo�o Cl�udio <joaoclaudiobarcellos@gmail.com>
  *
- * \version 0.2.11
+ * \version 0.2.12
  *
- * \date 2021/08/04
+ * \date 2026/10/17
  *
  * \defgroup heater Heater
  * \ingroup devices
@@ -112,7 +112,7 @@ int heater_on_off_init(heater_on_off_channel_t channel);
  *
  * \return The control loop output value.
  */
-bool heater_on_off_algorithm(heater_on_off_channel_t channel, float measurement);
+bool heater_on_off_algorithm(heater_on_off_channel_t channel, temperature_t measurement);
 
 /**
  * \brief Gets the temperature sensor value in kelvin.
@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.19
+ * \version 0.1.21
  * 
- * \date 2020/07/21
+ * \date 2026/10/17
  * 
  * \addtogroup media
  * \{
@@ -68,8 +68,8 @@ int media_write(media_t med, uint32_t adr, uint8_t *data, uint16_t len)
     {
         case MEDIA_INT_FLASH:
         {
-            /* Address index */
-            uintptr_t adr_idx = adr + FLASH_SEG_A_ADR;
+            /* Absolute address */
+            uintptr_t adr_idx = adr;
 
             uint16_t i = 0;
             for(i=0; i<len; ++i)
@@ -103,8 +103,8 @@ int media_read(media_t med, uint32_t adr, uint8_t *data, uint16_t len)
     {
         case MEDIA_INT_FLASH:
         {
-            /* Address index */
-            uintptr_t adr_idx = adr + FLASH_SEG_A_ADR;
+            /* Absolute address */
+            uintptr_t adr_idx = adr;
 
             for(i=0; i<len; ++i)
             {
@@ -135,7 +135,7 @@ int media_erase(media_t med, uint32_t sector)
     {
         case MEDIA_INT_FLASH:
         {
-            if ((sector == FLASH_SEG_A_ADR) || (sector == FLASH_SEG_B_ADR))
+            if ((sector == FLASH_SEG_A_ADR) || (sector == FLASH_SEG_B_ADR) || (sector == FLASH_SEG_C_ADR))
             {
                 flash_erase((uintptr_t)sector);
                 err = 0;
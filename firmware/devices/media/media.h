@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.19
+ * \version 0.1.20
  * 
- * \date 2020/04/21
+ * \date 2026/10/17
  * 
  * \defgroup media Media
  * \ingroup devices
@@ -83,7 +83,7 @@ int media_init(media_t med);
  *      .
  * \endparblock
  *
- * \param[in] adr is the address to write data.
+ * \param[in] adr is the address to write data (absolute address in the internal flash, e.g. FLASH_SEG_A_ADR).
  *
  * \param[in] data is an array of bytes to write.
  *
@@ -102,7 +102,7 @@ int media_write(media_t med, uint32_t adr, uint8_t *data, uint16_t len);
  *      .
  * \endparblock
  *
- * \param[in] adr is the address to read.
+ * \param[in] adr is the address to read (absolute address in the internal flash, e.g. FLASH_SEG_A_ADR).
  *
  * \param[in,out] data is a pointer to store the read data.
  *
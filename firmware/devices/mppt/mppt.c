@@ -28,14 +28,15 @@
  * \author André M. P. de Mattos <andre.mattos@spacelab.ufsc.br>
  * \author Ramon de Araujo Borba <ramonborba97@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.1
  *
- * \date 2021/02/10
+ * \date 2026/10/17
  *
  * \addtogroup mppt
  * \{
  */
 #include <system/sys_log/sys_log.h>
+#include <drivers/mpy/mpy.h>
 
 #include "mppt.h"
 
@@ -206,7 +207,10 @@ static int read_ch_power(mppt_paramemters_t *params)
     }
 
     params->pwr_meas.prev_power = params->pwr_meas.power;
-    params->pwr_meas.power = (((uint32_t)current0 + (uint32_t)current1) * (uint32_t)voltage);
+    /* The mA*mV (uW) product can exceed 32 bits (e.g. faulty readings), so it saturates instead of wrapping around */
+    uint64_t power = mpy_mul_u32((uint32_t)current0 + (uint32_t)current1, (uint32_t)voltage);
+
+    params->pwr_meas.power = (power > UINT32_MAX) ? UINT32_MAX : (uint32_t)power;
 
     return err;
 }
@@ -0,0 +1,311 @@
+/*
+ * sensor_cal.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Sensors calibration device implementation.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup sensor_cal
+ * \{
+ */
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <config/config.h>
+#include <system/sys_log/sys_log.h>
+#include <system/crc8/crc8.h>
+#include <drivers/mpy/mpy.h>
+#include <devices/media/media.h>
+#include <devices/current_sensor/current_sensor.h>
+#include <devices/voltage_sensor/voltage_sensor.h>
+
+#include "sensor_cal.h"
+
+#define SENSOR_CAL_MEDIA                MEDIA_INT_FLASH
+
+/**
+ * \brief Nominal coefficients of each ADC port (the ports without a sensor are kept in ADC counts).
+ */
+#define SENSOR_CAL_NOMINAL_COEFS                                                                \
+{                                                                                               \
+    [ADC_PORT_0]                                        = {SENSOR_CAL_ONE, 0},                  \
+    [PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT]            = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [PANNEL_PLUS_X_CURRENT_SENSOR_ADC_PORT]             = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [PANNEL_MINUS_X_CURRENT_SENSOR_ADC_PORT]            = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [PANNEL_PLUS_Z_CURRENT_SENSOR_ADC_PORT]             = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [PANNEL_MINUS_Z_CURRENT_SENSOR_ADC_PORT]            = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT]             = {SP_CURRENT_SENSOR_GAIN_Q16, 0},      \
+    [EPS_BEACON_CURRENT_SENSOR_ADC_PORT]                = {EPS_CURRENT_SENSOR_GAIN_Q16, 0},     \
+    [ADC_PORT_8]                                        = {SENSOR_CAL_ONE, 0},                  \
+    [ADC_PORT_9]                                        = {SENSOR_CAL_ONE, 0},                  \
+    [MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT]            = {VOLTAGE_SENSOR_DIV_1_GAIN_Q16, 0},   \
+    [ADC_PORT_11]                                       = {SENSOR_CAL_ONE, 0},                  \
+    [PANNELS_MINUS_Y_PLUS_X_VOLTAGE_SENSOR_ADC_PORT]    = {VOLTAGE_SENSOR_DIV_2_GAIN_Q16, 0},   \
+    [PANNELS_MINUS_X_PLUS_Z_VOLTAGE_SENSOR_ADC_PORT]    = {VOLTAGE_SENSOR_DIV_2_GAIN_Q16, 0},   \
+    [PANNELS_MINUS_Z_PLUS_Y_VOLTAGE_SENSOR_ADC_PORT]    = {VOLTAGE_SENSOR_DIV_2_GAIN_Q16, 0},   \
+    [TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT]       = {VOLTAGE_SENSOR_DIV_1_GAIN_Q16, 0},   \
+}
+
+/**
+ * \brief Nominal coefficients (from the components values).
+ */
+static const sensor_cal_coef_t sensor_cal_nominal[SENSOR_CAL_PORTS_QTY] = SENSOR_CAL_NOMINAL_COEFS;
+
+/**
+ * \brief Current coefficients (valid even before the initialization).
+ */
+static sensor_cal_coef_t sensor_cal_coefs[SENSOR_CAL_PORTS_QTY] = SENSOR_CAL_NOMINAL_COEFS;
+
+/**
+ * \brief Calibrated ADC ports, in the order of the record in the flash memory.
+ */
+static const adc_port_t sensor_cal_channels[SENSOR_CAL_CHANNELS_QTY] = {
+    PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT,
+    PANNEL_PLUS_X_CURRENT_SENSOR_ADC_PORT,
+    PANNEL_MINUS_X_CURRENT_SENSOR_ADC_PORT,
+    PANNEL_PLUS_Z_CURRENT_SENSOR_ADC_PORT,
+    PANNEL_MINUS_Z_CURRENT_SENSOR_ADC_PORT,
+    PANNEL_PLUS_Y_CURRENT_SENSOR_ADC_PORT,
+    EPS_BEACON_CURRENT_SENSOR_ADC_PORT,
+    MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT,
+    PANNELS_MINUS_Y_PLUS_X_VOLTAGE_SENSOR_ADC_PORT,
+    PANNELS_MINUS_X_PLUS_Z_VOLTAGE_SENSOR_ADC_PORT,
+    PANNELS_MINUS_Z_PLUS_Y_VOLTAGE_SENSOR_ADC_PORT,
+    TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT,
+};
+
+/**
+ * \brief Writes a 32-bit value in big-endian.
+ *
+ * \param[in,out] buf is the destination.
+ *
+ * \param[in] value is the value to write.
+ *
+ * \return None.
+ */
+static void sensor_cal_put_be32(uint8_t *buf, int32_t value);
+
+/**
+ * \brief Reads a 32-bit value in big-endian.
+ *
+ * \param[in] buf is the source.
+ *
+ * \return The read value.
+ */
+static int32_t sensor_cal_get_be32(const uint8_t *buf);
+
+int sensor_cal_init(void)
+{
+    sys_log_print_event_from_module(SYS_LOG_INFO, SENSOR_CAL_MODULE_NAME, "Initializing the sensors calibration...");
+    sys_log_new_line();
+
+    int err = sensor_cal_reset();
+
+    if (sensor_cal_load() == 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, SENSOR_CAL_MODULE_NAME, "Using the calibration stored in the flash memory.");
+        sys_log_new_line();
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_WARNING, SENSOR_CAL_MODULE_NAME, "No stored calibration, using the TLV seeded coefficients.");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+uint16_t sensor_cal_convert(adc_port_t port, uint16_t raw)
+{
+    if ((uint8_t)port >= SENSOR_CAL_PORTS_QTY)
+    {
+        return raw;
+    }
+
+    taskENTER_CRITICAL();
+
+    sensor_cal_coef_t coef = sensor_cal_coefs[port];
+
+    taskEXIT_CRITICAL();
+
+    int64_t value = mpy_mul_s32((int32_t)raw, coef.gain) + (int64_t)coef.offset + (SENSOR_CAL_ONE / 2);
+
+    if (value <= 0)
+    {
+        return 0U;
+    }
+
+    value >>= SENSOR_CAL_Q;
+
+    return (value > (int64_t)UINT16_MAX) ? UINT16_MAX : (uint16_t)value;
+}
+
+int sensor_cal_get(adc_port_t port, sensor_cal_coef_t *coef)
+{
+    if ((uint8_t)port >= SENSOR_CAL_PORTS_QTY)
+    {
+        return -1;
+    }
+
+    taskENTER_CRITICAL();
+
+    *coef = sensor_cal_coefs[port];
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+int sensor_cal_set(adc_port_t port, sensor_cal_coef_t coef)
+{
+    if ((uint8_t)port >= SENSOR_CAL_PORTS_QTY)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, SENSOR_CAL_MODULE_NAME, "Invalid ADC port to calibrate!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    taskENTER_CRITICAL();
+
+    sensor_cal_coefs[port] = coef;
+
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+int sensor_cal_reset(void)
+{
+    uint16_t tlv_gain = 0U;
+    int16_t tlv_offset = 0;
+    int err = 0;
+    uint8_t i = 0U;
+
+    if (adc_get_tlv_cal(&tlv_gain, &tlv_offset) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, SENSOR_CAL_MODULE_NAME, "ADC TLV calibration not available, using the nominal coefficients!");
+        sys_log_new_line();
+
+        /* Unity TLV correction */
+        tlv_gain = 32768U;
+        tlv_offset = 0;
+
+        err = -1;
+    }
+
+    for(i = 0U; i < SENSOR_CAL_PORTS_QTY; i++)
+    {
+        sensor_cal_coef_t coef;
+
+        /* value = nominal * ((raw * tlv_gain) / 2^15 + tlv_offset) */
+        coef.gain = (int32_t)((mpy_mul_s32(sensor_cal_nominal[i].gain, (int32_t)tlv_gain) + (1L << 14)) >> 15);
+        coef.offset = (int32_t)mpy_mul_s32(sensor_cal_nominal[i].gain, (int32_t)tlv_offset) + sensor_cal_nominal[i].offset;
+
+        (void)sensor_cal_set((adc_port_t)i, coef);
+    }
+
+    return err;
+}
+
+int sensor_cal_load(void)
+{
+    uint8_t buf[SENSOR_CAL_MEM_SIZE] = {0U};
+    uint8_t i = 0U;
+
+    if (media_read(SENSOR_CAL_MEDIA, CONFIG_MEM_ADR_SENSOR_CAL, buf, SENSOR_CAL_MEM_SIZE) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, SENSOR_CAL_MODULE_NAME, "Error reading the calibration from the non-volatile memory!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    if ((buf[0] != SENSOR_CAL_MEM_ID) || (crc8(buf, SENSOR_CAL_MEM_SIZE - 1U) != buf[SENSOR_CAL_MEM_SIZE - 1U]))
+    {
+        return -1;
+    }
+
+    for(i = 0U; i < SENSOR_CAL_CHANNELS_QTY; i++)
+    {
+        sensor_cal_coef_t coef;
+
+        coef.gain   = sensor_cal_get_be32(&buf[1U + (8U * i)]);
+        coef.offset = sensor_cal_get_be32(&buf[1U + (8U * i) + 4U]);
+
+        (void)sensor_cal_set(sensor_cal_channels[i], coef);
+    }
+
+    return 0;
+}
+
+int sensor_cal_save(void)
+{
+    uint8_t buf[SENSOR_CAL_MEM_SIZE] = {0U};
+    uint8_t i = 0U;
+
+    buf[0] = SENSOR_CAL_MEM_ID;
+
+    for(i = 0U; i < SENSOR_CAL_CHANNELS_QTY; i++)
+    {
+        sensor_cal_coef_t coef;
+
+        (void)sensor_cal_get(sensor_cal_channels[i], &coef);
+
+        sensor_cal_put_be32(&buf[1U + (8U * i)], coef.gain);
+        sensor_cal_put_be32(&buf[1U + (8U * i) + 4U], coef.offset);
+    }
+
+    buf[SENSOR_CAL_MEM_SIZE - 1U] = crc8(buf, SENSOR_CAL_MEM_SIZE - 1U);
+
+    if ((media_erase(SENSOR_CAL_MEDIA, FLASH_SEG_B_ADR) != 0) || (media_write(SENSOR_CAL_MEDIA, CONFIG_MEM_ADR_SENSOR_CAL, buf, SENSOR_CAL_MEM_SIZE) != 0))
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, SENSOR_CAL_MODULE_NAME, "Error writing the calibration to the non-volatile memory!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    return 0;
+}
+
+static void sensor_cal_put_be32(uint8_t *buf, int32_t value)
+{
+    buf[0] = ((uint32_t)value >> 24) & 0xFFU;
+    buf[1] = ((uint32_t)value >> 16) & 0xFFU;
+    buf[2] = ((uint32_t)value >> 8) & 0xFFU;
+    buf[3] = (uint32_t)value & 0xFFU;
+}
+
+static int32_t sensor_cal_get_be32(const uint8_t *buf)
+{
+    return (int32_t)(((uint32_t)buf[0] << 24) |
+                     ((uint32_t)buf[1] << 16) |
+                     ((uint32_t)buf[2] << 8) |
+                     (uint32_t)buf[3]);
+}
+
+/** \} End of sensor_cal group */
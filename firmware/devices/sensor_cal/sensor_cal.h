@@ -0,0 +1,142 @@
+/*
+ * sensor_cal.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Sensors calibration device definition.
+ *
+ * Each ADC port has a gain and an offset in Q16 format, that convert the raw
+ * counts to the engineering unit of the sensor (mV or mA) with a single
+ * multiply-shift:
+ *
+ *      value = (raw * gain + offset) >> 16
+ *
+ * The coefficients are seeded from the nominal components values corrected
+ * by the TLV calibration of the ADC12_A, and can be replaced by the
+ * coefficients stored in the internal flash memory.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup sensor_cal Sensors Calibration
+ * \ingroup devices
+ * \{
+ */
+
+#ifndef SENSOR_CAL_H_
+#define SENSOR_CAL_H_
+
+#include <stdint.h>
+
+#include <drivers/adc/adc.h>
+
+#define SENSOR_CAL_MODULE_NAME          "Sensor Calibration"
+
+#define SENSOR_CAL_Q                    16                              /**< Number of fractional bits of the coefficients. */
+#define SENSOR_CAL_ONE                  (1L << SENSOR_CAL_Q)            /**< Unity gain in Q16. */
+#define SENSOR_CAL_PORTS_QTY            16U                             /**< Number of ADC ports. */
+#define SENSOR_CAL_CHANNELS_QTY         12U                             /**< Number of calibrated ADC ports (stored in the flash memory). */
+#define SENSOR_CAL_MEM_ID               0xCAU                           /**< ID of the calibration record in the flash memory. */
+#define SENSOR_CAL_MEM_SIZE             (1U + 8U * SENSOR_CAL_CHANNELS_QTY + 1U)    /**< Size of the calibration record (ID, coefficients and CRC-8). */
+
+/**
+ * \brief Calibration coefficients of an ADC port.
+ */
+typedef struct
+{
+    int32_t gain;                           /**< Engineering units per ADC count in Q16. */
+    int32_t offset;                         /**< Offset in engineering units in Q16. */
+} sensor_cal_coef_t;
+
+/**
+ * \brief Sensors calibration initialization.
+ *
+ * Seeds the coefficients from the nominal values and the TLV calibration of
+ * the ADC, and replaces them by the coefficients stored in the flash memory
+ * (if there is a valid record).
+ *
+ * \note Must be called after the ADC initialization.
+ *
+ * \return The status/error code.
+ */
+int sensor_cal_init(void);
+
+/**
+ * \brief Converts a raw ADC value to the engineering unit of the sensor.
+ *
+ * \param[in] port is the ADC port of the value.
+ *
+ * \param[in] raw is the raw value.
+ *
+ * \return The converted value (saturated to the uint16_t range).
+ */
+uint16_t sensor_cal_convert(adc_port_t port, uint16_t raw);
+
+/**
+ * \brief Gets the calibration coefficients of an ADC port.
+ *
+ * \param[in] port is the ADC port.
+ *
+ * \param[in,out] coef is a pointer to store the coefficients.
+ *
+ * \return The status/error code.
+ */
+int sensor_cal_get(adc_port_t port, sensor_cal_coef_t *coef);
+
+/**
+ * \brief Sets the calibration coefficients of an ADC port.
+ *
+ * The new coefficients are used immediately, but only kept after a reset if
+ * they are saved with sensor_cal_save().
+ *
+ * \param[in] port is the ADC port.
+ *
+ * \param[in] coef is the new coefficients.
+ *
+ * \return The status/error code.
+ */
+int sensor_cal_set(adc_port_t port, sensor_cal_coef_t coef);
+
+/**
+ * \brief Restores the seeded coefficients (nominal values corrected by the TLV calibration).
+ *
+ * \return The status/error code.
+ */
+int sensor_cal_reset(void);
+
+/**
+ * \brief Loads the coefficients from the flash memory.
+ *
+ * \return The status/error code (-1 if there is no valid record).
+ */
+int sensor_cal_load(void);
+
+/**
+ * \brief Saves the current coefficients into the flash memory.
+ *
+ * \return The status/error code.
+ */
+int sensor_cal_save(void);
+
+#endif /* SENSOR_CAL_H_ */
+
+/** \} End of sensor_cal group */
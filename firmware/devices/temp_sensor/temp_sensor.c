@@ -25,22 +25,59 @@
  * 
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * 
- * \version 0.2.33
+ * \version 0.2.42
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \addtogroup temp_sensor
  * \{
  */
 
+#include <config/config.h>
 #include <system/sys_log/sys_log.h>
+#include <system/crc8/crc8.h>
 
 #include <drivers/adc/adc.h>
+#include <devices/media/media.h>
 
 #include "temp_sensor.h"
 
+#define TEMP_SENSOR_CAL_MEDIA       MEDIA_INT_FLASH
+
 temp_sensor_t config;
 
+/**
+ * \brief Board temperature of the current ADS1248 calibration in Kelvin.
+ */
+static uint16_t temp_rtd_cal_temp = 0;
+
+/**
+ * \brief True after a successful calibration of the ADS1248 (run or restored from the flash memory).
+ */
+static bool temp_rtd_cal_valid = false;
+
+#define TEMP_SENSOR_RTD_LUT_RAW(T)  (TEMP_SENSOR_CVD_R(T) / TEMP_SENSOR_RTD_OHM_PER_LSB / (double)(1UL << (16U - TEMP_SENSOR_RTD_LUT_SHIFT)))
+#define TEMP_SENSOR_RTD_LUT_X(T)    FIXEDPT_Q16_CONST(TEMP_SENSOR_RTD_LUT_RAW(T)),
+#define TEMP_SENSOR_RTD_LUT_Y(T)    FIXEDPT_Q16_CONST(((T) + 273.15) * 10.0),
+#define TEMP_SENSOR_RTD_LUT_S(T)    FIXEDPT_Q16_CONST(100.0 / (TEMP_SENSOR_RTD_LUT_RAW((T) + 10) - TEMP_SENSOR_RTD_LUT_RAW(T))),
+
+/**
+ * \brief Raw value (scaled by TEMP_SENSOR_RTD_LUT_SHIFT) of each point of the RTD lookup table.
+ */
+static const q16_t temp_rtd_lut_raw[] = {TEMP_SENSOR_RTD_LUT_POINTS(TEMP_SENSOR_RTD_LUT_X)};
+
+/**
+ * \brief Temperature in 0.1 K of each point of the RTD lookup table.
+ */
+static const q16_t temp_rtd_lut_dk[] = {TEMP_SENSOR_RTD_LUT_POINTS(TEMP_SENSOR_RTD_LUT_Y)};
+
+/**
+ * \brief Slope of the segment starting at each point of the RTD lookup table (no division at run time).
+ */
+static const q16_t temp_rtd_lut_slope[] = {TEMP_SENSOR_RTD_LUT_POINTS(TEMP_SENSOR_RTD_LUT_S)};
+
+#define TEMP_SENSOR_RTD_LUT_LEN     (sizeof(temp_rtd_lut_raw) / sizeof(temp_rtd_lut_raw[0]))
+
 int temp_sensor_init(void)
 {
     sys_log_print_event_from_module(SYS_LOG_INFO, TEMP_SENSOR_MODULE_NAME, "Initializing internal MCU temperature sensor.");
@@ -79,6 +116,8 @@ int temp_sensor_init(void)
 	config.start_pin = TEMP_SENSOR_START_PIN;
 	config.spi_cs = TEMP_SENSOR_SPI_CS;
 	config.reset_pin = TEMP_SENSOR_RESET_PIN;
+	config.drdy_pin = TEMP_SENSOR_DRDY_PIN;
+	config.data_rate = TEMP_SENSOR_DATA_RATE;
 	
    if(ads1248_init(&config) != 0)
    {
@@ -88,6 +127,26 @@ int temp_sensor_init(void)
 		return -1;
    }
 
+    /* A stored calibration is restored instead of calibrating again (the first reads are accurate without extra conversions) */
+    if (temp_rtd_cal_load() == 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TEMP_SENSOR_MODULE_NAME, "Using the ADS1248 calibration stored in the flash memory.");
+        sys_log_new_line();
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_WARNING, TEMP_SENSOR_MODULE_NAME, "No stored ADS1248 calibration, running a self offset calibration...");
+        sys_log_new_line();
+
+        if ((temp_rtd_calibrate((uint16_t)(temp + 273)) != 0) || (temp_rtd_cal_save() != 0))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, TEMP_SENSOR_MODULE_NAME, "Error calibrating the ADS1248 device!");
+            sys_log_new_line();
+
+            return -1;
+        }
+    }
+
 /** TO DO: implement log for rtd measurements during initialization */
 
 	return 0;
@@ -122,14 +181,14 @@ int temp_mcu_read_raw(uint16_t *val)
 
 int16_t temp_mcu_raw_to_c(uint16_t raw)
 {
-    float buf = (raw - adc_temp_get_nref())/adc_temp_get_mref();
+    q16_t buf = fixedpt_q16_div(fixedpt_q16_sub(FIXEDPT_Q16_INT(raw), adc_temp_get_nref()), adc_temp_get_mref());
 
-    if (buf < (-273))
+    if (buf < FIXEDPT_Q16_INT(-273))
     {
-        buf = (-273);
+        buf = FIXEDPT_Q16_INT(-273);
     }
 
-    return (int16_t)buf;
+    return (int16_t)fixedpt_q16_to_int(buf);
 }
 
 
@@ -188,26 +247,62 @@ int temp_rtd_read_raw(uint8_t positive_channel, uint32_t *val)
     return 0;
 }
 
-int16_t temp_rtd_raw_to_c(uint32_t raw)
+uint16_t temp_rtd_raw_to_dk(uint32_t raw)
 {
-    float buf = TEMP_SENSOR_CONV(raw);
+    /* Sign extension of the bipolar 24-bit code, so the negative codes clamp to the bottom of the table */
+    int32_t code = (int32_t)((raw & 0x00FFFFFFUL) ^ 0x00800000UL) - 0x00800000L;
+
+    /* raw/1024 in Q16 (exact for the 24-bit conversions) */
+    q16_t x = (q16_t)(code * (1L << TEMP_SENSOR_RTD_LUT_SHIFT));
+    q16_t dk = 0;
+    uint8_t lo = 0;
+    uint8_t hi = TEMP_SENSOR_RTD_LUT_LEN - 1U;
 
-    if (buf < (-273))
+    if (x <= temp_rtd_lut_raw[lo])
     {
-        buf = (-273);
+        dk = temp_rtd_lut_dk[lo];
+    }
+    else if (x >= temp_rtd_lut_raw[hi])
+    {
+        dk = temp_rtd_lut_dk[hi];
+    }
+    else
+    {
+        /* Binary search of the segment temp_rtd_lut_raw[lo] <= x < temp_rtd_lut_raw[hi] */
+        while((hi - lo) > 1U)
+        {
+            uint8_t mid = lo + ((hi - lo) / 2U);
+
+            if (x < temp_rtd_lut_raw[mid])
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid;
+            }
+        }
+
+        dk = fixedpt_q16_add(temp_rtd_lut_dk[lo], fixedpt_q16_mul(temp_rtd_lut_slope[lo], fixedpt_q16_sub(x, temp_rtd_lut_raw[lo])));
     }
 
-    return (int16_t)buf;
+    return (uint16_t)((dk + (FIXEDPT_Q16_ONE / 2)) >> 16);
 }
 
-uint16_t temp_rtd_raw_to_k(uint32_t raw)
+int16_t temp_rtd_raw_to_c(uint32_t raw)
 {
-    int16_t temp_c = temp_rtd_raw_to_c(raw);
+    /* 20 times the temperature in Celsius, rounded half away from zero */
+    int32_t c20 = (2L * (int32_t)temp_rtd_raw_to_dk(raw)) - 5463L;
 
-    return (uint16_t)(temp_c + 273);
+    return (int16_t)(((c20 >= 0) ? (c20 + 10L) : (c20 - 10L)) / 20L);
 }
 
-int temp_rtd_read_c(uint8_t channel, uint16_t *temp)
+uint16_t temp_rtd_raw_to_k(uint32_t raw)
+{
+    return (temp_rtd_raw_to_dk(raw) + 5U) / 10U;
+}
+
+int temp_rtd_read_c(uint8_t channel, int16_t *temp)
 {
     uint32_t raw_temp = 0;
 
@@ -241,5 +336,169 @@ int temp_rtd_read_k(uint8_t channel, uint16_t *temp)
     return 0;
 }
 
+int temp_rtd_read_dk(uint8_t channel, uint16_t *temp)
+{
+    uint32_t raw_temp = 0;
+
+    if (temp_rtd_read_raw(channel, &raw_temp) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TEMP_SENSOR_MODULE_NAME, "Error reading the raw RTD temperature value!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    *temp = temp_rtd_raw_to_dk(raw_temp);
+
+    return 0;
+}
+
+int temp_rtd_scan_start(void)
+{
+    return ads1248_start_continuous(&config);
+}
+
+int temp_rtd_scan_read_raw(uint8_t channel, uint32_t *val)
+{
+    uint8_t buf[3];
+    uint8_t i = 0;
+
+    if (ads1248_select_channel(&config, channel) != 0)
+    {
+        return -1;
+    }
+
+    for(i = 0; i <= TEMP_SENSOR_SCAN_DISCARD; i++)
+    {
+        if (ads1248_read_continuous(&config, buf) != 0)
+        {
+            return -1;
+        }
+    }
+
+    *val = ((uint32_t)buf[0] << 16) | ((uint32_t)buf[1] << 8) | (uint32_t)buf[2];
+
+    return 0;
+}
+
+int temp_rtd_scan_read_k(uint8_t channel, uint16_t *temp)
+{
+    uint32_t raw_temp = 0;
+
+    if (temp_rtd_scan_read_raw(channel, &raw_temp) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TEMP_SENSOR_MODULE_NAME, "Error scanning the RTD ");
+        sys_log_print_uint(channel);
+        sys_log_print_msg("!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    *temp = temp_rtd_raw_to_k(raw_temp);
+
+    return 0;
+}
+
+int temp_rtd_verify(void)
+{
+    return ads1248_verify_regs(&config);
+}
+
+int temp_rtd_scan_stop(void)
+{
+    return ads1248_stop_continuous(&config);
+}
+
+int temp_rtd_calibrate(uint16_t board_temp)
+{
+    if (ads1248_calibrate(&config, ADS1248_CMD_SELFOCAL) != 0)
+    {
+        return -1;
+    }
+
+    temp_rtd_cal_temp = board_temp;
+    temp_rtd_cal_valid = true;
+
+    return 0;
+}
+
+uint16_t temp_rtd_get_cal_temp(void)
+{
+    return temp_rtd_cal_temp;
+}
+
+bool temp_rtd_is_calibrated(void)
+{
+    return temp_rtd_cal_valid;
+}
+
+int temp_rtd_cal_load(void)
+{
+    uint8_t buf[TEMP_SENSOR_CAL_MEM_SIZE] = {0U};
+    ads1248_cal_t cal;
+
+    if (media_read(TEMP_SENSOR_CAL_MEDIA, CONFIG_MEM_ADR_RTD_CAL, buf, TEMP_SENSOR_CAL_MEM_SIZE) != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TEMP_SENSOR_MODULE_NAME, "Error reading the ADS1248 calibration from the non-volatile memory!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    if ((buf[0] != TEMP_SENSOR_CAL_MEM_ID) || (crc8(buf, TEMP_SENSOR_CAL_MEM_SIZE - 1U) != buf[TEMP_SENSOR_CAL_MEM_SIZE - 1U]))
+    {
+        return -1;
+    }
+
+    /* OFC and FSC in the order of the registers (LSB first) */
+    uint32_t ofc = ((uint32_t)buf[3] << 16) | ((uint32_t)buf[2] << 8) | (uint32_t)buf[1];
+
+    cal.offset = (int32_t)((ofc & 0x00800000UL) ? (ofc | 0xFF000000UL) : ofc);
+    cal.full_scale = ((uint32_t)buf[6] << 16) | ((uint32_t)buf[5] << 8) | (uint32_t)buf[4];
+
+    if (ads1248_set_cal(&config, cal) != 0)
+    {
+        return -1;
+    }
+
+    temp_rtd_cal_temp = ((uint16_t)buf[7] << 8) | (uint16_t)buf[8];
+    temp_rtd_cal_valid = true;
+
+    return 0;
+}
+
+int temp_rtd_cal_save(void)
+{
+    uint8_t buf[TEMP_SENSOR_CAL_MEM_SIZE] = {0U};
+    ads1248_cal_t cal;
+
+    if (ads1248_get_cal(&config, &cal) != 0)
+    {
+        return -1;
+    }
+
+    buf[0] = TEMP_SENSOR_CAL_MEM_ID;
+    buf[1] = (uint32_t)cal.offset & 0xFFU;
+    buf[2] = ((uint32_t)cal.offset >> 8) & 0xFFU;
+    buf[3] = ((uint32_t)cal.offset >> 16) & 0xFFU;
+    buf[4] = cal.full_scale & 0xFFU;
+    buf[5] = (cal.full_scale >> 8) & 0xFFU;
+    buf[6] = (cal.full_scale >> 16) & 0xFFU;
+    buf[7] = (temp_rtd_cal_temp >> 8) & 0xFFU;
+    buf[8] = temp_rtd_cal_temp & 0xFFU;
+    buf[TEMP_SENSOR_CAL_MEM_SIZE - 1U] = crc8(buf, TEMP_SENSOR_CAL_MEM_SIZE - 1U);
+
+    if ((media_erase(TEMP_SENSOR_CAL_MEDIA, FLASH_SEG_C_ADR) != 0) || (media_write(TEMP_SENSOR_CAL_MEDIA, CONFIG_MEM_ADR_RTD_CAL, buf, TEMP_SENSOR_CAL_MEM_SIZE) != 0))
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TEMP_SENSOR_MODULE_NAME, "Error writing the ADS1248 calibration to the non-volatile memory!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    return 0;
+}
+
 /** \} End of temp_sensor group */
 
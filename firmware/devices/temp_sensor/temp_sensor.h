@@ -25,9 +25,9 @@
  * 
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * 
- * \version 0.2.26
+ * \version 0.2.36
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \defgroup temp_sensor Temperature Sensor
  * \ingroup devices
@@ -38,8 +38,10 @@
 #define TEMP_SENSOR_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include <drivers/ads1248/ads1248.h>
+#include <system/fixedpt/fixedpt.h>
 
 #define TEMP_SENSOR_MODULE_NAME     "Temperature Sensor"
 
@@ -52,8 +54,34 @@
 #define TEMP_SENSOR_START_PIN       GPIO_PIN_60
 #define TEMP_SENSOR_SPI_CS          SPI_CS_0
 #define TEMP_SENSOR_RESET_PIN       GPIO_PIN_58
+#define TEMP_SENSOR_DRDY_PIN        ADS1248_DRDY_PIN_NONE   /**< RTD_DRDY is routed to P8.7 (GPIO_PIN_61, MCU pin 67), which has no port interrupt, so the conversion time is waited. */
+#define TEMP_SENSOR_DATA_RATE       ADS1248_DR_40SPS    /**< ADS1248 data rate (a RTD read takes one conversion of ~26 ms). */
+#define TEMP_SENSOR_SCAN_DISCARD    1U                  /**< Conversions discarded after each channel switch of a scan (settling). */
 
-#define TEMP_SENSOR_CONV(VALUE)     ((((uint32_t)VALUE * (1.65 * 2 / 16777216) * 1000) - 1000 ) * (1/3.85))   /**< TODO: Solve magic conversion */
+/* ADS1248 calibration record in the flash memory */
+#define TEMP_SENSOR_CAL_MEM_ID          0xCBU           /**< ID of the calibration record in the flash memory. */
+#define TEMP_SENSOR_CAL_MEM_SIZE        10U             /**< Size of the calibration record (ID, OFC, FSC, board temperature and CRC-8). */
+
+/* RTD front-end (PT1000 excited with 1 mA, 3.3 V over the 24-bit range) */
+#define TEMP_SENSOR_RTD_EXC_MA      1.0                 /**< Excitation current of the RTDs in mA. */
+#define TEMP_SENSOR_RTD_OHM_PER_LSB (TEMP_SENSOR_REF_VOLTAGE * 1000.0 / 16777216.0 / TEMP_SENSOR_RTD_EXC_MA)    /**< RTD resistance of one LSB of the ADS1248 in ohms. */
+#define TEMP_SENSOR_RTD_LUT_SHIFT   6U                  /**< The raw value is scaled to raw/1024 in Q16 (exact, 24 bits fit in a Q16). */
+
+/* Callendar-Van Dusen equation of a PT1000 (IEC 60751) */
+#define TEMP_SENSOR_PT1000_R0       1000.0              /**< Resistance at 0 C in ohms. */
+#define TEMP_SENSOR_CVD_A           3.9083e-3           /**< Coefficient A. */
+#define TEMP_SENSOR_CVD_B           (-5.775e-7)         /**< Coefficient B. */
+#define TEMP_SENSOR_CVD_C           (-4.183e-12)        /**< Coefficient C (below 0 C only). */
+#define TEMP_SENSOR_CVD_R(T)        (TEMP_SENSOR_PT1000_R0 * (1.0 + (TEMP_SENSOR_CVD_A * (T)) + (TEMP_SENSOR_CVD_B * (T) * (T)) + (((T) < 0) ? (TEMP_SENSOR_CVD_C * ((T) - 100.0) * (T) * (T) * (T)) : 0.0)))  /**< PT1000 resistance in ohms at T Celsius. */
+
+/**
+ * \brief Temperatures of the points of the RTD lookup table in Celsius (evaluated at compile time, 10 C steps).
+ */
+#define TEMP_SENSOR_RTD_LUT_POINTS(X)   \
+        X(-100) X(-90) X(-80) X(-70) X(-60) X(-50) X(-40) X(-30) X(-20) X(-10) \
+        X(0) X(10) X(20) X(30) X(40) X(50) X(60) X(70) X(80) X(90) \
+        X(100) X(110) X(120) X(130) X(140) X(150) X(160) X(170) X(180) X(190) \
+        X(200)
 
 /**
  * \brief Temperature sensor RTD channels.
@@ -169,6 +197,18 @@ int temp_mcu_read_k(uint16_t *temp);
  */
 int temp_rtd_read_raw(uint8_t positive_channel, uint32_t *val);
 
+/**
+ * \brief Converts a raw reading of temperature from rtds to a real temperature in 0.1 kelvin.
+ *
+ * The PT1000 Callendar-Van Dusen curve is linearized by a lookup table generated at compile time (TEMP_SENSOR_RTD_LUT_POINTS), with a fixed-point interpolation between its points.
+ * Raw values out of the table are clamped to its ends.
+ *
+ * \param[in] raw is the raw reading of the temperature (bipolar 24-bit code, two's complement). Negative codes are clamped to the bottom of the table.
+ *
+ * \return The converted temperature in 0.1 kelvin.
+ */
+uint16_t temp_rtd_raw_to_dk(uint32_t raw);
+
 /**
  * \brief Converts a raw reading of temperature from rtds to a real temperature in degrees celsius.
  *
@@ -190,17 +230,124 @@ uint16_t temp_rtd_raw_to_k(uint32_t raw);
 /**
  * \brief read temperatures from rtds in degrees celsius.
  *
+ * \param[in] channel is the RTD channel.
+ *
+ * \param[in,out] temp is a pointer to store the read temperature.
+ *
  * \return The status/error code.
  */
-int temp_rtd_read_c(uint8_t channel, uint16_t *temp);
+int temp_rtd_read_c(uint8_t channel, int16_t *temp);
 
 /**
  * \brief read temperatures from rtds in kelvin.
  *
+ * \param[in] channel is the RTD channel.
+ *
+ * \param[in,out] temp is a pointer to store the read temperature.
+ *
  * \return The status/error code.
  */
 int temp_rtd_read_k(uint8_t channel, uint16_t *temp);
 
+/**
+ * \brief read temperatures from rtds in 0.1 kelvin.
+ *
+ * \param[in] channel is the RTD channel.
+ *
+ * \param[in,out] temp is a pointer to store the read temperature.
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_read_dk(uint8_t channel, uint16_t *temp);
+
+/**
+ * \brief Starts a scan of the RTDs (continuous conversions of the ADS1248).
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_scan_start(void);
+
+/**
+ * \brief Reads the raw value of a RTD during a scan.
+ *
+ * Switches the ADS1248 to the channel, discards the first TEMP_SENSOR_SCAN_DISCARD conversions (settling) and returns the next one.
+ *
+ * \param[in] channel is the RTD channel.
+ *
+ * \param[in,out] val is a pointer to store the raw value.
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_scan_read_raw(uint8_t channel, uint32_t *val);
+
+/**
+ * \brief Reads the temperature of a RTD in kelvin during a scan.
+ *
+ * \param[in] channel is the RTD channel.
+ *
+ * \param[in,out] temp is a pointer to store the read temperature.
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_scan_read_k(uint8_t channel, uint16_t *temp);
+
+/**
+ * \brief Verifies the registers of the ADS1248 (written again if they are not the expected ones).
+ *
+ * Must be called out of a scan.
+ *
+ * \return The status/error code (-1 if the registers had to be written again).
+ */
+int temp_rtd_verify(void);
+
+/**
+ * \brief Runs a self offset calibration of the ADS1248.
+ *
+ * Must be called out of a scan. The calibration takes ADS1248_CAL_CONV_QTY conversion periods.
+ *
+ * \param[in] board_temp is the board temperature in Kelvin during the calibration (see temp_rtd_get_cal_temp()).
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_calibrate(uint16_t board_temp);
+
+/**
+ * \brief Gets the board temperature of the current ADS1248 calibration.
+ *
+ * \return The board temperature in Kelvin (only meaningful if temp_rtd_is_calibrated() is true).
+ */
+uint16_t temp_rtd_get_cal_temp(void);
+
+/**
+ * \brief Checks if the ADS1248 was calibrated (see temp_rtd_calibrate() and temp_rtd_cal_load()).
+ *
+ * \return True if the ADS1248 was calibrated since the initialization.
+ */
+bool temp_rtd_is_calibrated(void);
+
+/**
+ * \brief Restores the ADS1248 calibration stored in the flash memory.
+ *
+ * Must be called out of a scan.
+ *
+ * \return The status/error code (-1 if there is no valid record).
+ */
+int temp_rtd_cal_load(void);
+
+/**
+ * \brief Saves the current ADS1248 calibration (and its board temperature) into the flash memory.
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_cal_save(void);
+
+/**
+ * \brief Ends a scan of the RTDs (the ADS1248 is powered down until the next scan).
+ *
+ * \return The status/error code.
+ */
+int temp_rtd_scan_stop(void);
+
 #endif /* TEMP_SENSOR_H_ */
 
 /** \} End of temp_sensor group */
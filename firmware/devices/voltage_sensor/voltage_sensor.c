@@ -25,15 +25,16 @@
  * 
  * \authors Gabriel Mariano Marcelino <gabriel.mm8@gmail.com> and Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * 
- * \version 0.2.21
+ * \version 0.2.22
  * 
- * \date 2021/06/07
+ * \date 2026/10/17
  * 
  * \addtogroup voltage_sensor
  * \{
  */
 
 #include <system/sys_log/sys_log.h>
+#include <devices/sensor_cal/sensor_cal.h>
 
 #include "voltage_sensor.h"
 
@@ -56,14 +57,7 @@ int voltage_sensor_init(void)
 
 uint16_t voltage_sensor_raw_to_mv(adc_port_t port, uint16_t raw)
 {
-    if (port == TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT || port == MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT)
-    {
-        return (uint16_t)(raw * ADC_VREF_MV * VOLTAGE_SENSOR_DIV_1 / ADC_RANGE);
-    }
-    else
-    {
-        return (uint16_t)(raw * ADC_VREF_MV * VOLTAGE_SENSOR_DIV_2 / ADC_RANGE);
-    }
+    return sensor_cal_convert(port, raw);
 }
 
 int voltage_sensor_read(adc_port_t port, uint16_t *volt)
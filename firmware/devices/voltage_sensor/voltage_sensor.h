@@ -25,9 +25,9 @@
  * 
  * \authors Gabriel Mariano Marcelino <gabriel.mm8@gmail.com> and Vinicius Pimenta Bernardo <viniciuspibi@gmail.com>
  * 
- * \version 0.2.15
+ * \version 0.2.16
  * 
- * \date 2021/06/07
+ * \date 2026/10/17
  * 
  * \defgroup voltage_sensor Voltage Sensor
  * \ingroup devices
@@ -51,6 +51,10 @@
 #define VOLTAGE_SENSOR_DIV_1 		4.0  		/**< Voltage divisor factor for main solar pannels and bus voltage. */
 #define VOLTAGE_SENSOR_DIV_2 		1.93 		/**< Voltage divisor factor for other voltages. */
 
+/* Nominal voltage per ADC count in mV (Q16), used to seed the sensors calibration */
+#define VOLTAGE_SENSOR_DIV_1_GAIN_Q16   ((int32_t)(65536.0 * ADC_VREF_MV * VOLTAGE_SENSOR_DIV_1 / ADC_RANGE + 0.5))
+#define VOLTAGE_SENSOR_DIV_2_GAIN_Q16   ((int32_t)(65536.0 * ADC_VREF_MV * VOLTAGE_SENSOR_DIV_2 / ADC_RANGE + 0.5))
+
 /**
  * \brief Voltage sensor device initialization routine.
  *
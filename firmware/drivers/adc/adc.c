@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.2.20
+ * \version 0.2.26
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \addtogroup adc
  * \{
@@ -40,20 +40,81 @@
 #include <hal/adc12_a.h>
 #include <hal/ref.h>
 #include <hal/tlv.h>
+#include <hal/dma.h>
 
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
+#include <drivers/mpy/mpy.h>
 
 #include "adc.h"
 
+#define ADC_SCAN_DMA_CHANNEL        DMA_CHANNEL_0
+#define ADC_SCAN_DMA_TRIGGER        DMA_TRIGGERSOURCE_24    /* ADC12IFGx (end of the sequence) */
+#define ADC_SCAN_READ_MAX_RETRIES   3U
+#define ADC_OS_RECIP_FRAC_BITS      24U                     /* Fractional bits of the reciprocal of the oversampling ratio */
+
+#define ADC_IFG_ALL                 (ADC12_A_IFG0 | ADC12_A_IFG1 | ADC12_A_IFG2 | ADC12_A_IFG3 | ADC12_A_IFG4 | ADC12_A_IFG5 | ADC12_A_IFG6 | ADC12_A_IFG7 | \
+                                     ADC12_A_IFG8 | ADC12_A_IFG9 | ADC12_A_IFG10 | ADC12_A_IFG11 | ADC12_A_IFG12 | ADC12_A_IFG13 | ADC12_A_IFG14 | ADC12_A_IFG15)
+
 bool adc_is_ready = false;
 
-float adc_mref = 0;
-float adc_nref = 0;
+static bool adc_scan_running = false;
+
+/**
+ * \brief Latest complete sequence of conversions, written by the DMA controller.
+ */
+static volatile uint16_t adc_scan_buf[ADC_SCAN_LEN];
+
+/**
+ * \brief Latest decimated value of each port.
+ */
+static volatile uint16_t adc_scan_out[ADC_SCAN_LEN];
+
+/**
+ * \brief Number of sequences processed (changes on every DMA interrupt).
+ */
+static volatile uint16_t adc_scan_count = 0;
+
+/**
+ * \brief The first sequence after the start of the scan was processed.
+ */
+static volatile bool adc_scan_valid = false;
+
+/**
+ * \brief Oversampling state of a port.
+ */
+typedef struct
+{
+    uint32_t acc;       /**< Sum of the samples of the current value. */
+    uint32_t recip;     /**< Reciprocal of the ratio (ADC_OS_RECIP_FRAC_BITS fractional bits). */
+    uint16_t ratio;     /**< Oversampling ratio. */
+    uint16_t n;         /**< Number of accumulated samples. */
+} adc_os_t;
+
+static adc_os_t adc_os[ADC_SCAN_LEN];
+
+q16_t adc_mref = 0;
+q16_t adc_nref = 0;
 
 uint8_t adc_cal_bytes;
 struct s_TLV_ADC_Cal_Data *adc_cal_data;
 
+/**
+ * \brief Waits the first sequence of the scan.
+ *
+ * \return The status/error code.
+ */
+static int adc_scan_wait(void);
+
+/**
+ * \brief Accumulates the last sequence of conversions and decimates the ports with enough samples.
+ *
+ * \note Called from the DMA ISR.
+ *
+ * \return None.
+ */
+static void adc_scan_decimate(void);
+
 int adc_init(adc_port_t port, adc_config_t config)
 {
     if (adc_is_ready)
@@ -62,7 +123,7 @@ int adc_init(adc_port_t port, adc_config_t config)
         sys_log_print_event_from_module(SYS_LOG_WARNING, ADC_MODULE_NAME, "ADC driver already initialized!");
         sys_log_new_line();
     #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-        return 0;
+        return adc_set_oversampling(port, config.osr);
     }
 
     /* Set port 6 and 7 pins as inputs */
@@ -173,12 +234,12 @@ int adc_init(adc_port_t port, adc_config_t config)
     param.endOfSequence                     = ADC12_A_NOTENDOFSEQUENCE;
     ADC12_A_configureMemory(ADC12_A_BASE, &param);
 
-    /* Solar Panel total voltage sensor */
+    /* Solar Panel total voltage sensor (last slot of the scan, the unused slots 8, 9 and 11 are also converted) */
     param.memoryBufferControlIndex          = ADC12_A_MEMORY_15;
     param.inputSourceSelect                 = ADC12_A_INPUT_A15;
     param.positiveRefVoltageSourceSelect    = ADC12_A_VREFPOS_EXT;
     param.negativeRefVoltageSourceSelect    = ADC12_A_VREFNEG_AVSS;
-    param.endOfSequence                     = ADC12_A_NOTENDOFSEQUENCE;
+    param.endOfSequence                     = ADC12_A_ENDOFSEQUENCE;
     ADC12_A_configureMemory(ADC12_A_BASE, &param);
 
     ADC12_A_clearInterrupt(ADC12_A_BASE, ADC12_A_IFG0 | ADC12_A_IFG1 | ADC12_A_IFG2 | ADC12_A_IFG3 | ADC12_A_IFG4 | ADC12_A_IFG5 | ADC12_A_IFG6 | ADC12_A_IFG7 | ADC12_A_IFG10 | ADC12_A_IFG12 | ADC12_A_IFG13 | ADC12_A_IFG14 | ADC12_A_IFG15);
@@ -205,19 +266,49 @@ int adc_init(adc_port_t port, adc_config_t config)
     /* Temperature sensor calibration data */
     TLV_getInfo(TLV_TAG_ADCCAL, 0, &adc_cal_bytes, (uint16_t **)&adc_cal_data);
 
-    adc_mref = ((float)(adc_cal_data->adc_ref15_85_temp - adc_cal_data->adc_ref15_30_temp)) / (85 - 30);
-    adc_nref = adc_cal_data->adc_ref15_85_temp - adc_mref * 85;
+    adc_mref = fixedpt_q16_div(FIXEDPT_Q16_INT((int32_t)adc_cal_data->adc_ref15_85_temp - (int32_t)adc_cal_data->adc_ref15_30_temp), FIXEDPT_Q16_INT(85 - 30));
+    adc_nref = fixedpt_q16_sub(FIXEDPT_Q16_INT(adc_cal_data->adc_ref15_85_temp), adc_mref * 85);
 
     /* Mutex initialization */
     adc_mutex_create();
 
     adc_is_ready = true;
 
+    if (adc_set_oversampling(port, config.osr) != 0)
+    {
+        return -1;
+    }
+
+#if CONFIG_ADC_SCAN_ENABLED == 1
+    if (adc_scan_start() != 0)
+    {
+        return -1;
+    }
+#endif /* CONFIG_ADC_SCAN_ENABLED */
+
     return 0;
 }
 
 int adc_read(adc_port_t port, uint16_t *val)
 {
+    if (port > ADC_PORT_15)
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, ADC_MODULE_NAME, "Error reading the ADC port ");
+        sys_log_print_uint(port);
+        sys_log_print_msg("! Invalid port!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        return -1;
+    }
+
+    if (adc_scan_running)
+    {
+        *val = adc_scan_out[port];
+
+        return 0;
+    }
+
     uint8_t i = 0;
     for(i=0; i<ADC_TIMOUT_MS; i++)
     {
@@ -238,367 +329,291 @@ int adc_read(adc_port_t port, uint16_t *val)
         return -1;  /* Timeout reached */
     }
 
-    switch(port)
-    {
-        case ADC_PORT_0:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_0, ADC12_A_SINGLECHANNEL);
-
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG0))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
-
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
-
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_0);
-
-            break;
-        case ADC_PORT_1:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_1, ADC12_A_SINGLECHANNEL);
-
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG1))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
-
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    /* Each port uses the memory slot and the interrupt flag with the same index */
+    uint16_t ifg = 1U << port;
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_1);
+    adc_notify_prepare();
 
-            break;
-        case ADC_PORT_2:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_2, ADC12_A_SINGLECHANNEL);
-
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG2))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
+    ADC12_A_clearInterrupt(ADC12_A_BASE, ifg);
+    ADC12_A_enableInterrupt(ADC12_A_BASE, ifg);
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
-
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_2);
-
-            break;
-        case ADC_PORT_3:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_3, ADC12_A_SINGLECHANNEL);
+    ADC12_A_startConversion(ADC12_A_BASE, port, ADC12_A_SINGLECHANNEL);
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG3))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
+    /* The ISR wakes the task at the end of the conversion */
+    if (adc_notify_wait(ADC_TIMOUT_MS) != 0)
+    {
+        ADC12_A_disableInterrupt(ADC12_A_BASE, ifg);
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+        return -1;  /* Timeout reached */
+    }
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_3);
+    *val = ADC12_A_getResults(ADC12_A_BASE, port);
 
-            break;
-        case ADC_PORT_4:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_4, ADC12_A_SINGLECHANNEL);
+    ADC12_A_clearInterrupt(ADC12_A_BASE, ADC_IFG_ALL);
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG4))
-                {
-                    break;
-                }
+    return 0;
+}
 
-                adc_delay_ms(1);
-            }
+int adc_set_oversampling(adc_port_t port, uint16_t osr)
+{
+    if ((port > ADC_PORT_15) || (osr > ADC_OSR_MAX))
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, ADC_MODULE_NAME, "Invalid oversampling ratio of the port ");
+        sys_log_print_uint(port);
+        sys_log_print_msg("!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        return -1;
+    }
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    uint16_t ratio = (osr == 0U) ? 1U : osr;
+    uint16_t sr = __get_SR_register();
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_4);
+    /* The state is also used by the DMA ISR */
+    __disable_interrupt();
 
-            break;
-        case ADC_PORT_5:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_5, ADC12_A_SINGLECHANNEL);
+    adc_os[port].acc    = 0;
+    adc_os[port].n      = 0;
+    adc_os[port].ratio  = ratio;
+    adc_os[port].recip  = ((1UL << ADC_OS_RECIP_FRAC_BITS) + (ratio / 2U)) / ratio;
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG5))
-                {
-                    break;
-                }
+    __bis_SR_register(sr & GIE);
 
-                adc_delay_ms(1);
-            }
+    return 0;
+}
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+int adc_scan_start(void)
+{
+    if (adc_scan_running)
+    {
+        return 0;
+    }
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_5);
+    /* The sampling mode can only be changed with the conversions disabled */
+    ADC12_A_disableConversions(ADC12_A_BASE, ADC12_A_COMPLETECONVERSION);
 
-            break;
-        case ADC_PORT_6:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_6, ADC12_A_SINGLECHANNEL);
+    /* Each conversion of the sequence starts as soon as the previous one is done */
+    ADC12_A_setupSamplingTimer(ADC12_A_BASE, ADC12_A_CYCLEHOLD_768_CYCLES, ADC12_A_CYCLEHOLD_4_CYCLES, ADC12_A_MULTIPLESAMPLESENABLE);
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG6))
-                {
-                    break;
-                }
+    DMA_initParam param = {0};
 
-                adc_delay_ms(1);
-            }
+    param.channelSelect         = ADC_SCAN_DMA_CHANNEL;
+    param.transferModeSelect    = DMA_TRANSFER_REPEATED_BLOCK;
+    param.transferSize          = ADC_SCAN_LEN;
+    param.triggerSourceSelect   = ADC_SCAN_DMA_TRIGGER;
+    param.transferUnitSelect    = DMA_SIZE_SRCWORD_DSTWORD;
+    param.triggerTypeSelect     = DMA_TRIGGER_RISINGEDGE;
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    DMA_init(&param);
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_6);
+    DMA_setSrcAddress(ADC_SCAN_DMA_CHANNEL, ADC12_A_getMemoryAddressForDMA(ADC12_A_BASE, ADC12_A_MEMORY_0), DMA_DIRECTION_INCREMENT);
+    DMA_setDstAddress(ADC_SCAN_DMA_CHANNEL, (uint32_t)(uintptr_t)adc_scan_buf, DMA_DIRECTION_INCREMENT);
 
-            break;
-        case ADC_PORT_7:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_7, ADC12_A_SINGLECHANNEL);
+    uint8_t i = 0;
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG7))
-                {
-                    break;
-                }
+    for(i = 0; i < ADC_SCAN_LEN; i++)
+    {
+        adc_os[i].acc = 0;
+        adc_os[i].n = 0;
+    }
 
-                adc_delay_ms(1);
-            }
+    adc_scan_valid = false;
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    DMA_clearInterrupt(ADC_SCAN_DMA_CHANNEL);
+    DMA_enableInterrupt(ADC_SCAN_DMA_CHANNEL);
+    DMA_enableTransfers(ADC_SCAN_DMA_CHANNEL);
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_7);
+    ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_0, ADC12_A_REPEATED_SEQOFCHANNELS);
 
-            break;
-        case ADC_PORT_8:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_8, ADC12_A_SINGLECHANNEL);
+    adc_scan_running = true;
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG8))
-                {
-                    break;
-                }
+    /* The buffer is only valid after the first complete sequence */
+    if (adc_scan_wait() != 0)
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, ADC_MODULE_NAME, "Error starting the scan! Timeout reached!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
 
-                adc_delay_ms(1);
-            }
+        adc_scan_stop();
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+        return -1;
+    }
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_8);
+    return 0;
+}
 
-            break;
-        case ADC_PORT_9:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_9, ADC12_A_SINGLECHANNEL);
+int adc_scan_stop(void)
+{
+    if (!adc_scan_running)
+    {
+        return 0;
+    }
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG9))
-                {
-                    break;
-                }
+    /* Ends the sequence immediately and returns to the single-channel mode */
+    ADC12_A_disableConversions(ADC12_A_BASE, ADC12_A_PREEMPTCONVERSION);
 
-                adc_delay_ms(1);
-            }
+    DMA_disableTransfers(ADC_SCAN_DMA_CHANNEL);
+    DMA_disableInterrupt(ADC_SCAN_DMA_CHANNEL);
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    ADC12_A_setupSamplingTimer(ADC12_A_BASE, ADC12_A_CYCLEHOLD_768_CYCLES, ADC12_A_CYCLEHOLD_4_CYCLES, ADC12_A_MULTIPLESAMPLESDISABLE);
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_9);
+    ADC12_A_clearInterrupt(ADC12_A_BASE, ADC_IFG_ALL);
 
-            break;
-        case ADC_PORT_10:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_10, ADC12_A_SINGLECHANNEL);
+    adc_scan_running = false;
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG10))
-                {
-                    break;
-                }
+    return 0;
+}
 
-                adc_delay_ms(1);
-            }
+int adc_scan_read(uint16_t *buf)
+{
+    if (!adc_scan_running)
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, ADC_MODULE_NAME, "Error reading the scan! The scan is not running!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        return -1;
+    }
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+    uint8_t retry = 0;
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_10);
+    for(retry = 0; retry < ADC_SCAN_READ_MAX_RETRIES; retry++)
+    {
+        uint16_t count = adc_scan_count;
+        uint8_t i = 0;
 
-            break;
-        case ADC_PORT_11:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_11, ADC12_A_SINGLECHANNEL);
+        for(i = 0; i < ADC_SCAN_LEN; i++)
+        {
+            buf[i] = adc_scan_out[i];
+        }
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG11))
-                {
-                    break;
-                }
+        /* A sequence takes much longer than the copy, so a single retry is enough if the ISR ran meanwhile */
+        if (count == adc_scan_count)
+        {
+            return 0;
+        }
+    }
 
-                adc_delay_ms(1);
-            }
+    return -1;
+}
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+q16_t adc_temp_get_mref(void)
+{
+    return adc_mref;
+}
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_11);
+q16_t adc_temp_get_nref(void)
+{
+    return adc_nref;
+}
 
-            break;
-        case ADC_PORT_12:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_12, ADC12_A_SINGLECHANNEL);
+int adc_get_tlv_cal(uint16_t *gain, int16_t *offset)
+{
+    if ((adc_cal_data == NULL) || (adc_cal_bytes == 0U))
+    {
+        return -1;
+    }
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG12))
-                {
-                    break;
-                }
+    *gain = adc_cal_data->adc_gain_factor;
+    *offset = adc_cal_data->adc_offset;
 
-                adc_delay_ms(1);
-            }
+    return 0;
+}
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+/**
+ * \brief ADC12_A interrupt service routine (end of a single conversion).
+ */
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector=ADC12_VECTOR
+__interrupt
+#elif defined(__GNUC__)
+__attribute__((interrupt(ADC12_VECTOR)))
+#endif
+void ADC12_ISR(void)
+{
+    /* The flag is kept until the result is read, only the interrupt is disabled */
+    ADC12_A_disableInterrupt(ADC12_A_BASE, ADC_IFG_ALL);
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_12);
+    adc_notify_from_isr();
+}
 
+/**
+ * \brief DMA interrupt service routine (end of a block transfer).
+ */
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector=DMA_VECTOR
+__interrupt
+#elif defined(__GNUC__)
+__attribute__((interrupt(DMA_VECTOR)))
+#endif
+void DMA_ISR(void)
+{
+    switch(__even_in_range(DMAIV, 16))
+    {
+        case DMAIV_DMA0IFG:
+            adc_scan_decimate();
             break;
-        case ADC_PORT_13:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_13, ADC12_A_SINGLECHANNEL);
-
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG13))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
-
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
-
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_13);
-
+        default:
             break;
-        case ADC_PORT_14:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_14, ADC12_A_SINGLECHANNEL);
-
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG14))
-                {
-                    break;
-                }
-
-                adc_delay_ms(1);
-            }
+    }
+}
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+static void adc_scan_decimate(void)
+{
+    uint8_t i = 0;
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_14);
+    for(i = 0; i < ADC_SCAN_LEN; i++)
+    {
+        adc_os_t *os = &adc_os[i];
+        uint16_t raw = adc_scan_buf[i];
 
-            break;
-        case ADC_PORT_15:
-            ADC12_A_startConversion(ADC12_A_BASE, ADC12_A_MEMORY_15, ADC12_A_SINGLECHANNEL);
+        /* The first sequence gives a value to every port until the first decimation */
+        if ((os->ratio <= 1U) || !adc_scan_valid)
+        {
+            adc_scan_out[i] = raw;
+        }
 
-            for(i=0; i<ADC_TIMOUT_MS; i++)
-            {
-                if (ADC12_A_getInterruptStatus(ADC12_A_BASE, ADC12_A_IFG15))
-                {
-                    break;
-                }
+        if (os->ratio <= 1U)
+        {
+            continue;
+        }
 
-                adc_delay_ms(1);
-            }
+        os->acc += raw;
+        os->n++;
 
-            if (i == ADC_TIMOUT_MS)
-            {
-                return -1;  /* Timeout reached */
-            }
+        if (os->n >= os->ratio)
+        {
+            /* acc/ratio rounded (12-bit scale, see adc_set_oversampling()), as a multiplication by the reciprocal (any ratio) */
+            int64_t avg = mpy_mul_s32((int32_t)os->acc, (int32_t)os->recip) + (1LL << (ADC_OS_RECIP_FRAC_BITS - 1U));
 
-            *val = ADC12_A_getResults(ADC12_A_BASE, ADC12_A_MEMORY_15);
+            adc_scan_out[i] = (uint16_t)(avg >> ADC_OS_RECIP_FRAC_BITS);
 
-            break;
-        default:
-        #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
-            sys_log_print_event_from_module(SYS_LOG_ERROR, ADC_MODULE_NAME, "Error reading the ADC port ");
-            sys_log_print_uint(port);
-            sys_log_print_msg("! Invalid port!");
-            sys_log_new_line();
-        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-            return -1;
+            os->acc = 0;
+            os->n = 0;
+        }
     }
 
-    ADC12_A_clearInterrupt(ADC12_A_BASE, ADC12_A_IFG0 | ADC12_A_IFG1 | ADC12_A_IFG2 | ADC12_A_IFG3 | ADC12_A_IFG4 | ADC12_A_IFG5 | ADC12_A_IFG6 | ADC12_A_IFG7 | ADC12_A_IFG10 | ADC12_A_IFG12 | ADC12_A_IFG13 | ADC12_A_IFG14 | ADC12_A_IFG15);
-
-    return 0;
+    adc_scan_count++;
+    adc_scan_valid = true;
 }
 
-float adc_temp_get_mref(void)
+static int adc_scan_wait(void)
 {
-    return adc_mref;
-}
+    uint8_t i = 0;
 
-float adc_temp_get_nref(void)
-{
-    return adc_nref;
+    for(i = 0; i < ADC_TIMOUT_MS; i++)
+    {
+        if (adc_scan_valid)
+        {
+            return 0;
+        }
+
+        adc_delay_ms(1);
+    }
+
+    return -1;  /* Timeout reached */
 }
 
 /** \} End of adc group */
@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.2.20
+ * \version 0.2.26
  * 
- * \date 2021/06/11
+ * \date 2026/10/17
  * 
  * \defgroup adc ADC
  * \ingroup drivers
@@ -40,6 +40,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <system/fixedpt/fixedpt.h>
+
 #define ADC_MODULE_NAME     "ADC"
 
 #define ADC_VREF_V          (2.5)       /**< ADC reference voltage in Volts. Set to 3.3 if jumper J_V4 is soldered */
@@ -48,6 +50,12 @@
 
 #define ADC_TIMOUT_MS       100         /**< Timeout in milliseconds. */
 
+#define ADC_SCAN_LEN        16U         /**< Number of memory slots converted in a scan (MEM0 to MEM15). */
+
+#define ADC_NOTIFY_BIT      (1UL << 31UL)   /**< Task notification bit reserved to the end of conversion. */
+
+#define ADC_OSR_MAX         256U        /**< Maximum oversampling ratio of a port. */
+
 /**
  * \brief ADC ports.
  */
@@ -79,6 +87,7 @@ typedef struct
     uint16_t sh_src;    /**< Sample-and-Hold signal source. */
     uint8_t clk_src;    /**< Clock source. */
     uint16_t clk_div;   /**< Clock source divider. */
+    uint16_t osr;       /**< Oversampling ratio of the port (samples averaged per value, 0 or 1 to disable, up to ADC_OSR_MAX). */
 } adc_config_t;
 
 /**
@@ -131,6 +140,59 @@ int adc_init(adc_port_t port, adc_config_t config);
  */
 int adc_read(adc_port_t port, uint16_t *val);
 
+/**
+ * \brief Sets the oversampling ratio of an ADC port.
+ *
+ * While the scan is running, the DMA interrupt accumulates osr consecutive samples of the port
+ * and decimates them to a single value. The single conversions of adc_read() are not oversampled.
+ *
+ * \note This is an averaging filter, not an oversample-and-decimate of extra resolution bits: the
+ * published value is the rounded average acc/osr, in the 12-bit scale of a single sample, instead
+ * of the wider acc >> (log2(osr)/2). It reduces the noise by sqrt(osr), but the fractional bits of
+ * the average are dropped, so every raw-to-unit conversion and the sensor_cal gains stay valid.
+ *
+ * \param[in] port is the ADC port (ADC_PORT_0 to ADC_PORT_15).
+ *
+ * \param[in] osr is the oversampling ratio (0 or 1 to disable, up to ADC_OSR_MAX).
+ *
+ * \return The status/error code.
+ */
+int adc_set_oversampling(adc_port_t port, uint16_t osr);
+
+/**
+ * \brief Starts the continuous scan of the ADC ports.
+ *
+ * The ADC12_A converts all the memory slots in repeat-sequence-of-channels mode, and the DMA
+ * controller copies each complete sequence to a RAM buffer, decimated by the DMA interrupt (see
+ * adc_set_oversampling()). While the scan is running, adc_read() returns the latest value of the
+ * port instead of starting a new conversion.
+ *
+ * \note The caller must hold the ADC mutex.
+ *
+ * \return The status/error code.
+ */
+int adc_scan_start(void);
+
+/**
+ * \brief Stops the continuous scan of the ADC ports.
+ *
+ * \note The caller must hold the ADC mutex.
+ *
+ * \return The status/error code.
+ */
+int adc_scan_stop(void);
+
+/**
+ * \brief Reads the latest values of all the ADC ports.
+ *
+ * The values are copied between two DMA interrupts, so none of them is updated during the copy.
+ *
+ * \param[in,out] buf is a pointer to store the values of the ports 0 to 15 (ADC_SCAN_LEN values).
+ *
+ * \return The status/error code.
+ */
+int adc_scan_read(uint16_t *buf);
+
 /**
  * \brief Milliseconds delay.
  *
@@ -143,16 +205,31 @@ void adc_delay_ms(uint16_t ms);
 /**
  * \brief Gets the mref value used to calibrate the sensor temperature.
  *
- * \return The mref value.
+ * \return The mref value (slope in counts per degree Celsius, Q16).
  */
-float adc_temp_get_mref(void);
+q16_t adc_temp_get_mref(void);
 
 /**
  * \brief Gets the nref value used to calibrate the sensor temperature.
  *
- * \return The nref value.
+ * \return The nref value (counts at 0 degree Celsius, Q16).
  */
-float adc_temp_get_nref(void);
+q16_t adc_temp_get_nref(void);
+
+/**
+ * \brief Gets the gain and offset calibration of the ADC12_A from the TLV structure.
+ *
+ * The corrected value of a conversion is (raw * gain) / 32768 + offset.
+ *
+ * \note The TLV data is read during the ADC initialization (adc_init()).
+ *
+ * \param[in,out] gain is a pointer to store the gain factor (32768 = 1.0).
+ *
+ * \param[in,out] offset is a pointer to store the offset in counts.
+ *
+ * \return The status/error code.
+ */
+int adc_get_tlv_cal(uint16_t *gain, int16_t *offset);
 
 /**
  * \brief Creates a mutex to use the ADC module.
@@ -175,6 +252,35 @@ bool adc_mutex_take(void);
  */
 bool adc_mutex_give(void);
 
+/**
+ * \brief Prepares the current task to wait an end of conversion.
+ *
+ * Must be called before starting the conversion.
+ *
+ * \return None.
+ */
+void adc_notify_prepare(void);
+
+/**
+ * \brief Waits the end of conversion notification from the ADC ISR.
+ *
+ * The other notifications received by the task while waiting are kept.
+ *
+ * \param[in] timeout_ms is the maximum time to wait in milliseconds (counted from the call).
+ *
+ * \return The status/error code (-1 if the deadline was reached).
+ */
+int adc_notify_wait(uint16_t timeout_ms);
+
+/**
+ * \brief Notifies the task waiting the end of conversion.
+ *
+ * \note Must be called from the ADC ISR.
+ *
+ * \return None.
+ */
+void adc_notify_from_isr(void);
+
 #endif /* ADC_H_ */
 
 /** \} End of adc group */
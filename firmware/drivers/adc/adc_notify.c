@@ -0,0 +1,99 @@
+/*
+ * adc_notify.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief ADC conversion notification implementation.
+ *
+ * \version 0.2.22
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup adc_notify Notification
+ * \ingroup adc
+ * \{
+ */
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "adc.h"
+
+static volatile TaskHandle_t adc_notify_task = NULL;
+
+static volatile bool adc_notify_done = false;
+
+void adc_notify_prepare(void)
+{
+    adc_notify_done = false;
+    adc_notify_task = xTaskGetCurrentTaskHandle();
+}
+
+int adc_notify_wait(uint16_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    uint32_t others = 0;
+
+    while(!adc_notify_done)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        uint32_t notified_value = 0;
+
+        if (elapsed >= timeout)
+        {
+            break;
+        }
+
+        /* Other notifications (ex.: data buffer subscriptions) can wake the task before the deadline */
+        if (xTaskNotifyWait(0UL, ADC_NOTIFY_BIT, &notified_value, timeout - elapsed) == pdPASS)
+        {
+            others |= notified_value & ~ADC_NOTIFY_BIT;
+        }
+    }
+
+    adc_notify_task = NULL;
+
+    /* Gives back the notifications received while waiting the conversion */
+    if (others != 0U)
+    {
+        xTaskNotify(xTaskGetCurrentTaskHandle(), others, eSetBits);
+    }
+
+    return adc_notify_done ? 0 : -1;
+}
+
+void adc_notify_from_isr(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    adc_notify_done = true;
+
+    if (adc_notify_task != NULL)
+    {
+        xTaskNotifyFromISR(adc_notify_task, ADC_NOTIFY_BIT, eSetBits, &xHigherPriorityTaskWoken);
+    }
+
+    /* Force a context switch if the waiting task has a higher priority */
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/** \} End of adc_notify group */
@@ -27,9 +27,9 @@
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * \author Joao Claudio Elsen Barcellos <joaoclaudiobarcellos@gmail.com>
  * 
- * \version 0.2.33
+ * \version 0.2.37
  * 
- * \date 2021/03/09
+ * \date 2026/10/17
  * 
  * \addtogroup ads1248
  * \{
@@ -42,6 +42,54 @@
 
 #include "ads1248.h"
 
+#define ADS1248_IDAC0_DRDY_MODE     0x08U   /**< DOUT/DRDY pin also indicates the end of the conversions. */
+
+/**
+ * \brief Conversion time after a SYNC of each data rate in milliseconds (rounded up, datasheet table "Conversion time").
+ */
+static const uint8_t ads1248_conv_time_ms[] = {
+    [ADS1248_DR_5SPS]       = 201,
+    [ADS1248_DR_10SPS]      = 101,
+    [ADS1248_DR_20SPS]      = 51,
+    [ADS1248_DR_40SPS]      = 26,
+    [ADS1248_DR_80SPS]      = 13,
+    [ADS1248_DR_160SPS]     = 7,
+    [ADS1248_DR_320SPS]     = 4,
+    [ADS1248_DR_640SPS]     = 2,
+    [ADS1248_DR_1000SPS]    = 2,
+    [ADS1248_DR_2000SPS]    = 1,
+};
+
+/**
+ * \brief Writable bits of each register (the others are read-only).
+ */
+static const uint8_t ads1248_reg_rw_mask[ADS1248_REG_QTY] = {
+    [ADS1248_REG_MUX0]      = 0xFF,
+    [ADS1248_REG_VBIAS]     = 0xFF,
+    [ADS1248_REG_MUX1]      = 0x7F,     /* CLKSTAT */
+    [ADS1248_REG_SYS0]      = 0x7F,
+    [ADS1248_REG_OFC0]      = 0xFF,
+    [ADS1248_REG_OFC1]      = 0xFF,
+    [ADS1248_REG_OFC2]      = 0xFF,
+    [ADS1248_REG_FSC0]      = 0xFF,
+    [ADS1248_REG_FSC1]      = 0xFF,
+    [ADS1248_REG_FSC2]      = 0xFF,
+    [ADS1248_REG_IDAC0]     = 0x0F,     /* Device ID */
+    [ADS1248_REG_IDAC1]     = 0xFF,
+    [ADS1248_REG_GPIOCFG]   = 0xFF,
+    [ADS1248_REG_GPIODIR]   = 0xFF,
+    [ADS1248_REG_GPIODAT]   = 0xFF,
+};
+
+/**
+ * \brief Loads the shadow copy with the current content of the registers.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \return None.
+ */
+static void ads1248_load_regs(ads1248_config_t *config);
+
 int ads1248_init(ads1248_config_t *config)
 {
     #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
@@ -55,7 +103,14 @@ int ads1248_init(ads1248_config_t *config)
     
     int res_spi = spi_init(config->spi_port, config->spi_config);
     
-    if ((res_start != 0) || (res_start != 0) || (res_spi != 0))
+    int res_drdy = 0;
+
+    if (config->drdy_pin != ADS1248_DRDY_PIN_NONE)
+    {
+        res_drdy = gpio_init(config->drdy_pin, (gpio_config_t){.mode=GPIO_MODE_INPUT});
+    }
+
+    if ((res_start != 0) || (res_reset != 0) || (res_spi != 0) || (res_drdy != 0))
     {
         #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
             sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Error during the initialization!");
@@ -81,6 +136,9 @@ int ads1248_init(ads1248_config_t *config)
 
     ads1248_write_cmd(config, ADS1248_CMD_SDATAC, NULL, 0);
 
+    /* Reset values (and the factory full-scale calibration) */
+    ads1248_load_regs(config);
+
     ads1248_config_regs(config);
 
     #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
@@ -98,9 +156,32 @@ int ads1248_init(ads1248_config_t *config)
     cmd[0] = ADS1248_CMD_SLEEP;
     spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
 
+    if (config->drdy_pin != ADS1248_DRDY_PIN_NONE)
+    {
+        /* DOUT/DRDY goes low at the end of each conversion */
+        if (gpio_enable_interrupt(config->drdy_pin, GPIO_EDGE_FALLING, ads1248_notify_from_isr) != 0)
+        {
+        #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+            sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Error enabling the DRDY interrupt!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            return ADS1248_ERROR;
+        }
+    }
+
     return 0;
 }
 
+uint8_t ads1248_get_conv_time_ms(uint8_t data_rate)
+{
+    if (data_rate > ADS1248_DR_2000SPS)
+    {
+        data_rate = ADS1248_DR_2000SPS;     /* DR codes above 1001 are also 2000 SPS */
+    }
+
+    return ads1248_conv_time_ms[data_rate];
+}
+
 int ads1248_reset(ads1248_config_t *config, ads1248_reset_mode_t mode)
 {
     if (mode != 0) /* if the reset mode is by command (ADS1248_RESET_CMD = 1) */
@@ -124,42 +205,113 @@ int ads1248_reset(ads1248_config_t *config, ads1248_reset_mode_t mode)
 
 int ads1248_config_regs(ads1248_config_t *config)
 {
-    uint8_t data_config_regs[18];
-    uint8_t dummy[7]={0};
-
-    data_config_regs[0] = ADS1248_CMD_WREG;  /* command WREG plus information to write to the first register MUX0 (0x00) */
-    data_config_regs[1] = 0x03; /* number of bytes minus 1 to be written by WREG command */
-    data_config_regs[2] = (ADS1248_POSITIVE_INPUTS << 3) | ADS1248_NEGATIVE_INPUT; /* value to register MUX0: burn out detect current off, number of positive input channel shifted and negative channel AIN7 */
-    data_config_regs[3] = 0x00; /* value to register VBIAS: bias voltage not enabled */
-    data_config_regs[4] = 0x20; /* value to register MUX1: internal reference always on, REFP0 and REFPN0 reference inputs and normal operation */
-    data_config_regs[5] = 0x03; /* value to register SYSO: data output rate of 40 SPS */
-    data_config_regs[6] = 0x00; /* value to register OFC0: standard value on first offset calibration coefficient register */
-    data_config_regs[7] = 0x00; /* value to register OFC1: standard value on second offset calibration coefficient register */
-    data_config_regs[8] = 0x00; /* value to register OFC2: standard value on third offset calibration coefficient register */
-    data_config_regs[9] = 0x00; /* value to register FSC0: standard value on first full-scale calibration coefficient register */
-    data_config_regs[10] = 0x00; /* value to register FSC1: standard value on second full-scale calibration coefficient register */
-    data_config_regs[11] = 0x00; /* value to register FSC2: standard value on third full-scale calibration coefficient register */
-    data_config_regs[12] = 0x02; /* value to register IDAC0: DOUT/DRDY pins functions only as data out and excitation output current magnitude to 100uA */
-    data_config_regs[13] = 0x06; /* value to register IDAC1: excitation outputs 1 to AIN0 and 2 to AIN6 pins */
-    data_config_regs[14] = 0x00; /* value to register GPIOCFG: GPIOS not enabled */
-    data_config_regs[15] = 0x00; /* value to register GPIODIR: GPIOS not enabled */
-    data_config_regs[16] = 0x00; /* value to register GPIODAT: GPIOS not enabled */
-        
-    spi_transfer_no_cs(config->spi_port, data_config_regs, dummy, 6); /* Writes to all registers in one half-duplex SPI communication */
+    uint8_t regs[ADS1248_REG_QTY];
+    uint8_t i = 0;
+
+    /* The calibration registers (OFC and FSC) are kept */
+    for(i = 0; i < ADS1248_REG_QTY; i++)
+    {
+        regs[i] = config->regs[i];
+    }
+
+    regs[ADS1248_REG_MUX0] = (ADS1248_POSITIVE_INPUTS << 3) | ADS1248_NEGATIVE_INPUT; /* burn out detect current off, number of positive input channel shifted and negative channel AIN7 */
+    regs[ADS1248_REG_VBIAS] = 0x00; /* bias voltage not enabled */
+    regs[ADS1248_REG_MUX1] = 0x20; /* internal reference always on, REFP0 and REFPN0 reference inputs and normal operation */
+    regs[ADS1248_REG_SYS0] = config->data_rate & 0x0FU; /* PGA gain of 1 and the configured data output rate */
+    regs[ADS1248_REG_IDAC0] = (config->drdy_pin != ADS1248_DRDY_PIN_NONE) ? (0x02 | ADS1248_IDAC0_DRDY_MODE) : 0x02; /* DOUT/DRDY pin also as data ready (if wired to a GPIO) and excitation output current magnitude to 100uA */
+    regs[ADS1248_REG_IDAC1] = 0x06; /* excitation outputs 1 to AIN0 and 2 to AIN6 pins */
+    regs[ADS1248_REG_GPIOCFG] = 0x00; /* GPIOS not enabled */
+    regs[ADS1248_REG_GPIODIR] = 0x00; /* GPIOS not enabled */
+    regs[ADS1248_REG_GPIODAT] = 0x00; /* GPIOS not enabled */
+
+    return ads1248_write_regs(config, ADS1248_REG_MUX0, regs, ADS1248_REG_QTY);
+}
+
+int ads1248_write_regs(ads1248_config_t *config, uint8_t first, const uint8_t *val, uint8_t n)
+{
+    uint8_t wreg[2U + ADS1248_REG_QTY];
+    uint8_t dummy[2U + ADS1248_REG_QTY];
+    uint8_t i = 0;
+
+    if ((n == 0U) || (first >= ADS1248_REG_QTY) || (n > (ADS1248_REG_QTY - first)))
+    {
+        return -1;
+    }
 
-    data_config_regs[0] = ADS1248_CMD_WREG | 0x0A;  /* command WREG plus information to write to the first register MUX0 (0x00) */
-    data_config_regs[1] = 0x04; /* number of bytes minus 1 to be written by WREG command */
-    data_config_regs[2] = 0x02; /* value to register IDAC0: DOUT/DRDY pins functions only as data out and excitation output current magnitude to 100uA */
-    data_config_regs[3] = 0x06; /* value to register IDAC1: excitation outputs 1 to AIN0 and 2 to AIN6 pins */
-    data_config_regs[4] = 0x00; /* value to register GPIOCFG: GPIOS not enabled */
-    data_config_regs[5] = 0x00; /* value to register GPIODIR: GPIOS not enabled */
-    data_config_regs[6] = 0x00; /* value to register GPIODAT: GPIOS not enabled */
+    while(i < n)
+    {
+        uint8_t len = 0;
 
-    spi_transfer_no_cs(config->spi_port, data_config_regs, dummy, 7);
+        /* Run of adjacent changed registers */
+        while(((i + len) < n) && (((config->regs[first + i + len] ^ val[i + len]) & ads1248_reg_rw_mask[first + i + len]) != 0U))
+        {
+            wreg[2U + len] = val[i + len];
+            config->regs[first + i + len] = val[i + len];
+            len++;
+        }
+
+        if (len == 0U)
+        {
+            i++;    /* Unchanged register */
+            continue;
+        }
+
+        wreg[0] = ADS1248_CMD_WREG | (first + i);   /* WREG command plus the address of the first register of the run */
+        wreg[1] = len - 1U;                         /* number of bytes minus 1 to be written by WREG command */
+
+        spi_transfer_no_cs(config->spi_port, wreg, dummy, 2U + len);
+
+        i += len;
+    }
 
     return 0;
 }
 
+int ads1248_verify_regs(ads1248_config_t *config)
+{
+    uint8_t rd[2U + ADS1248_REG_QTY];
+    uint8_t expected[ADS1248_REG_QTY];
+    uint8_t cmd[1] = {ADS1248_CMD_WAKEUP};
+    uint8_t dummy[1] = {0};
+    uint8_t reg = 0;
+    int err = 0;
+
+    // The registers can not be read in power-down mode
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    ads1248_read_regs(config, rd);
+
+    for(reg = 0; reg < ADS1248_REG_QTY; reg++)
+    {
+        expected[reg] = config->regs[reg];
+
+        /* GPIODAT reads the level of the pins */
+        if (reg == ADS1248_REG_GPIODAT)
+        {
+            continue;
+        }
+
+        if (((rd[2U + reg] ^ config->regs[reg]) & ads1248_reg_rw_mask[reg]) != 0U)
+        {
+            config->regs[reg] = rd[2U + reg];
+            err = -1;
+        }
+    }
+
+    if (err != 0)
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Unexpected register values! Writing them again...");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+
+        /* Only the registers loaded with a different value are written */
+        ads1248_write_regs(config, ADS1248_REG_MUX0, expected, ADS1248_REG_QTY);
+    }
+
+    return err;
+}
+
 int ads1248_read_regs(ads1248_config_t *config, uint8_t *rd)
 {
     uint8_t data_read_regs[18];
@@ -205,39 +357,53 @@ int ads1248_read_regs(ads1248_config_t *config, uint8_t *rd)
 int ads1248_read_data(ads1248_config_t *config, uint8_t *rd, uint8_t positive_channel)
 {
 
-    uint8_t select_channel_to_read[3] = {0};
-    uint8_t select_channel_excitation_current[3] = {0};
+    uint8_t channel_regs[2] = {0};
     uint8_t data_read_conversion[4] = {0};
     uint8_t cmd[2] = {0};
     uint8_t dummy[4]={0};
+    uint8_t conv_time_ms = ads1248_get_conv_time_ms(config->data_rate);
+    bool drdy = (config->drdy_pin != ADS1248_DRDY_PIN_NONE);
 
     // Wake up device
     cmd[0] = ADS1248_CMD_WAKEUP;
     spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
 
-    // Configure desired channel for conversion
-    select_channel_to_read[0] = ADS1248_CMD_WREG; /* WREG command (0x40), since the last byte is zero it will write to the first register MUX0 (0x00) */
-    select_channel_to_read[1] = 0x00;  /* number of bytes minus 1 to be writen by WREG command, in this case 1 byte will be 0 in hex */
-    select_channel_to_read[2] = (positive_channel << 3) | ADS1248_NEGATIVE_INPUT; /* positive channel selection + the negative (reference) channel fixed to be AIN7*/
+    // Configure desired channel for conversion (nothing is written if the channel was already selected)
+    channel_regs[0] = (positive_channel << 3) | ADS1248_NEGATIVE_INPUT; /* MUX0: positive channel selection + the negative (reference) channel fixed to be AIN7*/
+    channel_regs[1] = (positive_channel << 4) | positive_channel; /* IDAC1: output current to selected positive channel*/
 
-    spi_transfer_no_cs(config->spi_port, select_channel_to_read, dummy, 3); /* Multiplexes channel */
+    ads1248_write_regs(config, ADS1248_REG_MUX0, &channel_regs[0], 1);
+    ads1248_write_regs(config, ADS1248_REG_IDAC1, &channel_regs[1], 1);
 
-    select_channel_excitation_current[0] = 0x4B; /* WREG command (0x40) plus information to write to the IDAC1 register (0x4B) */
-    select_channel_excitation_current[1] = 0x00;  /* number  of bytes minus 1 to be writen by WREG command, in this case 1 byte than 0 in hex */
-    select_channel_excitation_current[2] = (positive_channel << 4) | positive_channel; /* output current to selected positive channel*/
-
-    spi_transfer_no_cs(config->spi_port, select_channel_excitation_current, dummy, 3); /* Multiplexes channel */
+    if (drdy)
+    {
+        ads1248_notify_prepare(config);
+    }
 
     // Start a new conversion
     cmd[0] = ADS1248_CMD_SYNC;
     cmd[1] = ADS1248_CMD_SYNC;
     spi_transfer_no_cs(config->spi_port, cmd, dummy, 2);
-    // Set device to enter power down mode
+    // Set device to enter power down mode (after the end of the conversion)
     cmd[0] = ADS1248_CMD_SLEEP;
     spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
 
     // Wait for conversion to finish
-    ads1248_delay(50);
+    if (drdy)
+    {
+        if (ads1248_notify_wait(conv_time_ms + ADS1248_DRDY_MARGIN_MS) != 0)
+        {
+        #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+            sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Timeout waiting the DRDY interrupt!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            return -1;
+        }
+    }
+    else
+    {
+        ads1248_delay(conv_time_ms);
+    }
 
     data_read_conversion[0] = ADS1248_CMD_RDATA; /* commAnd read last ADC conversion */
     data_read_conversion[1] = ADS1248_CMD_NOP; /* 3 no operation commands to clockout data from the device without clocking in a command during SPI duplex communication*/
@@ -251,6 +417,206 @@ int ads1248_read_data(ads1248_config_t *config, uint8_t *rd, uint8_t positive_ch
     return 0;
 }
 
+int ads1248_start_continuous(ads1248_config_t *config)
+{
+    uint8_t cmd[1] = {0};
+    uint8_t dummy[1] = {0};
+
+    // Wake up device (the conversions run continuously while START is high)
+    cmd[0] = ADS1248_CMD_WAKEUP;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    // Each new conversion is placed on DOUT without a RDATA command
+    cmd[0] = ADS1248_CMD_RDATAC;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    return 0;
+}
+
+int ads1248_select_channel(ads1248_config_t *config, uint8_t positive_channel)
+{
+    uint8_t cmd[1] = {0};
+    uint8_t dummy[1] = {0};
+    uint8_t mux0 = (positive_channel << 3) | ADS1248_NEGATIVE_INPUT;
+    uint8_t idac1 = (positive_channel << 4) | positive_channel;
+
+    if (positive_channel > ADS1248_POSITIVE_INPUTS)
+    {
+        return -1;
+    }
+
+    // The registers are written out of the continuous mode (DOUT is not clocked during the WREGs)
+    cmd[0] = ADS1248_CMD_SDATAC;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    ads1248_write_regs(config, ADS1248_REG_IDAC1, &idac1, 1); /* moves the excitation current before the input */
+
+    ads1248_write_regs(config, ADS1248_REG_MUX0, &mux0, 1); /* a write to MUX0 restarts the conversion */
+
+    // Drops the DRDY of the aborted conversion of the previous channel
+    if (config->drdy_pin != ADS1248_DRDY_PIN_NONE)
+    {
+        ads1248_notify_prepare(config);
+    }
+
+    cmd[0] = ADS1248_CMD_RDATAC;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    return 0;
+}
+
+int ads1248_read_continuous(ads1248_config_t *config, uint8_t *rd)
+{
+    uint8_t data_read_conversion[3] = {ADS1248_CMD_NOP, ADS1248_CMD_NOP, ADS1248_CMD_NOP};
+    uint8_t conv_time_ms = ads1248_get_conv_time_ms(config->data_rate);
+
+    // Wait for the next conversion to finish
+    if (config->drdy_pin != ADS1248_DRDY_PIN_NONE)
+    {
+        /* Up to two conversions, in case the edge of the next conversion was cleared by a late re-arm */
+        if (ads1248_notify_wait((2U * conv_time_ms) + ADS1248_DRDY_MARGIN_MS) != 0)
+        {
+        #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+            sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Timeout waiting the DRDY interrupt!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            return -1;
+        }
+    }
+    else
+    {
+        ads1248_delay(conv_time_ms);
+    }
+
+    // 24 SCLKs of NOPs clock out the conversion result
+    spi_transfer_no_cs(config->spi_port, data_read_conversion, rd, 3);
+
+    // Arms the wait of the next conversion
+    if (config->drdy_pin != ADS1248_DRDY_PIN_NONE)
+    {
+        ads1248_notify_prepare(config);
+    }
+
+    return 0;
+}
+
+int ads1248_stop_continuous(ads1248_config_t *config)
+{
+    uint8_t cmd[1] = {0};
+    uint8_t dummy[1] = {0};
+
+    cmd[0] = ADS1248_CMD_SDATAC;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    // Power down until the next scan
+    cmd[0] = ADS1248_CMD_SLEEP;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    return 0;
+}
+
+int ads1248_calibrate(ads1248_config_t *config, ads1248_cmd_t cal)
+{
+    uint8_t rd[2U + ADS1248_REG_QTY];
+    uint8_t cmd[1] = {0};
+    uint8_t dummy[1] = {0};
+    uint8_t conv_time_ms = ads1248_get_conv_time_ms(config->data_rate);
+    bool drdy = (config->drdy_pin != ADS1248_DRDY_PIN_NONE);
+    uint8_t reg = 0;
+
+    if ((cal != ADS1248_CMD_SELFOCAL) && (cal != ADS1248_CMD_SYSOCAL) && (cal != ADS1248_CMD_SYSGCAL))
+    {
+        return -1;
+    }
+
+    // Wake up device
+    cmd[0] = ADS1248_CMD_WAKEUP;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    if (drdy)
+    {
+        ads1248_notify_prepare(config);
+    }
+
+    cmd[0] = cal;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    // Wait for the calibration to finish (DRDY goes low at its end)
+    if (drdy)
+    {
+        if (ads1248_notify_wait((ADS1248_CAL_CONV_QTY * conv_time_ms) + ADS1248_DRDY_MARGIN_MS) != 0)
+        {
+        #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+            sys_log_print_event_from_module(SYS_LOG_ERROR, ADS1248_MODULE_NAME, "Timeout waiting the end of the calibration!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            return -1;
+        }
+    }
+    else
+    {
+        for(reg = 0; reg < ADS1248_CAL_CONV_QTY; reg++)
+        {
+            ads1248_delay(conv_time_ms);
+        }
+    }
+
+    // The device updates the OFC or the FSC registers
+    ads1248_read_regs(config, rd);
+
+    for(reg = ADS1248_REG_OFC0; reg <= ADS1248_REG_FSC2; reg++)
+    {
+        config->regs[reg] = rd[2U + reg];
+    }
+
+    // Power down until the next conversion
+    cmd[0] = ADS1248_CMD_SLEEP;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    return 0;
+}
+
+int ads1248_get_cal(ads1248_config_t *config, ads1248_cal_t *cal)
+{
+    uint32_t ofc = ((uint32_t)config->regs[ADS1248_REG_OFC2] << 16) | ((uint32_t)config->regs[ADS1248_REG_OFC1] << 8) | (uint32_t)config->regs[ADS1248_REG_OFC0];
+
+    /* Sign extension of the 24-bit offset */
+    cal->offset = (int32_t)((ofc & 0x00800000UL) ? (ofc | 0xFF000000UL) : ofc);
+    cal->full_scale = ((uint32_t)config->regs[ADS1248_REG_FSC2] << 16) | ((uint32_t)config->regs[ADS1248_REG_FSC1] << 8) | (uint32_t)config->regs[ADS1248_REG_FSC0];
+
+    return 0;
+}
+
+int ads1248_set_cal(ads1248_config_t *config, ads1248_cal_t cal)
+{
+    uint8_t regs[6];
+    uint8_t cmd[1] = {ADS1248_CMD_WAKEUP};
+    uint8_t dummy[1] = {0};
+
+    if ((cal.offset < -8388608L) || (cal.offset > 8388607L) || (cal.full_scale > 0x00FFFFFFUL))
+    {
+        return -1;
+    }
+
+    /* The OFC and FSC registers are LSB first */
+    regs[0] = (uint32_t)cal.offset & 0xFFU;
+    regs[1] = ((uint32_t)cal.offset >> 8) & 0xFFU;
+    regs[2] = ((uint32_t)cal.offset >> 16) & 0xFFU;
+    regs[3] = cal.full_scale & 0xFFU;
+    regs[4] = (cal.full_scale >> 8) & 0xFFU;
+    regs[5] = (cal.full_scale >> 16) & 0xFFU;
+
+    // The registers can not be written in power-down mode
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    ads1248_write_regs(config, ADS1248_REG_OFC0, regs, 6);
+
+    cmd[0] = ADS1248_CMD_SLEEP;
+    spi_transfer_no_cs(config->spi_port, cmd, dummy, 1);
+
+    return 0;
+}
+
 int ads1248_write_cmd(ads1248_config_t *config, ads1248_cmd_t cmd, uint8_t *rd, uint8_t positive_channel)
 {
     uint8_t dummy[1]={0};
@@ -265,9 +631,8 @@ int ads1248_write_cmd(ads1248_config_t *config, ads1248_cmd_t cmd, uint8_t *rd,
             ads1248_delay(1);
             break;
         case ADS1248_CMD_RDATA:
-            ads1248_read_data(config, rd, positive_channel);
-            ads1248_delay(1);
-            break;
+            /* The next command can follow the data read without a delay */
+            return ads1248_read_data(config, rd, positive_channel);
         case ADS1248_CMD_WAKEUP:
             if(gpio_get_state(config->start_pin) != true)
             {
@@ -299,4 +664,17 @@ int ads1248_set_powerdown_mode(ads1248_config_t *config, ads1248_power_down_t mo
     return 0;
 }
 
+static void ads1248_load_regs(ads1248_config_t *config)
+{
+    uint8_t rd[2U + ADS1248_REG_QTY];
+    uint8_t reg = 0;
+
+    ads1248_read_regs(config, rd);
+
+    for(reg = 0; reg < ADS1248_REG_QTY; reg++)
+    {
+        config->regs[reg] = rd[2U + reg];
+    }
+}
+
 /** \} End of ads1248 group */
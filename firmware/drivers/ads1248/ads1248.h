@@ -26,9 +26,9 @@
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * \author Yan Castro de Azeredo <yan.ufsceel@gmail.com>
  * 
- * \version 0.2.33
+ * \version 0.2.37
  * 
- * \date 2021/03/09
+ * \date 2026/10/17
  * 
  * \defgroup ads1248 ADS1248
  * \ingroup drivers
@@ -45,6 +45,11 @@
 
 #define ADS1248_RANGE       16777216    /**< ADS1248 resolution (24-bit). */
 
+#define ADS1248_NOTIFY_BIT          (1UL << 30UL)   /**< Task notification bit reserved to the end of conversion (DRDY). */
+#define ADS1248_DRDY_PIN_NONE       0xFFU           /**< No GPIO wired to DOUT/DRDY (the conversion time is waited instead). */
+#define ADS1248_DRDY_MARGIN_MS      5U              /**< Margin over the conversion time before a DRDY timeout in milliseconds. */
+#define ADS1248_CAL_CONV_QTY        4U              /**< Duration of a calibration in conversion periods (datasheet table "Calibration time"). */
+
 #define ADS1248_POSITIVE_INPUTS    0x06 /**< Number of ADS1248 positive input channels for ADC measurements */
 #define ADS1248_NEGATIVE_INPUT     0x07 /**< ADS1248 negative (reference) input channel for ADC measurements */
 
@@ -63,6 +68,41 @@
 #define ADS1248_CMD_SYSGCAL     0x61    /**< System gain calibration. */
 #define ADS1248_CMD_SELFOCAL    0x62    /**< Self offset calibration. */
 
+/* Registers */
+#define ADS1248_REG_MUX0        0x00    /**< Multiplexer control register 0. */
+#define ADS1248_REG_VBIAS       0x01    /**< Bias voltage register. */
+#define ADS1248_REG_MUX1        0x02    /**< Multiplexer control register 1. */
+#define ADS1248_REG_SYS0        0x03    /**< System control register 0. */
+#define ADS1248_REG_OFC0        0x04    /**< Offset calibration coefficient register 0. */
+#define ADS1248_REG_OFC1        0x05    /**< Offset calibration coefficient register 1. */
+#define ADS1248_REG_OFC2        0x06    /**< Offset calibration coefficient register 2. */
+#define ADS1248_REG_FSC0        0x07    /**< Full-scale calibration coefficient register 0. */
+#define ADS1248_REG_FSC1        0x08    /**< Full-scale calibration coefficient register 1. */
+#define ADS1248_REG_FSC2        0x09    /**< Full-scale calibration coefficient register 2. */
+#define ADS1248_REG_IDAC0       0x0A    /**< IDAC control register 0. */
+#define ADS1248_REG_IDAC1       0x0B    /**< IDAC control register 1. */
+#define ADS1248_REG_GPIOCFG     0x0C    /**< GPIO configuration register. */
+#define ADS1248_REG_GPIODIR     0x0D    /**< GPIO direction register. */
+#define ADS1248_REG_GPIODAT     0x0E    /**< GPIO data register. */
+#define ADS1248_REG_QTY         15U     /**< Number of registers. */
+
+/**
+ * \brief Data rates (DR bits of the SYS0 register).
+ */
+typedef enum
+{
+    ADS1248_DR_5SPS=0,                  /**< 5 samples per second. */
+    ADS1248_DR_10SPS,                   /**< 10 samples per second. */
+    ADS1248_DR_20SPS,                   /**< 20 samples per second. */
+    ADS1248_DR_40SPS,                   /**< 40 samples per second. */
+    ADS1248_DR_80SPS,                   /**< 80 samples per second. */
+    ADS1248_DR_160SPS,                  /**< 160 samples per second. */
+    ADS1248_DR_320SPS,                  /**< 320 samples per second. */
+    ADS1248_DR_640SPS,                  /**< 640 samples per second. */
+    ADS1248_DR_1000SPS,                 /**< 1000 samples per second. */
+    ADS1248_DR_2000SPS                  /**< 2000 samples per second. */
+} ads1248_data_rate_e;
+
 /**
  * \brief ADS1248 configuration parameters.
  */
@@ -73,8 +113,20 @@ typedef struct
     spi_config_t spi_config;            /**< SPI port configuration. */
     gpio_pin_t reset_pin;               /**< Reset pin. */
     gpio_pin_t start_pin;               /**< Start pin. */
+    gpio_pin_t drdy_pin;                /**< Pin wired to DOUT/DRDY, with interrupt (or ADS1248_DRDY_PIN_NONE). */
+    uint8_t data_rate;                  /**< Data rate (ads1248_data_rate_e). */
+    uint8_t regs[ADS1248_REG_QTY];      /**< Shadow copy of the registers (loaded during the initialization, updated on each write). */
 } ads1248_config_t;
 
+/**
+ * \brief ADS1248 calibration coefficients.
+ */
+typedef struct
+{
+    int32_t offset;                     /**< Offset calibration coefficient (OFC registers, 24-bit two's complement). */
+    uint32_t full_scale;                /**< Full-scale calibration coefficient (FSC registers, 24-bit). */
+} ads1248_cal_t;
+
 /**
  * \brief ADS1248 command type.
  */
@@ -127,6 +179,46 @@ typedef enum
  */
 void ads1248_delay(uint8_t ms);
 
+/**
+ * \brief Gets the time of a conversion started by SYNC (filter settled).
+ *
+ * \param[in] data_rate is the data rate (ads1248_data_rate_e).
+ *
+ * \return The conversion time in milliseconds (rounded up).
+ */
+uint8_t ads1248_get_conv_time_ms(uint8_t data_rate);
+
+/**
+ * \brief Prepares the current task to wait a DRDY notification.
+ *
+ * Must be called before starting the conversion.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \return None.
+ */
+void ads1248_notify_prepare(ads1248_config_t *config);
+
+/**
+ * \brief Waits the DRDY notification (end of conversion).
+ *
+ * The other notifications received by the task while waiting are kept.
+ *
+ * \param[in] timeout_ms is the maximum time to wait in milliseconds (counted from the call).
+ *
+ * \return The status/error code (-1 if the deadline was reached).
+ */
+int ads1248_notify_wait(uint16_t timeout_ms);
+
+/**
+ * \brief Notifies the task waiting the end of conversion.
+ *
+ * \note Called from the GPIO ISR of the DRDY pin.
+ *
+ * \return None.
+ */
+void ads1248_notify_from_isr(void);
+
 /**
  * \brief ADS1248 initialization.
  * 
@@ -141,6 +233,8 @@ void ads1248_delay(uint8_t ms);
  * If the driver debug is enabladed sends ADS1248_CMD_RREG: Reads the device's configuration registers values for sanity check.
  * - ADS1248_CMD_SYNC: Starts new ADC conversion.
  *
+ * If a DRDY pin is configured, its falling edge interrupt is enabled to notify the end of the conversions.
+ *
  * \param[in,out] config is a pointer to the ADS1248 configuration parameters.
  *
  * \return The status/error code.
@@ -169,6 +263,8 @@ int ads1248_reset(ads1248_config_t *config, ads1248_reset_mode_t mode);
 /**
  * \brief Configuration of the ADS1248 registers.
  *
+ * The registers are written with ads1248_write_regs(), so only the ones different from the shadow copy are sent. The calibration registers (OFC and FSC) are kept.
+ *
  * To configure the ADS1248 the ADS1248_CMD_WREG command must be sent via half-duplex SPI communication to the device.
  * The first byte is the command itself (0x40), if the last 4 bits are not specified it will begin writing to the first register MUX0 (0x00).
  * The second byte is the leght of bytes to be sent minus 1. ADS1248 has 15 configuring registers, so to write to all registers on one SPI transmission it needs 0x0E (15 - 1 = 14 in decimal). 
@@ -198,15 +294,48 @@ int ads1248_config_regs(ads1248_config_t *config);
  */
 int ads1248_read_regs(ads1248_config_t *config, uint8_t *rd);
 
+/**
+ * \brief Writes registers through the shadow copy.
+ *
+ * Only the registers with a value different from the shadow copy are written (the read-only bits are ignored), and each run of adjacent changed registers is written with a single multi-byte ADS1248_CMD_WREG command.
+ * The device must be out of the read data continuous mode.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in] first is the address of the first register.
+ *
+ * \param[in] val is the values of the registers first to (first + n - 1).
+ *
+ * \param[in] n is the number of registers.
+ *
+ * \return The status/error code.
+ */
+int ads1248_write_regs(ads1248_config_t *config, uint8_t first, const uint8_t *val, uint8_t n);
+
+/**
+ * \brief Verifies the registers against the shadow copy.
+ *
+ * The device is woken up and all the registers are read with a single ADS1248_CMD_RREG burst. The registers that differ from the shadow copy (ex.: after a brown-out reset or an upset) are written again.
+ * The GPIODAT register is not verified, since it reads the level of the input pins.
+ * The device must be out of the read data continuous mode.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \return The status/error code (-1 if a register was different and had to be written again).
+ */
+int ads1248_verify_regs(ads1248_config_t *config);
+
 /**
  * \brief Reads last conversion of ADS1248.
  *
- * To select the channel for the data read, the values of the MUX0 register (responsible for multiplexing the input ADC read pin) and IDAC1 register (responsible for selecting the output excitation current pin) must be changed.
+ * To select the channel for the data read, the values of the MUX0 register (responsible for multiplexing the input ADC read pin) and IDAC1 register (responsible for selecting the output excitation current pin) must be changed (only if the channel is different from the last read, see ads1248_write_regs()).
  * For this the ADS1248_CMD_WREG command is sent not needing information regarding the register adress since the MUX0 is the first register WREG writes to after been sent.  
  * Next is sent the size of byte to be writen -1, for just one byte it will be 0x00 and them the data value to be writen in one byte format acoording to the positive input channel selected. 
  * The negative channel is defined in a macro ADS1248_NEGATIVE_INPUT.
  * To skip writing all other registers and get to IDAC1 the WREG command is sent againd, size of byte to be writen -1 (same as before 0x00) and the data value to be writen that will be the positive input channel selected. 
  *
+ * The conversion is started with ADS1248_CMD_SYNC, and its end is notified by the DRDY interrupt (or the conversion time of the configured data rate is waited, without a DRDY pin).
+ *
  * Finally, to read the ADS1248 last conversion the ADS1248_CMD_RDATA command must be sent via full-duplex SPI communication to the device.
  * The first byte is the command itself (0x40), the conversion result is read out by sending 3 no operation command (NOP) during 24 SCLKs, each NOP is sent in 8 SCLKs. 
  *
@@ -220,6 +349,104 @@ int ads1248_read_regs(ads1248_config_t *config, uint8_t *rd);
  */
 int ads1248_read_data(ads1248_config_t *config, uint8_t *rd, uint8_t positive_channel);
 
+/**
+ * \brief Starts the continuous conversions (read data continuous mode).
+ *
+ * The device is woken up (ADS1248_CMD_WAKEUP) and the ADS1248_CMD_RDATAC command is sent, so each new conversion result is clocked out with 24 SCLKs of NOPs, without a RDATA command.
+ * The channel must be selected with ads1248_select_channel() before reading the conversions.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \return The status/error code.
+ */
+int ads1248_start_continuous(ads1248_config_t *config);
+
+/**
+ * \brief Selects the channel of the continuous conversions.
+ *
+ * The continuous mode is stopped (ADS1248_CMD_SDATAC) to write the IDAC1 and MUX0 registers, and restarted after them (ADS1248_CMD_RDATAC).
+ * The write to MUX0 restarts the conversion, but the first result after a channel switch must be discarded, since the excitation current and the input filter are still settling.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in] positive_channel is the positive input channel (the excitation current is also routed to it).
+ *
+ * \return The status/error code.
+ */
+int ads1248_select_channel(ads1248_config_t *config, uint8_t positive_channel);
+
+/**
+ * \brief Reads the next conversion in the continuous mode.
+ *
+ * Waits the next DRDY notification (or the conversion time of the data rate, without a DRDY pin) and clocks out the result.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in,out] rd is a pointer to store the 3 bytes of the conversion result (MSB first).
+ *
+ * \return The status/error code.
+ */
+int ads1248_read_continuous(ads1248_config_t *config, uint8_t *rd);
+
+/**
+ * \brief Stops the continuous conversions.
+ *
+ * Sends ADS1248_CMD_SDATAC and puts the device in power-down mode (ADS1248_CMD_SLEEP) until the next ads1248_start_continuous().
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \return The status/error code.
+ */
+int ads1248_stop_continuous(ads1248_config_t *config);
+
+/**
+ * \brief Runs a calibration of the device.
+ *
+ * The device is woken up and the calibration command is sent. The end of the calibration is notified by the DRDY interrupt (or ADS1248_CAL_CONV_QTY conversion periods are waited, without a DRDY pin).
+ * The resulting coefficients are read back into the shadow copy, and the device is put in power-down mode.
+ * The self offset calibration shorts the inputs internally, the system calibrations use the input of the selected channel (0 V for the offset and the full-scale voltage for the gain).
+ * The device must be out of the read data continuous mode.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in] cal is the calibration command. It can be:
+ * \parblock
+ *      -\b ADS1248_CMD_SELFOCAL
+ *      -\b ADS1248_CMD_SYSOCAL
+ *      -\b ADS1248_CMD_SYSGCAL
+ *      .
+ * \endparblock
+ *
+ * \return The status/error code.
+ */
+int ads1248_calibrate(ads1248_config_t *config, ads1248_cmd_t cal);
+
+/**
+ * \brief Gets the calibration coefficients (from the shadow copy of the registers).
+ *
+ * \param[in] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in,out] cal is a pointer to store the coefficients.
+ *
+ * \return The status/error code.
+ */
+int ads1248_get_cal(ads1248_config_t *config, ads1248_cal_t *cal);
+
+/**
+ * \brief Sets the calibration coefficients.
+ *
+ * Restores coefficients of a previous calibration (ex.: stored in a non-volatile memory), without running it again.
+ * Only the OFC and FSC registers with a different value are written (see ads1248_write_regs()).
+ * The device must be out of the read data continuous mode.
+ *
+ * \param[in,out] config is a pointer to the configuration parameters of the device.
+ *
+ * \param[in] cal is the coefficients to write.
+ *
+ * \return The status/error code.
+ */
+int ads1248_set_cal(ads1248_config_t *config, ads1248_cal_t cal);
+
 /**
  * \brief Writes a command to the device.
  *
@@ -0,0 +1,104 @@
+/*
+ * ads1248_notify.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief ADS1248 end of conversion (DRDY) notification implementation.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup ads1248_notify Notification
+ * \ingroup ads1248
+ * \{
+ */
+
+#include <stddef.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "ads1248.h"
+
+static volatile TaskHandle_t ads1248_notify_task = NULL;
+
+static volatile bool ads1248_notify_done = false;
+
+void ads1248_notify_prepare(ads1248_config_t *config)
+{
+    ads1248_notify_done = false;
+    ads1248_notify_task = xTaskGetCurrentTaskHandle();
+
+    /* Edge of a previous conversion */
+    gpio_clear_interrupt(config->drdy_pin);
+}
+
+int ads1248_notify_wait(uint16_t timeout_ms)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    uint32_t others = 0;
+
+    while(!ads1248_notify_done)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        uint32_t notified_value = 0;
+
+        if (elapsed >= timeout)
+        {
+            break;
+        }
+
+        /* Other notifications (ex.: data buffer subscriptions) can wake the task before the deadline */
+        if (xTaskNotifyWait(0UL, ADS1248_NOTIFY_BIT, &notified_value, timeout - elapsed) == pdPASS)
+        {
+            others |= notified_value & ~ADS1248_NOTIFY_BIT;
+        }
+    }
+
+    ads1248_notify_task = NULL;
+
+    /* Gives back the notifications received while waiting the conversion */
+    if (others != 0U)
+    {
+        xTaskNotify(xTaskGetCurrentTaskHandle(), others, eSetBits);
+    }
+
+    return ads1248_notify_done ? 0 : -1;
+}
+
+void ads1248_notify_from_isr(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    ads1248_notify_done = true;
+
+    if (ads1248_notify_task != NULL)
+    {
+        xTaskNotifyFromISR(ads1248_notify_task, ADS1248_NOTIFY_BIT, eSetBits, &xHigherPriorityTaskWoken);
+    }
+
+    /* Force a context switch if the waiting task has a higher priority */
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/** \} End of ads1248_notify group */
@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.1
+ * \version 0.1.2
  * 
- * \date 2020/10/21
+ * \date 2026/10/17
  * 
  * \defgroup drivers Drivers
  * \{
@@ -43,6 +43,7 @@
 #include "gpio/gpio.h"
 #include "i2c/i2c.h"
 #include "max9934/max9934.h"
+#include "mpy/mpy.h"
 #include "onewire/onewire.h"
 #include "spi/spi.h"
 #include "tca4311a/tca4311a.h"
@@ -27,9 +27,9 @@
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * \author Ramon de Araujo Borba     <ramonborba97@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.3
  *
- * \date 2021/08/17
+ * \date 2026/10/17
  *
  * \addtogroup ds277Xg
  * \{
@@ -37,6 +37,7 @@
 
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
+#include <system/fixedpt/fixedpt.h>
 
 #include "ds277Xg.h"
 
@@ -102,7 +103,7 @@ static int ds277Xg_read_voltage_raw(ds277Xg_config_t *config, int16_t *voltage_r
  *                       MSB                      |                    LSB              
  * 
  * \param[in] raw The raw voltage value.
- * \return float Converted voltage in mV.
+ * \return Converted voltage in mV.
  */
 static int16_t ds277Xg_voltage_raw_to_mv(int16_t raw);
 
@@ -234,6 +235,10 @@ static int ds277Xg_write_data(ds277Xg_config_t *config, uint8_t *data, uint16_t
 int ds277Xg_init(ds277Xg_config_t *config)
 {
     int err = 0;
+
+    /* Mutex shared by the tasks that access the device */
+    if (!ds277Xg_mutex_create()) {err += -1;}
+
     /* I2C port initialization. */
     if (i2c_init(config->port, (i2c_config_t){.speed_hz = 100000}) != 0)
     {
@@ -421,7 +426,7 @@ int ds277Xg_read_voltage_raw(ds277Xg_config_t *config, int16_t *voltage_raw, uin
 
 int16_t ds277Xg_voltage_raw_to_mv(int16_t raw)
 {
-    return raw * DS277XG_VOLTAGE_REG_RESOLUTION;
+    return (int16_t)fixedpt_q16_scale(raw, FIXEDPT_Q16_CONST(DS277XG_VOLTAGE_REG_RESOLUTION));
 }
 
 int ds277Xg_read_voltage_mv(ds277Xg_config_t *config, int16_t *voltage_mv, uint8_t battery_select)
@@ -454,7 +459,7 @@ int ds277Xg_read_temperature_raw(ds277Xg_config_t *config, int16_t *temp_raw)
 
 uint16_t ds277Xg_temperature_raw_to_kelvin(int16_t raw)
 {
-    return ((raw * DS277XG_TEMPERATURE_REG_RESOLUTION)/* Temperature in Celsius */ + 273.15 /* Celsius to Kelvin conversion */);
+    return (uint16_t)fixedpt_q16_to_int(fixedpt_q16_add(fixedpt_q16_mul(FIXEDPT_Q16_INT(raw), FIXEDPT_Q16_CONST(DS277XG_TEMPERATURE_REG_RESOLUTION))/* Temperature in Celsius */, FIXEDPT_Q16_CONST(273.15) /* Celsius to Kelvin conversion */));
 }
 
 int ds277Xg_read_temperature_kelvin(ds277Xg_config_t *config, uint16_t *temp_kelvin)
@@ -494,7 +499,7 @@ int ds277Xg_read_current_raw(ds277Xg_config_t *config, int16_t *current_raw, boo
 
 int16_t ds277Xg_current_raw_to_ma(int16_t raw)
 {
-    return raw * (DS277XG_CURRENT_REG_RESOLUTION / DS277XG_RSENSE) /* current in microamps */ / 1000 /* convert microamps to milliamps */;
+    return (int16_t)fixedpt_q16_scale(raw, FIXEDPT_Q16_CONST((DS277XG_CURRENT_REG_RESOLUTION / DS277XG_RSENSE) /* current in microamps */ / 1000 /* convert microamps to milliamps */));
 }
 
 int ds277Xg_read_current_ma(ds277Xg_config_t *config, int16_t *current_ma, bool read_average)
@@ -525,7 +530,7 @@ int ds277Xg_write_accumulated_current_raw(ds277Xg_config_t *config, uint16_t acc
 
 uint16_t ds277Xg_accumulated_current_mah_to_raw(uint16_t mah)
 {
-    return mah * (DS277XG_RSENSE) / (DS277XG_ACCUMULATED_CURRENT_REG_RESOLUTION / 1000);
+    return (uint16_t)fixedpt_q16_scale(mah, FIXEDPT_Q16_CONST((DS277XG_RSENSE) / (DS277XG_ACCUMULATED_CURRENT_REG_RESOLUTION / 1000)));
 }
 
 int ds277Xg_write_accumulated_current_mah(ds277Xg_config_t *config, uint16_t acc_current_mah)
@@ -550,7 +555,7 @@ int ds277Xg_read_accumulated_current_raw(ds277Xg_config_t *config, uint16_t *acc
 
 uint16_t ds277Xg_accumulated_current_raw_to_mah(uint16_t raw)
 {
-    return raw * DS277XG_ACCUMULATED_CURRENT_REG_RESOLUTION / (DS277XG_RSENSE_MOHMS);
+    return (uint16_t)fixedpt_q16_scale(raw, FIXEDPT_Q16_CONST(DS277XG_ACCUMULATED_CURRENT_REG_RESOLUTION / (DS277XG_RSENSE_MOHMS)));
 }
 
 int ds277Xg_read_accumulated_current_mah(ds277Xg_config_t *config, uint16_t *acc_current_mah)
@@ -604,4 +609,41 @@ int ds277Xg_read_data(ds277Xg_config_t *config, uint8_t target_reg, uint8_t *dat
     return err;
 }
 
+int ds277Xg_read_snapshot(ds277Xg_config_t *config, ds277Xg_snapshot_t *snap)
+{
+    int err = 0;
+    uint8_t blk1[DS277XG_SNAPSHOT_BLOCK_1_SIZE] = {0};
+    uint8_t blk2[DS277XG_SNAPSHOT_BLOCK_2_SIZE] = {0};
+
+    if (ds277Xg_read_data(config, DS277XG_SNAPSHOT_BLOCK_1_REGISTER, blk1, DS277XG_SNAPSHOT_BLOCK_1_SIZE) != 0) {err += -1;}
+    if (ds277Xg_read_data(config, DS277XG_SNAPSHOT_BLOCK_2_REGISTER, blk2, DS277XG_SNAPSHOT_BLOCK_2_SIZE) != 0) {err += -1;}
+
+    if (err != 0)
+    {
+    #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+        sys_log_print_event_from_module(SYS_LOG_ERROR, DS277XG_MODULE_NAME, "Error reading the telemetry registers!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        return err;
+    }
+
+    /* Same decoding of the single register reads, with the offsets of each register in the blocks */
+    snap->protection            = blk1[DS277XG_PROTECTION_REGISTER];
+    snap->status                = blk1[DS277XG_STATUS_REGISTER];
+    snap->raac_raw              = ((uint16_t)blk1[DS277XG_RAAC_REGISTER_MSB] << 8) + blk1[DS277XG_RAAC_REGISTER_LSB];
+    snap->rsac_raw              = ((uint16_t)blk1[DS277XG_RSAC_REGISTER_MSB] << 8) + blk1[DS277XG_RSAC_REGISTER_LSB];
+    snap->rarc                  = blk1[DS277XG_RARC_REGISTER];
+    snap->rsrc                  = blk1[DS277XG_RSRC_REGISTER];
+    snap->average_current_ma    = ds277Xg_current_raw_to_ma((int16_t)(((uint16_t)blk1[DS277XG_AVERAGE_CURRENT_REGISTER_MSB] << 8) + blk1[DS277XG_AVERAGE_CURRENT_REGISTER_LSB]));
+    snap->temperature_kelvin    = ds277Xg_temperature_raw_to_kelvin((int16_t)((((uint16_t)blk1[DS277XG_TEMPERATURE_REGISTER_MSB] << 8) + blk1[DS277XG_TEMPERATURE_REGISTER_LSB]) >> 5U));
+    snap->voltage_mv[0]         = ds277Xg_voltage_raw_to_mv((int16_t)((((uint16_t)blk1[DS277XG_VOLTAGE_REGISTER_MSB_Vin1_Vss] << 8) + blk1[DS277XG_VOLTAGE_REGISTER_LSB_Vin1_Vss]) >> 5U));
+    snap->current_ma            = ds277Xg_current_raw_to_ma((int16_t)(((uint16_t)blk1[DS277XG_CURRENT_REGISTER_MSB] << 8) + blk1[DS277XG_CURRENT_REGISTER_LSB]));
+    snap->acc_current_mah       = ds277Xg_accumulated_current_raw_to_mah(((uint16_t)blk1[DS277XG_ACCUMULATED_CURRENT_MSB] << 8) + blk1[DS277XG_ACCUMULATED_CURRENT_LSB]);
+
+    snap->voltage_mv[1]         = ds277Xg_voltage_raw_to_mv((int16_t)((((uint16_t)blk2[DS277XG_VOLTAGE_REGISTER_MSB_Vin2_Vin1 - DS277XG_SNAPSHOT_BLOCK_2_REGISTER] << 8) + blk2[DS277XG_VOLTAGE_REGISTER_LSB_Vin2_Vin1 - DS277XG_SNAPSHOT_BLOCK_2_REGISTER]) >> 5U));
+    snap->cycle_counter         = blk2[DS277XG_CYCLE_COUNTER_REGISTER - DS277XG_SNAPSHOT_BLOCK_2_REGISTER];
+
+    return 0;
+}
+
 /** \} End of ds277Xg group */
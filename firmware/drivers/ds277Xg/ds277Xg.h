@@ -26,9 +26,9 @@
  * \author Vinicius Pimenta Bernardo    <viniciuspibi@gmail.com>
  * \author Ramon de Araujo Borba        <ramonborba97@gmail.com>
  * 
- * \version 0.4.0
+ * \version 0.4.2
  * 
- * \date 2021/08/17
+ * \date 2026/10/17
  * 
  * \defgroup ds277Xg DS277XG
  * \ingroup drivers
@@ -242,6 +242,14 @@
 // Write registers.
 #define DS277XG_TWO_WIRE_COMMAND_REGISTER                       0xFE
 
+/**
+ * \brief Contiguous blocks of the telemetry registers (read with a single transaction each).
+ */
+#define DS277XG_SNAPSHOT_BLOCK_1_REGISTER                       DS277XG_PROTECTION_REGISTER             /* Protection to accumulated current LSB (0x00 to 0x11) */
+#define DS277XG_SNAPSHOT_BLOCK_1_SIZE                           18U
+#define DS277XG_SNAPSHOT_BLOCK_2_REGISTER                       DS277XG_VOLTAGE_REGISTER_MSB_Vin2_Vin1  /* Cell 2 voltage and cycle counter (0x1C to 0x1E) */
+#define DS277XG_SNAPSHOT_BLOCK_2_SIZE                           3U
+
 /**
  * \brief Function commands.
  */
@@ -268,6 +276,25 @@ typedef struct
     i2c_slave_adr_t slave_adr;
 } ds277Xg_config_t;
 
+/**
+ * \brief Telemetry registers of the DS277XG, decoded from a burst read.
+ */
+typedef struct
+{
+    uint8_t protection;                 /**< Protection register. */
+    uint8_t status;                     /**< Status register. */
+    uint16_t raac_raw;                  /**< Remaining active absolute capacity (1.6 mAh/LSB). */
+    uint16_t rsac_raw;                  /**< Remaining standby absolute capacity (1.6 mAh/LSB). */
+    uint8_t rarc;                       /**< Remaining active relative capacity in %. */
+    uint8_t rsrc;                       /**< Remaining standby relative capacity in %. */
+    int16_t average_current_ma;         /**< Average current in mA. */
+    uint16_t temperature_kelvin;        /**< Temperature in kelvin. */
+    int16_t voltage_mv[2];              /**< Voltages of the cell 1 (Vin1-Vss) and of the cell 2 (Vin2-Vin1) in mV. */
+    int16_t current_ma;                 /**< Instantaneous current in mA. */
+    uint16_t acc_current_mah;           /**< Accumulated current in mAh. */
+    uint8_t cycle_counter;              /**< Cycle counter register (2 cycles/LSB). */
+} ds277Xg_snapshot_t;
+
 /**
  * \brief
  * 
@@ -327,6 +354,40 @@ int ds277Xg_read_accumulated_current_mah(ds277Xg_config_t *config, uint16_t *acc
  */
 int ds277Xg_read_data(ds277Xg_config_t *config, uint8_t target_reg, uint8_t *data, uint16_t len);
 
+/**
+ * \brief Reads all the telemetry registers of the DS277XG.
+ *
+ * The registers are read in two burst transactions (0x00 to 0x11 and 0x1C to 0x1E) instead of
+ * one transaction per value, and decoded from the read buffers. The MSB and LSB of each value
+ * are also read in the same transaction.
+ *
+ * \param[in] config DS277XG configuration parameters.
+ * \param[in,out] snap Pointer to store the decoded registers.
+ * \return int The status/error code.
+ */
+int ds277Xg_read_snapshot(ds277Xg_config_t *config, ds277Xg_snapshot_t *snap);
+
+/**
+ * \brief Creates a mutex to use the DS277XG (shared by the tasks that read the battery monitor).
+ *
+ * \return TRUE/FALSE if successful or not.
+ */
+bool ds277Xg_mutex_create(void);
+
+/**
+ * \brief Holds the resource (DS277XG).
+ *
+ * \return TRUE/FALSE if successful or not.
+ */
+bool ds277Xg_mutex_take(void);
+
+/**
+ * \brief Frees the resource (DS277XG).
+ *
+ * \return TRUE/FALSE if successful or not.
+ */
+bool ds277Xg_mutex_give(void);
+
 #endif /* DS277XG_H_ */
 
 /** \} End of ds277Xg group */
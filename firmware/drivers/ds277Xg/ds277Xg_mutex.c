@@ -0,0 +1,102 @@
+/*
+ * ds277Xg_mutex.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief DS277XG mutex implementation.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup ds277Xg_mutex Mutex
+ * \ingroup ds277Xg
+ * \{
+ */
+
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+#include <system/sys_log/sys_log.h>
+
+#include "ds277Xg.h"
+
+#define DS277XG_MUTEX_WAIT_TIME_MS      100
+
+SemaphoreHandle_t xDS277XgSemaphore = NULL;
+
+bool ds277Xg_mutex_create(void)
+{
+    if (xDS277XgSemaphore != NULL)
+    {
+        return true;
+    }
+
+    /* Create a mutex type semaphore */
+    xDS277XgSemaphore = xSemaphoreCreateMutex();
+
+    if (xDS277XgSemaphore == NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, DS277XG_MODULE_NAME, "Error creating a mutex!");
+        sys_log_new_line();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool ds277Xg_mutex_take(void)
+{
+    if (xDS277XgSemaphore != NULL)
+    {
+        /* See if we can obtain the semaphore. If the semaphore is not */
+        /* available wait DS277XG_MUTEX_WAIT_TIME_MS ms to see if it becomes free */
+        if (xSemaphoreTake(xDS277XgSemaphore, pdMS_TO_TICKS(DS277XG_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool ds277Xg_mutex_give(void)
+{
+    if (xDS277XgSemaphore != NULL)
+    {
+        xSemaphoreGive(xDS277XgSemaphore);
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/** \} End of ds277Xg_mutex group */
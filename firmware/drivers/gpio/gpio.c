@@ -25,14 +25,16 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.0
+ * \version 0.1.1
  * 
- * \date 2020/10/24
+ * \date 2026/10/17
  * 
  * \addtogroup gpio
  * \{
  */
 
+#include <stddef.h>
+
 #include <hal/gpio.h>
 
 #include <config/config.h>
@@ -40,6 +42,37 @@
 
 #include "gpio.h"
 
+#define GPIO_INT_PINS       16U     /**< Pins with interrupt (ports 1 and 2). */
+
+/**
+ * \brief Interrupt callbacks of the pins of the ports 1 and 2.
+ */
+static volatile gpio_isr_t gpio_isr[GPIO_INT_PINS] = {NULL};
+
+/**
+ * \brief Gets the port and the pin mask of a pin with interrupt.
+ *
+ * \param[in] pin is the GPIO pin.
+ *
+ * \param[in,out] msp_port is the port of the pin.
+ *
+ * \param[in,out] msp_pin is the mask of the pin.
+ *
+ * \return The status/error code (-1 if the pin has no interrupt).
+ */
+static int gpio_int_pin(gpio_pin_t pin, uint8_t *msp_port, uint16_t *msp_pin);
+
+/**
+ * \brief Calls the callbacks of a port interrupt.
+ *
+ * \param[in] first is the index of the first pin of the port in gpio_isr.
+ *
+ * \param[in] iv is the value of the interrupt vector register of the port.
+ *
+ * \return None.
+ */
+static void gpio_dispatch(uint8_t first, uint16_t iv);
+
 int gpio_init(gpio_pin_t pin, gpio_config_t config)
 {
     uint8_t msp_port;
@@ -427,4 +460,117 @@ int gpio_toggle(gpio_pin_t pin)
     return 0;
 }
 
+int gpio_enable_interrupt(gpio_pin_t pin, uint8_t edge, gpio_isr_t isr)
+{
+    uint8_t msp_port;
+    uint16_t msp_pin;
+
+    if ((gpio_int_pin(pin, &msp_port, &msp_pin) != 0) || (isr == NULL))
+    {
+    #if CONFIG_DRIVERS_DEBUG_ENABLED == 1
+        sys_log_print_event_from_module(SYS_LOG_ERROR, GPIO_MODULE_NAME, "Invalid pin to enable the interrupt!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        return -1;  /* Invalid GPIO pin */
+    }
+
+    gpio_isr[pin] = isr;
+
+    GPIO_selectInterruptEdge(msp_port, msp_pin, (edge == GPIO_EDGE_FALLING) ? GPIO_HIGH_TO_LOW_TRANSITION : GPIO_LOW_TO_HIGH_TRANSITION);
+
+    /* The edge selection can set the flag */
+    GPIO_clearInterrupt(msp_port, msp_pin);
+    GPIO_enableInterrupt(msp_port, msp_pin);
+
+    return 0;
+}
+
+int gpio_disable_interrupt(gpio_pin_t pin)
+{
+    uint8_t msp_port;
+    uint16_t msp_pin;
+
+    if (gpio_int_pin(pin, &msp_port, &msp_pin) != 0)
+    {
+        return -1;  /* Invalid GPIO pin */
+    }
+
+    GPIO_disableInterrupt(msp_port, msp_pin);
+    GPIO_clearInterrupt(msp_port, msp_pin);
+
+    gpio_isr[pin] = NULL;
+
+    return 0;
+}
+
+int gpio_clear_interrupt(gpio_pin_t pin)
+{
+    uint8_t msp_port;
+    uint16_t msp_pin;
+
+    if (gpio_int_pin(pin, &msp_port, &msp_pin) != 0)
+    {
+        return -1;  /* Invalid GPIO pin */
+    }
+
+    GPIO_clearInterrupt(msp_port, msp_pin);
+
+    return 0;
+}
+
+static int gpio_int_pin(gpio_pin_t pin, uint8_t *msp_port, uint16_t *msp_pin)
+{
+    if (pin >= GPIO_INT_PINS)
+    {
+        return -1;
+    }
+
+    *msp_port = (pin < GPIO_PIN_8) ? GPIO_PORT_P1 : GPIO_PORT_P2;
+    *msp_pin = 1U << (pin % 8U);
+
+    return 0;
+}
+
+static void gpio_dispatch(uint8_t first, uint16_t iv)
+{
+    /* PxIV: 0 = no interrupt, 2 = pin 0, ..., 16 = pin 7 (reading it clears the highest priority flag) */
+    if ((iv >= 2U) && (iv <= 16U))
+    {
+        gpio_isr_t isr = gpio_isr[first + ((iv - 2U) / 2U)];
+
+        if (isr != NULL)
+        {
+            isr();
+        }
+    }
+}
+
+/**
+ * \brief Port 1 interrupt service routine.
+ */
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector=PORT1_VECTOR
+__interrupt
+#elif defined(__GNUC__)
+__attribute__((interrupt(PORT1_VECTOR)))
+#endif
+void PORT1_ISR(void)
+{
+    gpio_dispatch(GPIO_PIN_0, P1IV);
+}
+
+/**
+ * \brief Port 2 interrupt service routine.
+ */
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector=PORT2_VECTOR
+__interrupt
+#elif defined(__GNUC__)
+__attribute__((interrupt(PORT2_VECTOR)))
+#endif
+void PORT2_ISR(void)
+{
+    gpio_dispatch(GPIO_PIN_8, P2IV);
+}
+
 /** \} End of gpio group */
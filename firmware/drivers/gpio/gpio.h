@@ -25,9 +25,9 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.2.14
+ * \version 0.2.15
  * 
- * \date 2020/10/24
+ * \date 2026/10/17
  * 
  * \defgroup gpio GPIO
  * \ingroup drivers
@@ -131,6 +131,20 @@ typedef enum
     GPIO_MODE_INPUT         /**< GPIO as input. */
 } gpio_modes_e;
 
+/**
+ * \brief GPIO interrupt edges.
+ */
+typedef enum
+{
+    GPIO_EDGE_RISING=0,     /**< Low to high transition. */
+    GPIO_EDGE_FALLING       /**< High to low transition. */
+} gpio_edges_e;
+
+/**
+ * \brief GPIO interrupt callback (called from the port ISR).
+ */
+typedef void (*gpio_isr_t)(void);
+
 /**
  * \brief GPIO pin configuration.
  */
@@ -197,6 +211,44 @@ int gpio_get_state(gpio_pin_t pin);
  */
 int gpio_toggle(gpio_pin_t pin);
 
+/**
+ * \brief Enables the interrupt of a GPIO pin.
+ *
+ * Only the pins of the ports 1 and 2 (GPIO_PIN_0 to GPIO_PIN_15) have interrupts.
+ *
+ * \param[in] pin is the GPIO pin (must be initialized as input).
+ *
+ * \param[in] edge is the transition that triggers the interrupt. It can be:
+ * \parblock
+ *      - GPIO_EDGE_RISING
+ *      - GPIO_EDGE_FALLING
+ *      .
+ * \endparblock
+ *
+ * \param[in] isr is the callback of the interrupt, called from the port ISR.
+ *
+ * \return The status/error code.
+ */
+int gpio_enable_interrupt(gpio_pin_t pin, uint8_t edge, gpio_isr_t isr);
+
+/**
+ * \brief Disables the interrupt of a GPIO pin.
+ *
+ * \param[in] pin is the GPIO pin.
+ *
+ * \return The status/error code.
+ */
+int gpio_disable_interrupt(gpio_pin_t pin);
+
+/**
+ * \brief Clears the pending interrupt flag of a GPIO pin.
+ *
+ * \param[in] pin is the GPIO pin.
+ *
+ * \return The status/error code.
+ */
+int gpio_clear_interrupt(gpio_pin_t pin);
+
 #endif /* GPIO_H_ */
 
 /** \} End of gpio group */
@@ -0,0 +1,278 @@
+/*
+ * mpy.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief MPY32 hardware multiplier driver implementation.
+ *
+ * \version 0.2.0
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup mpy
+ * \{
+ */
+
+#include "mpy.h"
+
+#if MPY_HW_ENABLED == 1
+
+#include <hal/mpy32.h>
+
+/**
+ * \brief Takes the MPY32 registers (disables the interrupts).
+ *
+ * \return The status register before the lock.
+ */
+static uint16_t mpy_lock(void);
+
+/**
+ * \brief Releases the MPY32 registers (restores the interrupts state).
+ *
+ * \param[in] sr is the status register returned by mpy_lock().
+ *
+ * \return None.
+ */
+static void mpy_unlock(uint16_t sr);
+
+int64_t mpy_mul_s32(int32_t a, int32_t b)
+{
+    uint16_t sr = mpy_lock();
+
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLY_SIGNED, (uint32_t)a);
+    MPY32_setOperandTwo32Bit((uint32_t)b);
+
+    /* The 32x32 multiplication takes 7 cycles, shorter than the return from the operand write */
+    int64_t res = (int64_t)MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+uint64_t mpy_mul_u32(uint32_t a, uint32_t b)
+{
+    uint16_t sr = mpy_lock();
+
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLY_UNSIGNED, a);
+    MPY32_setOperandTwo32Bit(b);
+
+    uint64_t res = MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+int64_t mpy_mac_s32(int64_t acc, int32_t a, int32_t b)
+{
+    uint16_t sr = mpy_lock();
+
+    MPY32_preloadResult((uint64_t)acc);
+
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, (uint32_t)a);
+    MPY32_setOperandTwo32Bit((uint32_t)b);
+
+    int64_t res = (int64_t)MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+uint64_t mpy_mac_u32(uint64_t acc, uint32_t a, uint32_t b)
+{
+    uint16_t sr = mpy_lock();
+
+    MPY32_preloadResult(acc);
+
+    MPY32_setOperandOne32Bit(MPY32_MULTIPLYACCUMULATE_UNSIGNED, a);
+    MPY32_setOperandTwo32Bit(b);
+
+    uint64_t res = MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+int64_t mpy_dot_s16(const int16_t *a, const int16_t *b, uint16_t len)
+{
+    uint16_t i = 0;
+    uint16_t sr = mpy_lock();
+
+    MPY32_preloadResult(0);
+
+    /* Sign-extended to 32 bits, so the products accumulate over the 64-bit result (the 16x16 MAC has only 32 bits) */
+    for(i = 0; i < len; i++)
+    {
+        MPY32_setOperandOne32Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, (uint32_t)(int32_t)a[i]);
+        MPY32_setOperandTwo32Bit((uint32_t)(int32_t)b[i]);
+    }
+
+    int64_t res = (int64_t)MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+int64_t mpy_dot_s32(const int32_t *a, const int32_t *b, uint16_t len)
+{
+    uint16_t i = 0;
+    uint16_t sr = mpy_lock();
+
+    MPY32_preloadResult(0);
+
+    for(i = 0; i < len; i++)
+    {
+        MPY32_setOperandOne32Bit(MPY32_MULTIPLYACCUMULATE_SIGNED, (uint32_t)a[i]);
+        MPY32_setOperandTwo32Bit((uint32_t)b[i]);
+    }
+
+    int64_t res = (int64_t)MPY32_getResult();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+int16_t mpy_mul_q15(int16_t a, int16_t b)
+{
+    uint16_t sr = mpy_lock();
+
+    MPY32_enableFractionalMode();
+    MPY32_enableSaturationMode();
+
+    MPY32_setOperandOne16Bit(MPY32_MULTIPLY_SIGNED, (uint16_t)a);
+    MPY32_setOperandTwo16Bit((uint16_t)b);
+
+    /* The fractional mode shifts the product by one bit, so the Q15 result is the high word */
+    int16_t res = (int16_t)(MPY32_getResult() >> 16);
+
+    MPY32_disableSaturationMode();
+    MPY32_disableFractionalMode();
+
+    mpy_unlock(sr);
+
+    return res;
+}
+
+static uint16_t mpy_lock(void)
+{
+    uint16_t sr = __get_SR_register();
+
+    __disable_interrupt();
+
+    return sr;
+}
+
+static void mpy_unlock(uint16_t sr)
+{
+    __bis_SR_register(sr & GIE);
+}
+
+#else
+
+int64_t mpy_mul_s32(int32_t a, int32_t b)
+{
+    return (int64_t)a * (int64_t)b;
+}
+
+uint64_t mpy_mul_u32(uint32_t a, uint32_t b)
+{
+    return (uint64_t)a * (uint64_t)b;
+}
+
+int64_t mpy_mac_s32(int64_t acc, int32_t a, int32_t b)
+{
+    /* Two's complement wrap around, as the 64-bit MPY32 accumulator */
+    return (int64_t)((uint64_t)acc + (uint64_t)((int64_t)a * (int64_t)b));
+}
+
+uint64_t mpy_mac_u32(uint64_t acc, uint32_t a, uint32_t b)
+{
+    return acc + ((uint64_t)a * (uint64_t)b);
+}
+
+int64_t mpy_dot_s16(const int16_t *a, const int16_t *b, uint16_t len)
+{
+    int64_t acc = 0;
+    uint16_t i = 0;
+
+    for(i = 0; i < len; i++)
+    {
+        acc += (int32_t)a[i] * (int32_t)b[i];
+    }
+
+    return acc;
+}
+
+int64_t mpy_dot_s32(const int32_t *a, const int32_t *b, uint16_t len)
+{
+    int64_t acc = 0;
+    uint16_t i = 0;
+
+    for(i = 0; i < len; i++)
+    {
+        acc = mpy_mac_s32(acc, a[i], b[i]);
+    }
+
+    return acc;
+}
+
+int16_t mpy_mul_q15(int16_t a, int16_t b)
+{
+    int32_t res = ((int32_t)a * (int32_t)b) >> 15;
+
+    /* Only -1.0*-1.0 overflows */
+    return (res > INT16_MAX) ? INT16_MAX : (int16_t)res;
+}
+
+#endif /* MPY_HW_ENABLED */
+
+int16_t mpy_fir_q15(const int16_t *coefs, const int16_t *samples, uint16_t len)
+{
+    int64_t acc = mpy_dot_s16(coefs, samples, len) + (1LL << 14);
+
+    acc >>= 15;
+
+    if (acc > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+
+    if (acc < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+
+    return (int16_t)acc;
+}
+
+int32_t mpy_ema_s32(int32_t avg, int32_t x, int16_t alpha)
+{
+    int64_t step = mpy_mul_s32(x - avg, alpha) + (1LL << 14);
+
+    return avg + (int32_t)(step >> 15);
+}
+
+/** \} End of mpy group */
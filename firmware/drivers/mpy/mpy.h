@@ -0,0 +1,172 @@
+/*
+ * mpy.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief MPY32 hardware multiplier driver definition.
+ *
+ * The MPY32 registers are shared by every task and ISR, so each operation
+ * runs with the interrupts disabled (a few cycles, or a few cycles per element
+ * for the array kernels).
+ *
+ * Every kernel has a portable C implementation, selected when the firmware is
+ * not built for the MSP430 (host unit tests and benchmarks). Both give the
+ * same results, bit by bit.
+ *
+ * \version 0.2.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup mpy MPY32
+ * \ingroup drivers
+ * \{
+ */
+
+#ifndef MPY_H_
+#define MPY_H_
+
+#include <stdint.h>
+
+#define MPY_MODULE_NAME         "MPY32"
+
+#ifdef __MSP430__
+#define MPY_HW_ENABLED          1       /**< Kernels computed by the MPY32 peripheral. */
+#else
+#define MPY_HW_ENABLED          0       /**< Portable C kernels. */
+#endif /* __MSP430__ */
+
+/**
+ * \brief Signed 32x32 bits multiplication with a 64-bit result.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b.
+ */
+int64_t mpy_mul_s32(int32_t a, int32_t b);
+
+/**
+ * \brief Unsigned 32x32 bits multiplication with a 64-bit result.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b.
+ */
+uint64_t mpy_mul_u32(uint32_t a, uint32_t b);
+
+/**
+ * \brief Signed 32x32 bits multiply-accumulate over a 64-bit accumulator.
+ *
+ * \param[in] acc is the accumulator value.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The accumulator acc+a*b (wraps around on overflow).
+ */
+int64_t mpy_mac_s32(int64_t acc, int32_t a, int32_t b);
+
+/**
+ * \brief Unsigned 32x32 bits multiply-accumulate over a 64-bit accumulator.
+ *
+ * \param[in] acc is the accumulator value.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The accumulator acc+a*b (wraps around on overflow).
+ */
+uint64_t mpy_mac_u32(uint64_t acc, uint32_t a, uint32_t b);
+
+/**
+ * \brief Dot product of two arrays of 16-bit signed values.
+ *
+ * \param[in] a is the first array.
+ *
+ * \param[in] b is the second array.
+ *
+ * \param[in] len is the number of elements of the arrays.
+ *
+ * \return The sum of a[i]*b[i] (64-bit accumulator).
+ */
+int64_t mpy_dot_s16(const int16_t *a, const int16_t *b, uint16_t len);
+
+/**
+ * \brief Dot product of two arrays of 32-bit signed values.
+ *
+ * \param[in] a is the first array.
+ *
+ * \param[in] b is the second array.
+ *
+ * \param[in] len is the number of elements of the arrays.
+ *
+ * \return The sum of a[i]*b[i] (64-bit accumulator, wraps around on overflow).
+ */
+int64_t mpy_dot_s32(const int32_t *a, const int32_t *b, uint16_t len);
+
+/**
+ * \brief Saturated Q15 multiplication (MPY32 fractional mode).
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b, truncated (-1.0*-1.0 saturates to 0x7FFF).
+ */
+int16_t mpy_mul_q15(int16_t a, int16_t b);
+
+/**
+ * \brief Q15 FIR filter output.
+ *
+ * The products are accumulated with full precision, and only the output is
+ * rounded and saturated.
+ *
+ * \param[in] coefs is the array of Q15 coefficients.
+ *
+ * \param[in] samples is the delay line (samples[0] is the newest sample).
+ *
+ * \param[in] len is the number of taps.
+ *
+ * \return The sum of coefs[i]*samples[i], in the format of the samples.
+ */
+int16_t mpy_fir_q15(const int16_t *coefs, const int16_t *samples, uint16_t len);
+
+/**
+ * \brief Exponential moving average step.
+ *
+ * \param[in] avg is the current average.
+ *
+ * \param[in] x is the new sample (|x - avg| must be lower than 2^31).
+ *
+ * \param[in] alpha is the Q15 smoothing factor (0 to 0x7FFF).
+ *
+ * \return The new average avg + alpha*(x - avg), rounded.
+ */
+int32_t mpy_ema_s32(int32_t avg, int32_t x, int16_t alpha);
+
+#endif /* MPY_H_ */
+
+/** \} End of mpy group */
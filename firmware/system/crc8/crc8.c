@@ -0,0 +1,55 @@
+/*
+ * crc8.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief CRC-8 implementation.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup crc8
+ * \{
+ */
+
+#include "crc8.h"
+
+uint8_t crc8(const uint8_t *data, uint8_t len)
+{
+    uint8_t crc = CRC8_INITIAL_VAL;
+
+    uint8_t i = 0U;
+    for(i = 0U; i < len; i++)
+    {
+        crc ^= data[i];
+
+        uint8_t j = 0U;
+        for(j = 0U; j < 8U; j++)
+        {
+            crc = (crc << 1) ^ ((crc & 0x80U) ? CRC8_POLYNOMIAL : 0U);
+        }
+    }
+
+    return crc;
+}
+
+/** \} End of crc8 group */
@@ -0,0 +1,59 @@
+/*
+ * crc8.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief CRC-8 definition.
+ *
+ * CRC8-CCITT (polynomial 0x07, initial value 0x00), shared by the records
+ * stored in the information memory (system time and calibrations).
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup crc8 CRC-8
+ * \ingroup system
+ * \{
+ */
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+#include <stdint.h>
+
+#define CRC8_INITIAL_VAL            0x00U       /**< CRC8-CCITT initial value. */
+#define CRC8_POLYNOMIAL             0x07U       /**< CRC8-CCITT polynomial. */
+
+/**
+ * \brief Computes the CRC8-CCITT of a sequence of bytes.
+ *
+ * \param[in] data is the sequence of bytes.
+ *
+ * \param[in] len is the number of bytes.
+ *
+ * \return The CRC-8 value.
+ */
+uint8_t crc8(const uint8_t *data, uint8_t len);
+
+#endif /* CRC8_H_ */
+
+/** \} End of crc8 group */
@@ -0,0 +1,222 @@
+/*
+ * filter.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Sensor stream filters implementation.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup filter
+ * \{
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <system/sys_log/sys_log.h>
+#include <drivers/mpy/mpy.h>
+
+#include "filter.h"
+
+#define FILTER_BIQUAD_TAPS          5U
+
+/**
+ * \brief Rounds a value with FILTER_FRAC_BITS fractional bits to the nearest integer.
+ *
+ * \param[in] val is the value to round.
+ *
+ * \return The rounded value.
+ */
+static int32_t filter_round(int32_t val);
+
+/**
+ * \brief Median filter step.
+ *
+ * \param[in,out] filter is the filter instance.
+ *
+ * \param[in] x is the new sample.
+ *
+ * \return The median of the window.
+ */
+static int32_t filter_median(filter_t *filter, int32_t x);
+
+/**
+ * \brief Biquad filter step.
+ *
+ * \param[in,out] filter is the filter instance.
+ *
+ * \param[in] x is the new sample.
+ *
+ * \return The filter output.
+ */
+static int32_t filter_biquad(filter_t *filter, int32_t x);
+
+int filter_init(filter_t *filter, const filter_config_t *config)
+{
+    if ((filter == NULL) || (config == NULL))
+    {
+        return -1;
+    }
+
+    switch(config->type)
+    {
+        case FILTER_TYPE_EMA:
+            if (config->cfg.alpha <= 0)
+            {
+                sys_log_print_event_from_module(SYS_LOG_ERROR, FILTER_MODULE_NAME, "Invalid EMA smoothing factor!");
+                sys_log_new_line();
+
+                return -1;
+            }
+            break;
+        case FILTER_TYPE_MEDIAN:
+            if ((config->cfg.window == 0U) || (config->cfg.window > FILTER_MEDIAN_MAX_WINDOW) || ((config->cfg.window % 2U) == 0U))
+            {
+                sys_log_print_event_from_module(SYS_LOG_ERROR, FILTER_MODULE_NAME, "Invalid median window!");
+                sys_log_new_line();
+
+                return -1;
+            }
+            break;
+        case FILTER_TYPE_BIQUAD:
+            break;
+        default:
+            sys_log_print_event_from_module(SYS_LOG_ERROR, FILTER_MODULE_NAME, "Invalid filter type!");
+            sys_log_new_line();
+
+            return -1;
+    }
+
+    filter->config = config;
+
+    filter_reset(filter);
+
+    return 0;
+}
+
+void filter_reset(filter_t *filter)
+{
+    filter->count = 0;
+    filter->head = 0;
+
+    memset(filter->state, 0, sizeof(filter->state));
+}
+
+int32_t filter_update(filter_t *filter, int32_t x)
+{
+    int32_t x_q = x * (1L << FILTER_FRAC_BITS);
+
+    switch(filter->config->type)
+    {
+        case FILTER_TYPE_EMA:
+            if (filter->count == 0U)
+            {
+                filter->state[0] = x_q;
+                filter->count = 1;
+            }
+            else
+            {
+                filter->state[0] = mpy_ema_s32(filter->state[0], x_q, filter->config->cfg.alpha);
+            }
+
+            return filter_round(filter->state[0]);
+        case FILTER_TYPE_MEDIAN:
+            return filter_median(filter, x);
+        case FILTER_TYPE_BIQUAD:
+            return filter_biquad(filter, x_q);
+        default:
+            return x;
+    }
+}
+
+static int32_t filter_round(int32_t val)
+{
+    const int32_t half = 1L << (FILTER_FRAC_BITS - 1U);
+
+    /* Division instead of a shift, the rounding is symmetric for the negative values */
+    return (val + ((val < 0) ? -half : half)) / (1L << FILTER_FRAC_BITS);
+}
+
+static int32_t filter_median(filter_t *filter, int32_t x)
+{
+    int32_t sorted[FILTER_MEDIAN_MAX_WINDOW];
+    uint8_t i = 0;
+
+    filter->state[filter->head] = x;
+    filter->head = (filter->head + 1U) % filter->config->cfg.window;
+
+    if (filter->count < filter->config->cfg.window)
+    {
+        filter->count++;
+    }
+
+    /* Insertion sort, the window is only a few samples long */
+    for(i = 0; i < filter->count; i++)
+    {
+        int32_t val = filter->state[i];
+        uint8_t j = i;
+
+        while((j > 0U) && (sorted[j - 1U] > val))
+        {
+            sorted[j] = sorted[j - 1U];
+            j--;
+        }
+
+        sorted[j] = val;
+    }
+
+    /* Lower median while the window is filled with an even number of samples */
+    return sorted[(filter->count - 1U) / 2U];
+}
+
+static int32_t filter_biquad(filter_t *filter, int32_t x_q)
+{
+    int32_t *s = filter->state;
+
+    /* Primed with the first sample, the steady state of a unity DC gain filter (no start-up transient) */
+    if (filter->count == 0U)
+    {
+        s[0] = x_q;
+        s[1] = x_q;
+        s[2] = x_q;
+        s[3] = x_q;
+        s[4] = x_q;
+        filter->count = 1;
+    }
+
+    /* State: x[n], x[n-1], x[n-2], y[n-1], y[n-2], in the order of the coefficients */
+    s[2] = s[1];
+    s[1] = s[0];
+    s[0] = x_q;
+
+    /* Rounded with a shift, a 64-bit division would be done by the runtime library */
+    int64_t acc = (mpy_dot_s32(filter->config->cfg.coefs, s, FILTER_BIQUAD_TAPS) + (1LL << (FILTER_BIQUAD_COEF_BITS - 1))) >> FILTER_BIQUAD_COEF_BITS;
+
+    s[4] = s[3];
+    s[3] = (acc > INT32_MAX) ? INT32_MAX : ((acc < INT32_MIN) ? INT32_MIN : (int32_t)acc);
+
+    return filter_round(s[3]);
+}
+
+/** \} End of filter group */
@@ -0,0 +1,154 @@
+/*
+ * filter.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Sensor stream filters definition.
+ *
+ * Fixed-point filters for the sensor streams: exponential moving average,
+ * short-window median (spike rejection) and biquad IIR. Each filter instance
+ * owns its state, so an instance must be updated by a single task.
+ *
+ * The samples are integers in the units of the filtered parameter. The EMA and
+ * the biquad keep their state with FILTER_FRAC_BITS extra fractional bits, so
+ * slow changes are not lost in the rounding of the output.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup filter Filters
+ * \ingroup system
+ * \{
+ */
+
+#ifndef FILTER_H_
+#define FILTER_H_
+
+#include <stdint.h>
+
+#include <system/fixedpt/fixedpt.h>
+
+#define FILTER_MODULE_NAME          "Filter"
+
+#define FILTER_FRAC_BITS            8U          /**< Fractional bits of the EMA and biquad states. */
+#define FILTER_MEDIAN_MAX_WINDOW    7U          /**< Largest window of the median filter (odd). */
+#define FILTER_BIQUAD_COEF_BITS     30          /**< Fractional bits of the biquad coefficients (range [-2.0, 2.0)). */
+#define FILTER_STATE_LEN            FILTER_MEDIAN_MAX_WINDOW    /**< Number of state words of a filter instance. */
+
+/**
+ * \brief Converts a real biquad coefficient to the Q30 format.
+ *
+ * \note Only for constant expressions, that are folded by the compiler (no float code is generated).
+ */
+#define FILTER_BIQUAD_COEF(x)       ((int32_t)(((x) * 1073741824.0) + (((x) >= 0) ? 0.5 : -0.5)))
+
+/**
+ * \brief EMA filter configuration (a is the real smoothing factor, in the (0, 1) range).
+ */
+#define FILTER_EMA(a)               {.type = FILTER_TYPE_EMA, .cfg = {.alpha = FIXEDPT_Q15_CONST(a)}}
+
+/**
+ * \brief Median filter configuration (n is the window length, odd and up to FILTER_MEDIAN_MAX_WINDOW).
+ */
+#define FILTER_MEDIAN(n)            {.type = FILTER_TYPE_MEDIAN, .cfg = {.window = (n)}}
+
+/**
+ * \brief Biquad filter configuration, y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2].
+ *
+ * The feedback coefficients are stored negated, so the output is a single dot product.
+ */
+#define FILTER_BIQUAD(b0, b1, b2, a1, a2)                                                           \
+        {.type = FILTER_TYPE_BIQUAD, .cfg = {.coefs = {FILTER_BIQUAD_COEF(b0), FILTER_BIQUAD_COEF(b1), \
+                                                       FILTER_BIQUAD_COEF(b2), FILTER_BIQUAD_COEF(-(a1)), \
+                                                       FILTER_BIQUAD_COEF(-(a2))}}}
+
+/**
+ * \brief Filter types.
+ */
+typedef enum
+{
+    FILTER_TYPE_EMA=0,                          /**< Exponential moving average. */
+    FILTER_TYPE_MEDIAN,                         /**< Short-window median. */
+    FILTER_TYPE_BIQUAD                          /**< Second order IIR (direct form I). */
+} filter_type_e;
+
+/**
+ * \brief Filter configuration.
+ */
+typedef struct
+{
+    uint8_t type;                               /**< Filter type (filter_type_e). */
+    union
+    {
+        q15_t alpha;                            /**< EMA smoothing factor. */
+        uint8_t window;                         /**< Median window length. */
+        int32_t coefs[5];                       /**< Biquad coefficients (b0, b1, b2, -a1, -a2), Q30. */
+    } cfg;
+} filter_config_t;
+
+/**
+ * \brief Filter instance.
+ */
+typedef struct
+{
+    const filter_config_t *config;              /**< Configuration of the filter. */
+    uint8_t count;                              /**< Number of samples in the state (up to the median window). */
+    uint8_t head;                               /**< Position of the next sample of the median window. */
+    int32_t state[FILTER_STATE_LEN];            /**< Filter state (EMA: average, median: window, biquad: x[n..n-2], y[n-1..n-2]). */
+} filter_t;
+
+/**
+ * \brief Initializes a filter instance.
+ *
+ * \param[in,out] filter is the filter instance.
+ *
+ * \param[in] config is the filter configuration (must remain valid while the filter is used).
+ *
+ * \return The status/error code.
+ */
+int filter_init(filter_t *filter, const filter_config_t *config);
+
+/**
+ * \brief Clears the state of a filter.
+ *
+ * The next sample restarts the filter (the EMA and the biquad are primed with it).
+ *
+ * \param[in,out] filter is the filter instance.
+ *
+ * \return None.
+ */
+void filter_reset(filter_t *filter);
+
+/**
+ * \brief Adds a new sample to a filter.
+ *
+ * \param[in,out] filter is the filter instance.
+ *
+ * \param[in] x is the new sample (|x| lower than 2^23, e.g. a 16-bit parameter value).
+ *
+ * \return The filtered value (the median of the available samples until the window is full).
+ */
+int32_t filter_update(filter_t *filter, int32_t x);
+
+#endif /* FILTER_H_ */
+
+/** \} End of filter group */
@@ -0,0 +1,263 @@
+/*
+ * fixedpt.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Fixed-point math library implementation.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup fixedpt
+ * \{
+ */
+
+#include <stdbool.h>
+
+#include <drivers/mpy/mpy.h>
+
+#include "fixedpt.h"
+
+/**
+ * \brief Absolute value of a signed integer (INT32_MIN included).
+ *
+ * \param[in] x is the signed value.
+ *
+ * \return The magnitude of x.
+ */
+static uint32_t fixedpt_abs(int32_t x);
+
+/**
+ * \brief Unsigned fixed-point division with rounding.
+ *
+ * \param[in] a is the dividend magnitude.
+ *
+ * \param[in] b is the divisor magnitude (not zero).
+ *
+ * \param[in] frac_bits is the number of fractional bits of the quotient.
+ *
+ * \param[in] lim is the greatest allowed quotient.
+ *
+ * \param[in,out] quo is the rounded quotient.
+ *
+ * \return TRUE/FALSE if the quotient fits or not in the given limit.
+ */
+static bool fixedpt_udiv(uint32_t a, uint32_t b, uint8_t frac_bits, uint32_t lim, uint32_t *quo);
+
+q16_t fixedpt_q16_sat(int64_t x)
+{
+    if (x > (int64_t)FIXEDPT_Q16_MAX)
+    {
+        return FIXEDPT_Q16_MAX;
+    }
+
+    if (x < (int64_t)FIXEDPT_Q16_MIN)
+    {
+        return FIXEDPT_Q16_MIN;
+    }
+
+    return (q16_t)x;
+}
+
+q16_t fixedpt_q16_add(q16_t a, q16_t b)
+{
+    q16_t s = (q16_t)((uint32_t)a + (uint32_t)b);
+
+    /* Overflow only if both operands have the same sign and the sum a different one */
+    if (((a ^ s) & (b ^ s)) < 0)
+    {
+        s = (a < 0) ? FIXEDPT_Q16_MIN : FIXEDPT_Q16_MAX;
+    }
+
+    return s;
+}
+
+q16_t fixedpt_q16_sub(q16_t a, q16_t b)
+{
+    q16_t d = (q16_t)((uint32_t)a - (uint32_t)b);
+
+    /* Overflow only if the operands have different signs and the difference a sign different from a */
+    if (((a ^ b) & (a ^ d)) < 0)
+    {
+        d = (a < 0) ? FIXEDPT_Q16_MIN : FIXEDPT_Q16_MAX;
+    }
+
+    return d;
+}
+
+q16_t fixedpt_q16_mul(q16_t a, q16_t b)
+{
+    return fixedpt_q16_sat((mpy_mul_s32(a, b) + (1LL << (FIXEDPT_Q16_FRAC_BITS - 1))) >> FIXEDPT_Q16_FRAC_BITS);
+}
+
+q16_t fixedpt_q16_div(q16_t a, q16_t b)
+{
+    bool neg = (a < 0) != (b < 0);
+    uint32_t quo = 0;
+
+    if ((b == 0) || !fixedpt_udiv(fixedpt_abs(a), fixedpt_abs(b), FIXEDPT_Q16_FRAC_BITS, neg ? fixedpt_abs(FIXEDPT_Q16_MIN) : (uint32_t)FIXEDPT_Q16_MAX, &quo))
+    {
+        return neg ? FIXEDPT_Q16_MIN : FIXEDPT_Q16_MAX;
+    }
+
+    return neg ? (q16_t)(0UL - quo) : (q16_t)quo;
+}
+
+int32_t fixedpt_q16_scale(int32_t x, q16_t k)
+{
+    /* An integer times a Q16 factor is the Q16 product of the integer in Q0 */
+    return fixedpt_q16_mul(x, k);
+}
+
+int32_t fixedpt_q16_to_int(q16_t a)
+{
+    return (a >> FIXEDPT_Q16_FRAC_BITS) + ((a >> (FIXEDPT_Q16_FRAC_BITS - 1)) & 1L);
+}
+
+q16_t fixedpt_q16_interp(q16_t x0, q16_t y0, q16_t x1, q16_t y1, q16_t x)
+{
+    if (x1 == x0)
+    {
+        return y0;
+    }
+
+    q16_t t = fixedpt_q16_div(fixedpt_q16_sub(x, x0), fixedpt_q16_sub(x1, x0));
+
+    return fixedpt_q16_add(y0, fixedpt_q16_mul(fixedpt_q16_sub(y1, y0), t));
+}
+
+q16_t fixedpt_q16_interp_table(const q16_t *xs, const q16_t *ys, uint16_t len, q16_t x)
+{
+    if (len == 0U)
+    {
+        return 0;
+    }
+
+    if (x <= xs[0])
+    {
+        return ys[0];
+    }
+
+    if (x >= xs[len - 1U])
+    {
+        return ys[len - 1U];
+    }
+
+    /* Binary search of the segment xs[lo] <= x < xs[hi] */
+    uint16_t lo = 0;
+    uint16_t hi = (uint16_t)(len - 1U);
+
+    while ((uint16_t)(hi - lo) > 1U)
+    {
+        uint16_t mid = lo + ((uint16_t)(hi - lo) / 2U);
+
+        if (x < xs[mid])
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid;
+        }
+    }
+
+    return fixedpt_q16_interp(xs[lo], ys[lo], xs[hi], ys[hi], x);
+}
+
+q15_t fixedpt_q15_sat(int32_t x)
+{
+    if (x > (int32_t)FIXEDPT_Q15_MAX)
+    {
+        return FIXEDPT_Q15_MAX;
+    }
+
+    if (x < (int32_t)FIXEDPT_Q15_MIN)
+    {
+        return FIXEDPT_Q15_MIN;
+    }
+
+    return (q15_t)x;
+}
+
+q15_t fixedpt_q15_mul(q15_t a, q15_t b)
+{
+    return fixedpt_q15_sat((int32_t)((mpy_mul_s32(a, b) + (1L << (FIXEDPT_Q15_FRAC_BITS - 1))) >> FIXEDPT_Q15_FRAC_BITS));
+}
+
+q15_t fixedpt_q15_div(q15_t a, q15_t b)
+{
+    bool neg = (a < 0) != (b < 0);
+    uint32_t quo = 0;
+
+    if ((b == 0) || !fixedpt_udiv(fixedpt_abs(a), fixedpt_abs(b), FIXEDPT_Q15_FRAC_BITS, neg ? fixedpt_abs(FIXEDPT_Q15_MIN) : (uint32_t)FIXEDPT_Q15_MAX, &quo))
+    {
+        return neg ? FIXEDPT_Q15_MIN : FIXEDPT_Q15_MAX;
+    }
+
+    return neg ? (q15_t)(0L - (int32_t)quo) : (q15_t)quo;
+}
+
+static uint32_t fixedpt_abs(int32_t x)
+{
+    return (x < 0) ? (0UL - (uint32_t)x) : (uint32_t)x;
+}
+
+static bool fixedpt_udiv(uint32_t a, uint32_t b, uint8_t frac_bits, uint32_t lim, uint32_t *quo)
+{
+    uint32_t q = a / b;
+    uint32_t r = a % b;
+
+    /* The integer part must leave room for the fractional bits and the rounding bit */
+    if (q > ((lim - 1UL) >> frac_bits))
+    {
+        return false;
+    }
+
+    /* One quotient bit per step, plus one extra bit for the rounding */
+    uint8_t i = 0;
+    for(i = 0; i <= frac_bits; i++)
+    {
+        uint32_t carry = r & 0x80000000UL;
+
+        r <<= 1;
+        q <<= 1;
+
+        if ((carry != 0UL) || (r >= b))
+        {
+            r -= b;
+            q |= 1UL;
+        }
+    }
+
+    q = (q + 1UL) >> 1;
+
+    if (q > lim)
+    {
+        return false;
+    }
+
+    *quo = q;
+
+    return true;
+}
+
+/** \} End of fixedpt group */
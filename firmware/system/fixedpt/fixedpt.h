@@ -0,0 +1,229 @@
+/*
+ * fixedpt.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Fixed-point math library definition.
+ *
+ * The MSP430F6659 has no floating-point unit, so every float operation is a
+ * call to the soft-float runtime. This library offers the two formats used by
+ * the firmware:
+ *
+ *      Q16 (q16_t): signed 32-bit, 16 fractional bits (-32768.0 to 32767.99998).
+ *      Q15 (q15_t): signed 16-bit, 15 fractional bits (-1.0 to 0.99997).
+ *
+ * The products are computed by the MPY32 hardware multiplier, and every
+ * operation rounds to the nearest value and saturates instead of wrapping.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup fixedpt Fixed-Point Math
+ * \ingroup system
+ * \{
+ */
+
+#ifndef FIXEDPT_H_
+#define FIXEDPT_H_
+
+#include <stdint.h>
+
+#define FIXEDPT_Q16_FRAC_BITS       16                              /**< Number of fractional bits of the Q16 format. */
+#define FIXEDPT_Q15_FRAC_BITS       15                              /**< Number of fractional bits of the Q15 format. */
+
+#define FIXEDPT_Q16_ONE             ((q16_t)65536L)                 /**< 1.0 in Q16. */
+#define FIXEDPT_Q16_MAX             ((q16_t)INT32_MAX)              /**< Greatest Q16 value. */
+#define FIXEDPT_Q16_MIN             ((q16_t)INT32_MIN)              /**< Smallest Q16 value. */
+#define FIXEDPT_Q15_MAX             ((q15_t)INT16_MAX)              /**< Greatest Q15 value. */
+#define FIXEDPT_Q15_MIN             ((q15_t)INT16_MIN)              /**< Smallest Q15 value (-1.0). */
+
+/**
+ * \brief Converts an integer to Q16.
+ */
+#define FIXEDPT_Q16_INT(x)          ((q16_t)((int32_t)(x) * FIXEDPT_Q16_ONE))
+
+/**
+ * \brief Converts a real constant to Q16.
+ *
+ * \note Only for constant expressions, that are folded by the compiler (no float code is generated).
+ */
+#define FIXEDPT_Q16_CONST(x)        ((q16_t)(((x) * 65536.0) + (((x) >= 0) ? 0.5 : -0.5)))
+
+/**
+ * \brief Converts a real constant in the [-1.0, 1.0) range to Q15.
+ *
+ * \note Only for constant expressions, that are folded by the compiler (no float code is generated).
+ */
+#define FIXEDPT_Q15_CONST(x)        ((q15_t)(((x) * 32768.0) + (((x) >= 0) ? 0.5 : -0.5)))
+
+/**
+ * \brief Q16 fixed-point type.
+ */
+typedef int32_t q16_t;
+
+/**
+ * \brief Q15 fixed-point type.
+ */
+typedef int16_t q15_t;
+
+/**
+ * \brief Saturates a wide result to the Q16 range.
+ *
+ * \param[in] x is the value to saturate.
+ *
+ * \return The saturated value.
+ */
+q16_t fixedpt_q16_sat(int64_t x);
+
+/**
+ * \brief Saturated Q16 addition.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The sum a+b.
+ */
+q16_t fixedpt_q16_add(q16_t a, q16_t b);
+
+/**
+ * \brief Saturated Q16 subtraction.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The difference a-b.
+ */
+q16_t fixedpt_q16_sub(q16_t a, q16_t b);
+
+/**
+ * \brief Rounded and saturated Q16 multiplication.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b.
+ */
+q16_t fixedpt_q16_mul(q16_t a, q16_t b);
+
+/**
+ * \brief Rounded and saturated Q16 division.
+ *
+ * The quotient is computed with 32-bit shift-and-subtract steps, avoiding the
+ * 64-bit division of the runtime library.
+ *
+ * \param[in] a is the dividend.
+ *
+ * \param[in] b is the divisor. A zero divisor saturates the result with the sign of the dividend.
+ *
+ * \return The quotient a/b.
+ */
+q16_t fixedpt_q16_div(q16_t a, q16_t b);
+
+/**
+ * \brief Scales an integer by a Q16 factor.
+ *
+ * \param[in] x is the integer value.
+ *
+ * \param[in] k is the Q16 factor.
+ *
+ * \return The rounded and saturated integer x*k.
+ */
+int32_t fixedpt_q16_scale(int32_t x, q16_t k);
+
+/**
+ * \brief Converts a Q16 value to the nearest integer.
+ *
+ * \param[in] a is the Q16 value.
+ *
+ * \return The rounded integer value.
+ */
+int32_t fixedpt_q16_to_int(q16_t a);
+
+/**
+ * \brief Linear interpolation (or extrapolation) over the line defined by two points.
+ *
+ * \param[in] x0 is the abscissa of the first point.
+ *
+ * \param[in] y0 is the ordinate of the first point.
+ *
+ * \param[in] x1 is the abscissa of the second point.
+ *
+ * \param[in] y1 is the ordinate of the second point.
+ *
+ * \param[in] x is the abscissa to interpolate.
+ *
+ * \return The interpolated ordinate (y0 if x0 is equal to x1).
+ */
+q16_t fixedpt_q16_interp(q16_t x0, q16_t y0, q16_t x1, q16_t y1, q16_t x);
+
+/**
+ * \brief Piecewise linear interpolation over a lookup table.
+ *
+ * \param[in] xs is the table of abscissas, in ascending order.
+ *
+ * \param[in] ys is the table of ordinates.
+ *
+ * \param[in] len is the number of points of the table (at least 1).
+ *
+ * \param[in] x is the abscissa to interpolate. Values outside the table are clamped to its ends.
+ *
+ * \return The interpolated ordinate.
+ */
+q16_t fixedpt_q16_interp_table(const q16_t *xs, const q16_t *ys, uint16_t len, q16_t x);
+
+/**
+ * \brief Saturates a wide result to the Q15 range.
+ *
+ * \param[in] x is the value to saturate.
+ *
+ * \return The saturated value.
+ */
+q15_t fixedpt_q15_sat(int32_t x);
+
+/**
+ * \brief Rounded and saturated Q15 multiplication.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b (-1.0*-1.0 saturates to the greatest Q15 value).
+ */
+q15_t fixedpt_q15_mul(q15_t a, q15_t b);
+
+/**
+ * \brief Rounded and saturated Q15 division.
+ *
+ * \param[in] a is the dividend.
+ *
+ * \param[in] b is the divisor. A zero divisor saturates the result with the sign of the dividend.
+ *
+ * \return The quotient a/b.
+ */
+q15_t fixedpt_q15_div(q15_t a, q15_t b);
+
+#endif /* FIXEDPT_H_ */
+
+/** \} End of fixedpt group */
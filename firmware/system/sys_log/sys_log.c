@@ -25,15 +25,15 @@
  * 
  * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
  * 
- * \version 0.1.2
+ * \version 0.1.3
  * 
- * \date 2020/10/22
+ * \date 2026/10/17
  * 
  * \addtogroup sys_log
  * \{
  */
 
-#include <math.h>
+#include <stdlib.h>
 
 #include <FreeRTOS.h>
 #include <task.h>
@@ -257,10 +257,8 @@ void sys_log_print_uint(uint32_t uint)
         {
             uint8_t uint_str[10];               /* 32-bits = decimal with 10 digits */
 
-            uint8_t digits = log10(uint) + 1;
-
             uint8_t i = 0;
-            for(i=0; i<digits; ++i, uint /= 10)
+            for(i=0; uint > 0; ++i, uint /= 10)
             {
                 uint_str[i] = uint % 10;
             }
@@ -342,7 +340,7 @@ void sys_log_print_float(float flt, uint8_t digits)
         {
             sys_log_print_msg("-");
 
-            flt = abs(flt);
+            flt = -flt;
         }
 
         /* Extract integer part */
@@ -358,7 +356,15 @@ void sys_log_print_float(float flt, uint8_t digits)
         sys_log_print_msg(".");
 
         /* Print floating part */
-        sys_log_print_uint((uint32_t)(fpart*pow(10, digits)));
+        uint32_t scale = 1;
+
+        uint8_t i = 0;
+        for(i=0; i<digits; i++)
+        {
+            scale *= 10;
+        }
+
+        sys_log_print_uint((uint32_t)(fpart*scale));
     }
 }
 
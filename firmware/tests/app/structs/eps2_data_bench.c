@@ -0,0 +1,524 @@
+/*
+ * eps2_data_bench.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Host benchmark of the EPS2 data buffer access (switch-based vs. table-driven).
+ *
+ * The legacy switch-based accessors are kept here only as the baseline of the
+ * comparison. The output is the mean time per access in nanoseconds, followed
+ * by the beacon frame build time (per-field encoding vs. wire image copy) and
+ * the number of bytes of each eps_data_t block.
+ *
+ * \version 0.1.2
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup eps2_data_bench EPS2 Data Benchmark
+ * \ingroup tests
+ * \{
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <system/system.h>
+#include <app/structs/eps2_data.h>
+
+#define EPS2_DATA_BENCH_ROUNDS      200000UL
+#define EPS2_DATA_BENCH_FRAME_SIZE  (9U + EPS_DATA_BEACON_BYTES)
+
+extern eps_data_t eps_data_buff;
+
+static volatile uint32_t eps2_data_bench_sink;
+
+static int eps_buffer_write_switch(uint8_t id, uint32_t *value);
+
+static int eps_buffer_read_switch(uint8_t id, uint32_t *value);
+
+static double eps2_data_bench_now_ns(void);
+
+static double eps2_data_bench_run(int (*access)(uint8_t, uint32_t*));
+
+static void eps2_data_bench_frame_encode(uint8_t *frame);
+
+static void eps2_data_bench_frame_copy(uint8_t *frame);
+
+static double eps2_data_bench_run_frame(void (*build)(uint8_t*));
+
+int main(void)
+{
+    double read_switch  = eps2_data_bench_run(eps_buffer_read_switch);
+    double read_table   = eps2_data_bench_run(eps_buffer_read);
+    double write_switch = eps2_data_bench_run(eps_buffer_write_switch);
+    double write_table  = eps2_data_bench_run(eps_buffer_write);
+
+    eps_buffer_init();
+
+    double frame_encode = eps2_data_bench_run_frame(eps2_data_bench_frame_encode);
+    double frame_copy   = eps2_data_bench_run_frame(eps2_data_bench_frame_copy);
+
+    printf("EPS2 data buffer access (%lu rounds x %u IDs):\n", EPS2_DATA_BENCH_ROUNDS, (unsigned)EPS2_PARAM_ID_QTY);
+    printf("    read:  switch %6.2f ns, table %6.2f ns\n", read_switch, read_table);
+    printf("    write: switch %6.2f ns, table %6.2f ns\n", write_switch, write_table);
+
+    printf("Beacon frame build (%lu rounds x %u bytes):\n", EPS2_DATA_BENCH_ROUNDS, (unsigned)EPS2_DATA_BENCH_FRAME_SIZE);
+    printf("    read_many + encode %8.2f ns, wire image copy %8.2f ns\n", frame_encode, frame_copy);
+
+    printf("EPS2 data buffer layout (%u bytes, budget %u bytes):\n", (unsigned)sizeof(eps_data_t), EPS_DATA_BYTES);
+    printf("    misc:            %3u bytes\n", (unsigned)EPS_DATA_BLOCK_SIZE(firmware_version, timestamp));
+    printf("    MCU:             %3u bytes\n", (unsigned)EPS_DATA_BLOCK_SIZE(timestamp, bm_status_reg));
+    printf("    battery monitor: %3u bytes\n", (unsigned)EPS_DATA_BLOCK_SIZE(bm_status_reg, minus_y_plus_x_solar_panel_mv));
+    printf("    solar panels:    %3u bytes\n", (unsigned)EPS_DATA_BLOCK_SIZE(minus_y_plus_x_solar_panel_mv, batteries_mv));
+    printf("    batteries:       %3u bytes\n", (unsigned)(sizeof(eps_data_t) - offsetof(eps_data_t, batteries_mv)));
+
+    return 0;
+}
+
+static double eps2_data_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static double eps2_data_bench_run(int (*access)(uint8_t, uint32_t*))
+{
+    uint32_t round = 0;
+    uint32_t n = 0;
+    uint8_t id = 0;
+
+    double start = eps2_data_bench_now_ns();
+
+    for(round = 0; round < EPS2_DATA_BENCH_ROUNDS; round++)
+    {
+        for(id = 0; id < EPS2_PARAM_ID_QTY; id++)
+        {
+            /* Skip the IDs without storage, both implementations reject them */
+            if ((id == EPS2_PARAM_ID_BAT_CHARGE) || (id == EPS2_PARAM_ID_RESET_EPS) || (id == EPS2_PARAM_ID_PAYLOAD_ENABLE))
+            {
+                continue;
+            }
+
+            uint32_t val = round;
+
+            access(id, &val);
+
+            eps2_data_bench_sink += val;
+            n++;
+        }
+    }
+
+    return (eps2_data_bench_now_ns() - start) / (double)n;
+}
+
+static void eps2_data_bench_frame_encode(uint8_t *frame)
+{
+    static const uint8_t beacon_param_list[] = {BEACON_PARAM_ID_LIST};
+    static uint32_t beacon_param_values[BEACON_PARAM_ID_QTY];
+    uint8_t i = 0;
+    uint8_t j = 9;
+
+    /* Beacon frame as built before the wire image */
+    eps_buffer_read_many(beacon_param_list, BEACON_PARAM_ID_QTY, beacon_param_values);
+
+    for(i = 0; i < BEACON_PARAM_ID_QTY; i++, j += 4)
+    {
+        uint32_t val = beacon_param_values[i];
+
+        frame[ j ] = (val >> 24) & 0xFF;
+        frame[j+1] = (val >> 16) & 0xFF;
+        frame[j+2] = (val >> 8)  & 0xFF;
+        frame[j+3] = (val >> 0)  & 0xFF;
+    }
+}
+
+static void eps2_data_bench_frame_copy(uint8_t *frame)
+{
+    eps_buffer_read_beacon(&frame[9]);
+}
+
+static double eps2_data_bench_run_frame(void (*build)(uint8_t*))
+{
+    static uint8_t frame[EPS2_DATA_BENCH_FRAME_SIZE];
+    uint32_t round = 0;
+
+    double start = eps2_data_bench_now_ns();
+
+    for(round = 0; round < EPS2_DATA_BENCH_ROUNDS; round++)
+    {
+        build(frame);
+
+        eps2_data_bench_sink += frame[9U + (round % EPS_DATA_BEACON_BYTES)];
+    }
+
+    return (eps2_data_bench_now_ns() - start) / (double)EPS2_DATA_BENCH_ROUNDS;
+}
+
+static int eps_buffer_write_switch(uint8_t id, uint32_t *value)
+{
+    taskENTER_CRITICAL();
+    switch(id)
+    {
+        case EPS2_PARAM_ID_TIMESTAMP:
+            eps_data_buff.timestamp = *value;
+            system_set_time(*value);
+            break;
+        case EPS2_PARAM_ID_MCU_TEMP:
+            eps_data_buff.eps_mcu_temp_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_EPS_CURRENT:
+            eps_data_buff.eps_beacon_ma = *value;
+            break;
+        case EPS2_PARAM_ID_LAST_RESET_CAUSE:
+            eps_data_buff.last_reset_cause = *value;
+            break;
+        case EPS2_PARAM_ID_RESET_COUNTER:
+            eps_data_buff.reset_counter = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
+            eps_data_buff.minus_y_plus_x_solar_panel_mv = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
+            eps_data_buff.minus_x_plus_z_solar_panel_mv = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
+            eps_data_buff.minus_z_plus_y_solar_panel_mv = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MY_CURRENT:
+            eps_data_buff.minus_y_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_SP_PY_CURRENT:
+            eps_data_buff.plus_y_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MX_CURRENT:
+            eps_data_buff.minus_x_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_SP_PX_CURRENT:
+            eps_data_buff.plus_x_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_SP_MZ_CURRENT:
+            eps_data_buff.minus_z_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_SP_PZ_CURRENT:
+            eps_data_buff.plus_z_solar_panel_ma = *value;
+            break;
+        case EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE:
+            eps_data_buff.mppt_1_duty_cycle = *value;
+            break;
+        case EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE:
+            eps_data_buff.mppt_2_duty_cycle = *value;
+            break;
+        case EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE:
+            eps_data_buff.mppt_3_duty_cycle = *value;
+            break;
+        case EPS2_PARAM_ID_SP_VOLTAGE_MPPT:
+            eps_data_buff.total_solar_panels_mv = *value;
+            break;
+        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
+            eps_data_buff.main_power_buss_mv = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_0_TEMP:
+            eps_data_buff.batteries_rtd0_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_1_TEMP:
+            eps_data_buff.batteries_rtd1_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_2_TEMP:
+            eps_data_buff.batteries_rtd2_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_3_TEMP:
+            eps_data_buff.batteries_rtd3_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_4_TEMP:
+            eps_data_buff.solar_panels_rtd4_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_5_TEMP:
+            eps_data_buff.solar_panels_rtd5_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_RTD_6_TEMP:
+            eps_data_buff.solar_panels_rtd6_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_VOLTAGE:
+            eps_data_buff.batteries_mv = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_CURRENT:
+            eps_data_buff.batteries_ma = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
+            eps_data_buff.batteries_average_ma = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
+            eps_data_buff.batteries_accumulated_ma = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
+            eps_data_buff.bm_temp_kelvin = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
+            eps_data_buff.bm_status_reg = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
+            eps_data_buff.bm_protection_reg = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
+            eps_data_buff.bm_cycle_counter_reg = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
+            eps_data_buff.bm_raac_mah = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
+            eps_data_buff.bm_rsac_mah = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
+            eps_data_buff.bm_rarc_percent = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
+            eps_data_buff.bm_rsrc_percent = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE:
+            eps_data_buff.heater1_duty_cycle = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE:
+            eps_data_buff.heater2_duty_cycle = *value;
+            break;
+        case EPS2_PARAM_ID_HW_VERSION:
+            eps_data_buff.hardware_version = *value;
+            break;
+        case EPS2_PARAM_ID_FW_VERSION:
+            eps_data_buff.firmware_version = *value;
+            break;
+        case EPS2_PARAM_ID_MPPT_1_MODE:
+            eps_data_buff.mppt_1_mode = *value;
+            if (eps_data_buff.mppt_1_mode == 1) // MPPT is set to manual mode
+            {
+                eps_data_buff.mppt_1_duty_cycle = 40;
+            }
+            break;
+        case EPS2_PARAM_ID_MPPT_2_MODE:
+            eps_data_buff.mppt_2_mode = *value;
+            if (eps_data_buff.mppt_2_mode == 1) // MPPT is set to manual mode
+            {
+                eps_data_buff.mppt_2_duty_cycle = 40;
+            }
+            break;
+        case EPS2_PARAM_ID_MPPT_3_MODE:
+            eps_data_buff.mppt_3_mode = *value;
+            if (eps_data_buff.mppt_3_mode == 1) // MPPT is set to manual mode
+            {
+                eps_data_buff.mppt_3_duty_cycle = 40;
+            }
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:
+            eps_data_buff.heater1_mode = *value;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:
+            eps_data_buff.heater2_mode = *value;
+            break;
+        case EPS2_PARAM_ID_DEVICE_ID:
+            eps_data_buff.device_id = *value;
+            break;
+        case EPS2_PARAM_ID_BEACON_ENABLE:
+            eps_data_buff.beacon_enable = *value;
+            break;
+        default:
+            taskEXIT_CRITICAL();
+            return -1;
+    }
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+static int eps_buffer_read_switch(uint8_t id, uint32_t *value)
+{
+    taskENTER_CRITICAL();
+    switch(id)
+    {
+        case EPS2_PARAM_ID_TIMESTAMP:
+            *value = eps_data_buff.timestamp;
+            break;
+        case EPS2_PARAM_ID_MCU_TEMP:
+            *value = eps_data_buff.eps_mcu_temp_kelvin;
+            break;
+        case EPS2_PARAM_ID_EPS_CURRENT:
+            *value = eps_data_buff.eps_beacon_ma;
+            break;
+        case EPS2_PARAM_ID_LAST_RESET_CAUSE:
+            *value = eps_data_buff.last_reset_cause;
+            break;
+        case EPS2_PARAM_ID_RESET_COUNTER:
+            *value = eps_data_buff.reset_counter;
+            break;
+        case EPS2_PARAM_ID_SP_MY_PX_VOLTAGE:
+            *value = eps_data_buff.minus_y_plus_x_solar_panel_mv;
+            break;
+        case EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE:
+            *value = eps_data_buff.minus_x_plus_z_solar_panel_mv;
+            break;
+        case EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE:
+            *value = eps_data_buff.minus_z_plus_y_solar_panel_mv;
+            break;
+        case EPS2_PARAM_ID_SP_MY_CURRENT:
+            *value = eps_data_buff.minus_y_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_SP_PY_CURRENT:
+            *value = eps_data_buff.plus_y_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_SP_MX_CURRENT:
+            *value = eps_data_buff.minus_x_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_SP_PX_CURRENT:
+            *value = eps_data_buff.plus_x_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_SP_MZ_CURRENT:
+            *value = eps_data_buff.minus_z_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_SP_PZ_CURRENT:
+            *value = eps_data_buff.plus_z_solar_panel_ma;
+            break;
+        case EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE:
+            *value = eps_data_buff.mppt_1_duty_cycle;
+            break;
+        case EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE:
+            *value = eps_data_buff.mppt_2_duty_cycle;
+            break;
+        case EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE:
+            *value = eps_data_buff.mppt_3_duty_cycle;
+            break;
+        case EPS2_PARAM_ID_SP_VOLTAGE_MPPT:
+            *value = eps_data_buff.total_solar_panels_mv;
+            break;
+        case EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE:
+            *value = eps_data_buff.main_power_buss_mv;
+            break;
+        case EPS2_PARAM_ID_RTD_0_TEMP:
+            *value = eps_data_buff.batteries_rtd0_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_1_TEMP:
+            *value = eps_data_buff.batteries_rtd1_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_2_TEMP:
+            *value = eps_data_buff.batteries_rtd2_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_3_TEMP:
+            *value = eps_data_buff.batteries_rtd3_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_4_TEMP:
+            *value = eps_data_buff.solar_panels_rtd4_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_5_TEMP:
+            *value = eps_data_buff.solar_panels_rtd5_kelvin;
+            break;
+        case EPS2_PARAM_ID_RTD_6_TEMP:
+            *value = eps_data_buff.solar_panels_rtd6_kelvin;
+            break;
+        case EPS2_PARAM_ID_BAT_VOLTAGE:
+            *value = eps_data_buff.batteries_mv;
+            break;
+        case EPS2_PARAM_ID_BAT_CURRENT:
+            *value = eps_data_buff.batteries_ma;
+            break;
+        case EPS2_PARAM_ID_BAT_AVERAGE_CURRENT:
+            *value = eps_data_buff.batteries_average_ma;
+            break;
+        case EPS2_PARAM_ID_BAT_ACC_CURRENT:
+            *value = eps_data_buff.batteries_accumulated_ma;
+            break;
+        case EPS2_PARAM_ID_BAT_CHARGE:
+            /* DEPRECATED PARAMETER! Returns the accumulated current value. */
+            *value = eps_data_buff.batteries_accumulated_ma;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_TEMP:
+            *value = eps_data_buff.bm_temp_kelvin;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_STATUS:
+            *value = eps_data_buff.bm_status_reg;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_PROTECT:
+            *value = eps_data_buff.bm_protection_reg;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_CYCLE_COUNTER:
+            *value = eps_data_buff.bm_cycle_counter_reg;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RAAC:
+            *value = eps_data_buff.bm_raac_mah;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSAC:
+            *value = eps_data_buff.bm_rsac_mah;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RARC:
+            *value = eps_data_buff.bm_rarc_percent;
+            break;
+        case EPS2_PARAM_ID_BAT_MONITOR_RSRC:
+            *value = eps_data_buff.bm_rsrc_percent;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_1_DUTY_CYCLE:
+            *value = eps_data_buff.heater1_duty_cycle;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_2_DUTY_CYCLE:
+            *value = eps_data_buff.heater2_duty_cycle;
+            break;
+        case EPS2_PARAM_ID_HW_VERSION:
+            *value = eps_data_buff.hardware_version;
+            break;
+        case EPS2_PARAM_ID_FW_VERSION:
+            *value = eps_data_buff.firmware_version;
+            break;
+        case EPS2_PARAM_ID_MPPT_1_MODE:
+            *value = eps_data_buff.mppt_1_mode;
+            break;
+        case EPS2_PARAM_ID_MPPT_2_MODE:
+            *value = eps_data_buff.mppt_2_mode;
+            break;
+        case EPS2_PARAM_ID_MPPT_3_MODE:
+            *value = eps_data_buff.mppt_3_mode;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_1_MODE:
+            *value = eps_data_buff.heater1_mode;
+            break;
+        case EPS2_PARAM_ID_BAT_HEATER_2_MODE:
+            *value = eps_data_buff.heater2_mode;
+            break;
+        case EPS2_PARAM_ID_DEVICE_ID:
+            *value = eps_data_buff.device_id;
+            break;
+        case EPS2_PARAM_ID_BEACON_ENABLE:
+            *value = eps_data_buff.beacon_enable;
+            break;
+        default:
+            taskEXIT_CRITICAL();
+            return -1;
+    }
+    taskEXIT_CRITICAL();
+
+    return 0;
+}
+
+/** \} End of eps2_data_bench group */
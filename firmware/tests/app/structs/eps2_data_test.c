@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.1
+ * \version 0.1.13
  *
- * \date 2022/04/19
+ * \date 2026/10/17
  *
  * \defgroup eps2_data_test EPS2 Data
  * \ingroup tests
@@ -40,9 +40,45 @@
 #include <setjmp.h>
 #include <cmocka.h>
 
+#include <FreeRTOS.h>
+#include <task.h>
+
 #include <app/structs/eps2_data.h>
+#include <app/structs/eps2_history.h>
+#include <system/system.h>
 #include <system/sys_log/sys_log.h>
 
+static void eps_buffer_is_written_test(void **state)
+{
+    uint32_t value = 0;
+
+    assert_false(eps_buffer_is_written(EPS2_PARAM_ID_RTD_0_TEMP));
+
+    /* A published zero is a valid value */
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_RTD_0_TEMP, &value), 0);
+    assert_true(eps_buffer_is_written(EPS2_PARAM_ID_RTD_0_TEMP));
+
+    assert_false(eps_buffer_is_written(EPS2_PARAM_ID_QTY));
+}
+
+static void eps_buffer_is_signed_test(void **state)
+{
+    uint32_t value = (uint16_t)-500;
+
+    assert_true(eps_buffer_is_signed(EPS2_PARAM_ID_BAT_CURRENT));
+    assert_true(eps_buffer_is_signed(EPS2_PARAM_ID_BAT_AVERAGE_CURRENT));
+    assert_true(eps_buffer_is_signed(EPS2_PARAM_ID_MAIN_POWER_BUS_POWER));
+    assert_false(eps_buffer_is_signed(EPS2_PARAM_ID_BAT_VOLTAGE));
+    assert_false(eps_buffer_is_signed(EPS2_PARAM_ID_QTY));
+
+#if CONFIG_SET_DUMMY_EPS == 0
+    /* The battery currents are still read without sign extension */
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_AVERAGE_CURRENT, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_AVERAGE_CURRENT, &value), 0);
+    assert_int_equal(value, 0xFE0C);
+#endif /* CONFIG_SET_DUMMY_EPS */
+}
+
 static void eps_buffer_write_test(void **state)
 {
     uint8_t id = 0;
@@ -51,12 +87,25 @@ static void eps_buffer_write_test(void **state)
     /*
      * Test valid id values
      */
-    for (id = EPS2_PARAM_ID_TIME_COUNTER; id == EPS2_PARAM_ID_DEVICE_ID; ++id)
+    for (id = EPS2_PARAM_ID_TIMESTAMP; id < EPS2_PARAM_ID_QTY; ++id)
     {
+        if ((id == EPS2_PARAM_ID_BAT_CHARGE) || (id == EPS2_PARAM_ID_RESET_EPS) || (id == EPS2_PARAM_ID_PAYLOAD_ENABLE) || (id >= EPS2_PARAM_ID_FIRST_DERIVED))
+        {
+            continue;
+        }
+
         int result = eps_buffer_write(id, &value);
         assert_return_code(result, 0);
     }
 
+    /*
+     * Test read-only and storage-less ids
+     */
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_BAT_CHARGE, &value), -1);
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_RESET_EPS, &value), -1);
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_PAYLOAD_ENABLE, &value), -1);
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_SP_INPUT_POWER, &value), -1);
+
     /*
      * Test invalid id
      */
@@ -67,23 +116,479 @@ static void eps_buffer_write_test(void **state)
 
 static void eps_buffer_read_test(void **state)
 {
+    uint32_t value = 0;
 
 #if CONFIG_SET_DUMMY_EPS == 1
-    uint32_t value = 0;
-    for (uint8_t id = EPS2_PARAM_ID_TIME_COUNTER; id < EPS2_PARAM_ID_DEVICE_ID; ++id)
+    for (uint8_t id = EPS2_PARAM_ID_TIMESTAMP; id < EPS2_PARAM_ID_BAT_HEATER_1_MODE; ++id)
     {
         int result = eps_buffer_read(id, &value);
         assert_return_code(result, 0);
         assert_true(value == id);
     }
-#endif
+#else
+    uint8_t id = 0;
+
+    /*
+     * Test the round trip of every width
+     */
+    for (id = EPS2_PARAM_ID_TIMESTAMP; id < EPS2_PARAM_ID_QTY; ++id)
+    {
+        uint32_t wr = 0xA5A5A5A5UL;
+        uint32_t rd = 0;
+
+        /* Commands are write-only */
+        if ((id == EPS2_PARAM_ID_STATS_SELECT) || (id == EPS2_PARAM_ID_HISTORY_SELECT) || (id == EPS2_PARAM_ID_HISTORY_NEXT) ||
+            (eps_buffer_write(id, &wr) != 0))
+        {
+            continue;
+        }
+
+        assert_return_code(eps_buffer_read(id, &rd), 0);
+        assert_true(rd != 0);
+        assert_true((rd == 0xA5UL) || (rd == 0xA5A5UL) || (rd == 0xA5A5A5A5UL));
+    }
+
+    /*
+     * The deprecated battery charge returns the accumulated current
+     */
+    value = 1234;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_ACC_CURRENT, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_CHARGE, &value), 0);
+    assert_int_equal(value, 1234);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    assert_int_equal(eps_buffer_read(EPS2_PARAM_ID_RESET_EPS, &value), -1);
+    assert_int_equal(eps_buffer_read(EPS2_PARAM_ID_QTY, &value), -1);
+}
+
+static void eps_buffer_mppt_mode_hook_test(void **state)
+{
+#if CONFIG_SET_DUMMY_EPS == 0
+    uint32_t value = 80;
+
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE, &value), 0);
+
+    /* Automatic mode keeps the duty cycle */
+    value = 0;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_2_MODE, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE, &value), 0);
+    assert_int_equal(value, 80);
+
+    /* Manual mode resets the duty cycle to 40 %, published as a second write */
+    value = 1;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_2_MODE, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_MPPT_2_DUTY_CYCLE, &value), 0);
+    assert_int_equal(value, EPS_DATA_MPPT_MANUAL_DUTY);
+
+    /* Same for a batch write */
+    const uint8_t ids[] = {EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE, EPS2_PARAM_ID_MPPT_3_MODE};
+    const uint32_t values[] = {80, 1};
+
+    assert_return_code(eps_buffer_write_many(ids, 2, values), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_MPPT_3_DUTY_CYCLE, &value), 0);
+    assert_int_equal(value, EPS_DATA_MPPT_MANUAL_DUTY);
+#endif /* CONFIG_SET_DUMMY_EPS */
+}
+
+static void eps_buffer_write_many_test(void **state)
+{
+    const uint8_t ids[] = {EPS2_PARAM_ID_MPPT_1_MODE, EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE, EPS2_PARAM_ID_RTD_0_TEMP, EPS2_PARAM_ID_TIMESTAMP};
+    const uint32_t values[] = {0, 75, 296, 123456UL};
+
+    assert_return_code(eps_buffer_write_many(ids, sizeof(ids), values), 0);
+
+#if CONFIG_SET_DUMMY_EPS == 0
+    uint32_t out[sizeof(ids)] = {0};
+
+    assert_return_code(eps_buffer_read_many(ids, sizeof(ids), out), 0);
+    assert_memory_equal(out, values, sizeof(values));
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    /* Empty list */
+    assert_return_code(eps_buffer_write_many(ids, 0, values), 0);
+
+    /* Invalid lists */
+    assert_int_equal(eps_buffer_write_many(NULL, 1, values), -1);
+    assert_int_equal(eps_buffer_write_many(ids, 1, NULL), -1);
+}
+
+static void eps_buffer_write_many_invalid_id_test(void **state)
+{
+    const uint8_t ids[] = {EPS2_PARAM_ID_BAT_VOLTAGE, EPS2_PARAM_ID_RESET_EPS};
+    const uint32_t values[] = {4000, 1};
+    uint32_t value = 3900;
+
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_VOLTAGE, &value), 0);
+
+    /* Nothing is written if any ID of the list is invalid */
+    assert_int_equal(eps_buffer_write_many(ids, sizeof(ids), values), -1);
+
+#if CONFIG_SET_DUMMY_EPS == 0
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_VOLTAGE, &value), 0);
+    assert_int_equal(value, 3900);
+#endif /* CONFIG_SET_DUMMY_EPS */
+}
+
+static void eps_buffer_read_many_test(void **state)
+{
+    const uint8_t ids[] = {EPS2_PARAM_ID_DEVICE_ID, EPS2_PARAM_ID_BAT_CHARGE, EPS2_PARAM_ID_HW_VERSION};
+    const uint8_t bad_ids[] = {EPS2_PARAM_ID_DEVICE_ID, EPS2_PARAM_ID_QTY};
+    uint32_t out[sizeof(ids)] = {0};
+    uint32_t value = 0xEEE2;
+
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_DEVICE_ID, &value), 0);
+
+    assert_return_code(eps_buffer_read_many(ids, sizeof(ids), out), 0);
+    assert_int_equal(out[0], 0xEEE2);
+
+    assert_int_equal(eps_buffer_read_many(bad_ids, sizeof(bad_ids), out), -1);
+    assert_int_equal(eps_buffer_read_many(NULL, 1, out), -1);
+    assert_int_equal(eps_buffer_read_many(ids, 1, NULL), -1);
+}
+
+static void eps_buffer_subscribe_test(void **state)
+{
+    TaskHandle_t subscriber = (TaskHandle_t)0x1234;
+    TaskHandle_t writer = (TaskHandle_t)0x5678;
+    const uint8_t ids[] = {EPS2_PARAM_ID_MPPT_1_MODE, EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE};
+    const uint8_t many_ids[] = {EPS2_PARAM_ID_BAT_VOLTAGE, EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE, EPS2_PARAM_ID_MPPT_1_MODE};
+    const uint32_t many_values[] = {4000, 45, 1};
+    uint32_t value = 1;
+
+    assert_return_code(eps_buffer_subscribe(subscriber, ids, sizeof(ids), 0x04), 0);
+
+    /* Watched parameter written by another task (the manual mode also notifies the chained duty cycle write) */
+    will_return_count(xTaskGetCurrentTaskHandle, writer, 2);
+    expect_value_count(xTaskNotify, xTaskToNotify, subscriber, 2);
+    expect_value_count(xTaskNotify, ulValue, 0x04, 2);
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_1_MODE, &value), 0);
+
+    /* Parameter not watched: no notification */
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_CURRENT, &value), 0);
+
+    /* Changes made by the subscriber itself are not notified */
+    will_return(xTaskGetCurrentTaskHandle, subscriber);
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_1_DUTY_CYCLE, &value), 0);
+
+    /* A single notification for a list with several watched parameters (plus the chained duty cycle write) */
+    will_return_count(xTaskGetCurrentTaskHandle, writer, 2);
+    expect_value_count(xTaskNotify, xTaskToNotify, subscriber, 2);
+    expect_value_count(xTaskNotify, ulValue, 0x04, 2);
+    assert_return_code(eps_buffer_write_many(many_ids, sizeof(many_ids), many_values), 0);
+
+    /* Invalid subscriptions */
+    assert_int_equal(eps_buffer_subscribe(NULL, ids, sizeof(ids), 0x04), -1);
+    assert_int_equal(eps_buffer_subscribe(writer, ids, sizeof(ids), 0), -1);
+}
+
+static void eps_buffer_publish_time_test(void **state)
+{
+    uint32_t value = 5000;
+
+    /* A write from the OBDH sets the system time */
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_TIMESTAMP, &value), 0);
+    assert_int_equal(system_get_time(), 5000);
+
+    system_set_time(5001);
+
+    assert_return_code(eps_buffer_publish_time(), 0);
+
+#if CONFIG_SET_DUMMY_EPS == 0
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_TIMESTAMP, &value), 0);
+    assert_int_equal(value, 5001);
+#endif /* CONFIG_SET_DUMMY_EPS */
+    assert_int_equal(system_get_time(), 5001);
+}
+
+static void eps_buffer_read_beacon_test(void **state)
+{
+    uint8_t beacon[EPS_DATA_BEACON_BYTES] = {0};
+    uint8_t ids[] = {EPS2_PARAM_ID_BAT_VOLTAGE, EPS2_PARAM_ID_RTD_6_TEMP};
+    uint32_t values[] = {7400, 0x12345};
+    uint32_t value = 0;
+
+    assert_return_code(eps_buffer_init(), 0);
+
+    value = 0x01020304;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_TIMESTAMP, &value), 0);
+
+    /* The MPPT mode hook changes the duty cycle */
+    value = 1;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_MPPT_2_MODE, &value), 0);
+
+    /* The deprecated battery charge follows the accumulated current */
+    value = 0xABCD;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_ACC_CURRENT, &value), 0);
+
+    /* The values are truncated to the width of the fields */
+    assert_return_code(eps_buffer_write_many(ids, sizeof(ids), values), 0);
+
+    assert_return_code(eps_buffer_read_beacon(beacon), 0);
+
+    /* Positions in BEACON_PARAM_ID_LIST */
+    const uint8_t timestamp[4] = {0x01, 0x02, 0x03, 0x04};
+    const uint8_t mppt_2_duty[4] = {0x00, 0x00, 0x00, 40};
+    const uint8_t rtd_6[4] = {0x00, 0x00, 0x23, 0x45};
+    const uint8_t bat_mv[4] = {0x00, 0x00, 0x1C, 0xE8};
+    const uint8_t bat_charge[4] = {0x00, 0x00, 0xAB, 0xCD};
+
+    assert_memory_equal(&beacon[4 * 0], timestamp, 4);
+    assert_memory_equal(&beacon[4 * 14], mppt_2_duty, 4);
+    assert_memory_equal(&beacon[4 * 24], rtd_6, 4);
+    assert_memory_equal(&beacon[4 * 25], bat_mv, 4);
+    assert_memory_equal(&beacon[4 * 27], bat_charge, 4);
+
+    assert_int_equal(eps_buffer_read_beacon(NULL), -1);
+}
+
+static int eps_buffer_test_acquire(uint8_t id, uint32_t *value)
+{
+    *value = mock_type(uint32_t);
+
+    return mock_type(int);
+}
+
+static void eps_buffer_set_acquire_test(void **state)
+{
+    uint32_t value = 0;
+
+    /* Invalid registrations */
+    assert_int_equal(eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RAAC, NULL, 1000), -1);
+    assert_int_equal(eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_CHARGE, eps_buffer_test_acquire, 1000), -1);
+    assert_int_equal(eps_buffer_set_acquire(EPS2_PARAM_ID_QTY, eps_buffer_test_acquire, 1000), -1);
+
+    assert_return_code(eps_buffer_set_acquire(EPS2_PARAM_ID_BAT_MONITOR_RAAC, eps_buffer_test_acquire, 1000), 0);
+
+    /* Never written: acquired on the first read */
+    will_return(eps_buffer_test_acquire, 1234);
+    will_return(eps_buffer_test_acquire, 0);
+    will_return(xTaskGetTickCount, 100);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_MONITOR_RAAC, &value), 0);
+    assert_int_equal(value, 1234);
+
+    /* Fresh value: no acquisition */
+    will_return(xTaskGetTickCount, 600);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_MONITOR_RAAC, &value), 0);
+    assert_int_equal(value, 1234);
+
+    /* Stale value: acquired again (also through read_many) */
+    uint8_t ids[] = {EPS2_PARAM_ID_DEVICE_ID, EPS2_PARAM_ID_BAT_MONITOR_RAAC};
+    uint32_t out[2] = {0};
+
+    will_return(xTaskGetTickCount, 1100);
+    will_return(eps_buffer_test_acquire, 4321);
+    will_return(eps_buffer_test_acquire, 0);
+    will_return(xTaskGetTickCount, 1100);
+
+    assert_return_code(eps_buffer_read_many(ids, sizeof(ids), out), 0);
+    assert_int_equal(out[1], 4321);
+
+    /* A write from a task also refreshes the value */
+    value = 2000;
+    will_return(xTaskGetTickCount, 1500);
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_MONITOR_RAAC, &value), 0);
+
+    will_return(xTaskGetTickCount, 2400);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_MONITOR_RAAC, &value), 0);
+    assert_int_equal(value, 2000);
+
+    /* Acquisition error: the last value is kept */
+    will_return(xTaskGetTickCount, 2600);
+    will_return(eps_buffer_test_acquire, 0);
+    will_return(eps_buffer_test_acquire, -1);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_BAT_MONITOR_RAAC, &value), 0);
+    assert_int_equal(value, 2000);
+}
+
+static void eps_buffer_derived_test(void **state)
+{
+    uint32_t value = 0;
+
+#if CONFIG_SET_DUMMY_EPS == 1
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_SP_INPUT_POWER, &value), 0);
+    assert_int_equal(value, EPS2_PARAM_ID_SP_INPUT_POWER);
+#else
+    const uint8_t src_ids[] = {EPS2_PARAM_ID_SP_MY_PX_VOLTAGE, EPS2_PARAM_ID_SP_MY_CURRENT, EPS2_PARAM_ID_SP_PX_CURRENT,
+                               EPS2_PARAM_ID_SP_MX_PZ_VOLTAGE, EPS2_PARAM_ID_SP_MX_CURRENT, EPS2_PARAM_ID_SP_PZ_CURRENT,
+                               EPS2_PARAM_ID_SP_MZ_PY_VOLTAGE, EPS2_PARAM_ID_SP_MZ_CURRENT, EPS2_PARAM_ID_SP_PY_CURRENT,
+                               EPS2_PARAM_ID_MAIN_POWER_BUS_VOLTAGE, EPS2_PARAM_ID_BAT_CURRENT, EPS2_PARAM_ID_EPS_CURRENT};
+    const uint32_t src_values[] = {8000, 100, 50,
+                                   7000, 200, 0,
+                                   0, 300, 300,
+                                   8000, (uint32_t)-100, 300};
+    const uint8_t ids[] = {EPS2_PARAM_ID_MPPT_1_POWER, EPS2_PARAM_ID_MPPT_2_POWER, EPS2_PARAM_ID_MPPT_3_POWER,
+                           EPS2_PARAM_ID_SP_INPUT_POWER, EPS2_PARAM_ID_MAIN_POWER_BUS_POWER, EPS2_PARAM_ID_MPPT_EFFICIENCY};
+    uint32_t out[sizeof(ids)] = {0};
+
+    assert_return_code(eps_buffer_write_many(src_ids, sizeof(src_ids), src_values), 0);
+
+    /* Computed on the first read, then cached */
+    assert_return_code(eps_buffer_read_many(ids, sizeof(ids), out), 0);
+    assert_int_equal(out[0], 1200);
+    assert_int_equal(out[1], 1400);
+    assert_int_equal(out[2], 0);
+    assert_int_equal(out[3], 2600);
+    assert_int_equal(out[4], 1600);     /* -800 mW to the batteries + 2400 mW of the EPS */
+    assert_int_equal(out[5], 615);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_SP_INPUT_POWER, &value), 0);
+    assert_int_equal(value, 2600);
+
+    /* A write to a source invalidates only the dependent parameters */
+    value = 200;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_SP_MY_CURRENT, &value), 0);
+
+    assert_return_code(eps_buffer_read_many(ids, sizeof(ids), out), 0);
+    assert_int_equal(out[0], 2000);
+    assert_int_equal(out[1], 1400);
+    assert_int_equal(out[3], 3400);
+    assert_int_equal(out[4], 1600);
+    assert_int_equal(out[5], 470);
+
+    /* Signed bus power, and no efficiency without power delivered to the bus */
+    value = (uint32_t)-1000;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_CURRENT, &value), 0);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_MAIN_POWER_BUS_POWER, &value), 0);
+    assert_int_equal((int32_t)value, -5600);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_MPPT_EFFICIENCY, &value), 0);
+    assert_int_equal(value, 0);
+
+    /* A write to another source of the same derived parameter */
+    value = 0;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_SP_MY_PX_VOLTAGE, &value), 0);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_SP_INPUT_POWER, &value), 0);
+    assert_int_equal(value, 1400);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_MPPT_EFFICIENCY, &value), -1);
+}
+
+static void eps_buffer_stats_test(void **state)
+{
+    uint32_t value = 0;
+
+#if (CONFIG_SET_DUMMY_EPS == 0) && (CONFIG_STATS_ENABLED == 1)
+    const uint32_t samples[] = {7400, 7500, 7600};
+    uint8_t i = 0;
+
+    /* Restart the statistics of the battery voltage */
+    value = EPS2_PARAM_ID_BAT_VOLTAGE;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_STATS_SELECT, &value), 0);
+
+    for(i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+    {
+        value = samples[i];
+        assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_VOLTAGE, &value), 0);
+    }
+
+    value = EPS2_PARAM_ID_BAT_VOLTAGE;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_STATS_SELECT, &value), 0);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_PARAM_ID, &value), 0);
+    assert_int_equal(value, EPS2_PARAM_ID_BAT_VOLTAGE);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_COUNT, &value), 0);
+    assert_int_equal(value, 3);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_MIN, &value), 0);
+    assert_int_equal(value, 7400);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_MAX, &value), 0);
+    assert_int_equal(value, 7600);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_MEAN, &value), 0);
+    assert_int_equal(value, 7500);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_STDDEV, &value), 0);
+    assert_int_equal(value, 82);
+
+    /* The latch restarted the accumulation */
+    value = EPS2_PARAM_ID_BAT_VOLTAGE;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_STATS_SELECT, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_STATS_COUNT, &value), 0);
+    assert_int_equal(value, 0);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    assert_int_equal(eps_buffer_read(EPS2_PARAM_ID_STATS_SELECT, &value), -1);
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_STATS_MEAN, &value), -1);
+}
+
+static void eps_buffer_history_test(void **state)
+{
+    uint32_t value = 0;
+
+#if (CONFIG_SET_DUMMY_EPS == 0) && (CONFIG_HISTORY_ENABLED == 1)
+    assert_return_code(eps_history_init(), 0);
+
+    system_set_time(1000);
+    value = 7400;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_VOLTAGE, &value), 0);
+
+    system_set_time(1002);
+    value = 7450;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_BAT_VOLTAGE, &value), 0);
+
+    /* Oldest raw sample of the battery voltage */
+    value = ((uint32_t)EPS2_PARAM_ID_BAT_VOLTAGE << 8) | EPS_HISTORY_TIER_RAW;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_HISTORY_SELECT, &value), 0);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_TIME, &value), 0);
+    assert_int_equal(value, 1000);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_AVG, &value), 0);
+    assert_int_equal(value, 7400);
+
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_HISTORY_NEXT, &value), 0);
+
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_TIME, &value), 0);
+    assert_int_equal(value, 1002);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_MIN, &value), 0);
+    assert_int_equal(value, 7450);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_MAX, &value), 0);
+    assert_int_equal(value, 7450);
+
+    /* End of the history */
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_HISTORY_NEXT, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_TIME, &value), 0);
+    assert_int_equal(value, EPS_HISTORY_NO_SAMPLE);
+
+    /* Parameter without history */
+    value = ((uint32_t)EPS2_PARAM_ID_DEVICE_ID << 8) | EPS_HISTORY_TIER_RAW;
+    assert_return_code(eps_buffer_write(EPS2_PARAM_ID_HISTORY_SELECT, &value), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_TIME, &value), 0);
+    assert_int_equal(value, EPS_HISTORY_NO_SAMPLE);
+
+    /* Selection through a batch write */
+    const uint8_t ids[] = {EPS2_PARAM_ID_HISTORY_SELECT};
+    const uint32_t values[] = {((uint32_t)EPS2_PARAM_ID_BAT_VOLTAGE << 8) | EPS_HISTORY_TIER_RAW};
+
+    assert_return_code(eps_buffer_write_many(ids, 1, values), 0);
+    assert_return_code(eps_buffer_read(EPS2_PARAM_ID_HISTORY_TIME, &value), 0);
+    assert_int_equal(value, 1000);
+#endif /* CONFIG_SET_DUMMY_EPS */
+
+    assert_int_equal(eps_buffer_read(EPS2_PARAM_ID_HISTORY_SELECT, &value), -1);
+    assert_int_equal(eps_buffer_write(EPS2_PARAM_ID_HISTORY_AVG, &value), -1);
 }
 
 int main(void)
 {
     const struct CMUnitTest eps_data_tests[] = {
+        cmocka_unit_test(eps_buffer_is_written_test),
+        cmocka_unit_test(eps_buffer_is_signed_test),
         cmocka_unit_test(eps_buffer_write_test),
         cmocka_unit_test(eps_buffer_read_test),
+        cmocka_unit_test(eps_buffer_mppt_mode_hook_test),
+        cmocka_unit_test(eps_buffer_write_many_test),
+        cmocka_unit_test(eps_buffer_write_many_invalid_id_test),
+        cmocka_unit_test(eps_buffer_read_many_test),
+        cmocka_unit_test(eps_buffer_subscribe_test),
+        cmocka_unit_test(eps_buffer_publish_time_test),
+        cmocka_unit_test(eps_buffer_read_beacon_test),
+        cmocka_unit_test(eps_buffer_set_acquire_test),
+        cmocka_unit_test(eps_buffer_derived_test),
+        cmocka_unit_test(eps_buffer_stats_test),
+        cmocka_unit_test(eps_buffer_history_test),
     };
 
     return cmocka_run_group_tests(eps_data_tests, NULL, NULL);
@@ -0,0 +1,225 @@
+/*
+ * eps2_history_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the EPS2 telemetry history.
+ *
+ * \version 0.1.2
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup eps2_history_test EPS2 History
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <app/structs/eps2_data.h>
+#include <app/structs/eps2_history.h>
+
+#define EPS_HISTORY_TEST_T0     (10UL * EPS_HISTORY_10MIN_PERIOD_S)
+
+static int eps_history_test_setup(void **state)
+{
+    return eps_history_init();
+}
+
+static void eps_history_tracked_test(void **state)
+{
+    assert_int_equal(eps_history_is_tracked(EPS2_PARAM_ID_BAT_VOLTAGE), 1);
+    assert_int_equal(eps_history_is_tracked(EPS2_PARAM_ID_DEVICE_ID), 0);
+
+    eps_history_sample_t out[1];
+    uint8_t n = 0;
+
+    assert_int_equal(eps_history_query(EPS2_PARAM_ID_DEVICE_ID, EPS_HISTORY_TIER_RAW, 0, UINT32_MAX, out, 1, &n), -1);
+    assert_int_equal(eps_history_query(EPS2_PARAM_ID_BAT_VOLTAGE, EPS_HISTORY_TIER_QTY, 0, UINT32_MAX, out, 1, &n), -1);
+    assert_int_equal(eps_history_query(EPS2_PARAM_ID_BAT_VOLTAGE, EPS_HISTORY_TIER_RAW, 10, 0, out, 1, &n), -1);
+
+    /* Not tracked parameters are ignored */
+    eps_history_push(EPS2_PARAM_ID_DEVICE_ID, 0xEEE2, EPS_HISTORY_TEST_T0);
+}
+
+static void eps_history_raw_test(void **state)
+{
+    eps_history_sample_t out[CONFIG_HISTORY_RAW_DEPTH];
+    uint8_t n = 0;
+    uint32_t i = 0;
+
+    /* Overflow the raw ring, one sample every 2 seconds */
+    for(i = 0; i < CONFIG_HISTORY_RAW_DEPTH + 4U; i++)
+    {
+        eps_history_push(EPS2_PARAM_ID_BAT_VOLTAGE, 7000U + i, EPS_HISTORY_TEST_T0 + (2U * i));
+    }
+
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_VOLTAGE, EPS_HISTORY_TIER_RAW, 0, UINT32_MAX, out, CONFIG_HISTORY_RAW_DEPTH, &n), 0);
+    assert_int_equal(n, CONFIG_HISTORY_RAW_DEPTH);
+
+    for(i = 0; i < n; i++)
+    {
+        assert_int_equal(out[i].time, EPS_HISTORY_TEST_T0 + (2U * (i + 4U)));
+        assert_int_equal(out[i].avg, 7000 + i + 4);
+    }
+
+    /* Time range */
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_VOLTAGE, EPS_HISTORY_TIER_RAW, EPS_HISTORY_TEST_T0 + 10U, EPS_HISTORY_TEST_T0 + 14U, out, CONFIG_HISTORY_RAW_DEPTH, &n), 0);
+    assert_int_equal(n, 3);
+    assert_int_equal(out[0].time, EPS_HISTORY_TEST_T0 + 10U);
+    assert_int_equal(out[2].avg, 7007);
+
+    /* Output capacity */
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_VOLTAGE, EPS_HISTORY_TIER_RAW, 0, UINT32_MAX, out, 2, &n), 0);
+    assert_int_equal(n, 2);
+    assert_int_equal(out[1].avg, 7005);
+}
+
+static void eps_history_buckets_test(void **state)
+{
+    eps_history_sample_t out[4];
+    uint8_t n = 0;
+    uint32_t i = 0;
+
+    /* Signed values, 1 sample every 10 seconds during 3 minutes */
+    for(i = 0; i < 18U; i++)
+    {
+        int16_t ma = (int16_t)((i % 6U) * 100) - 300;
+
+        eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, (uint16_t)ma, EPS_HISTORY_TEST_T0 + (10U * i));
+    }
+
+    /* The third minute is still open */
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_1MIN, 0, UINT32_MAX, out, 4, &n), 0);
+    assert_int_equal(n, 2);
+
+    for(i = 0; i < n; i++)
+    {
+        assert_int_equal(out[i].time, EPS_HISTORY_TEST_T0 + (EPS_HISTORY_1MIN_PERIOD_S * i));
+        assert_int_equal(out[i].min, -300);
+        assert_int_equal(out[i].max, 200);
+        assert_int_equal(out[i].avg, -50);
+    }
+
+    /* The 10-minute bucket is still open */
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_10MIN, 0, UINT32_MAX, out, 4, &n), 0);
+    assert_int_equal(n, 0);
+
+    /* A gap of 2 minutes: one empty bucket is skipped by the query */
+    eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, 0, EPS_HISTORY_TEST_T0 + (4U * EPS_HISTORY_1MIN_PERIOD_S));
+
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_1MIN, 0, UINT32_MAX, out, 4, &n), 0);
+    assert_int_equal(n, 3);
+    assert_int_equal(out[2].time, EPS_HISTORY_TEST_T0 + (2U * EPS_HISTORY_1MIN_PERIOD_S));
+
+    /* Closing the 10-minute bucket */
+    eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, 0, EPS_HISTORY_TEST_T0 + EPS_HISTORY_10MIN_PERIOD_S);
+
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_10MIN, 0, UINT32_MAX, out, 4, &n), 0);
+    assert_int_equal(n, 1);
+    assert_int_equal(out[0].time, EPS_HISTORY_TEST_T0);
+    assert_int_equal(out[0].min, -300);
+    assert_int_equal(out[0].max, 200);
+}
+
+static void eps_history_time_jump_test(void **state)
+{
+    eps_history_sample_t out[2];
+    uint8_t n = 0;
+
+    eps_history_push(EPS2_PARAM_ID_RTD_0_TEMP, 300, EPS_HISTORY_TEST_T0);
+    eps_history_push(EPS2_PARAM_ID_RTD_0_TEMP, 301, EPS_HISTORY_TEST_T0 + 1U);
+
+    /* Time sync to the past */
+    eps_history_push(EPS2_PARAM_ID_RTD_0_TEMP, 302, 100);
+
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_RTD_0_TEMP, EPS_HISTORY_TIER_RAW, 0, UINT32_MAX, out, 2, &n), 0);
+    assert_int_equal(n, 1);
+    assert_int_equal(out[0].time, 100);
+    assert_int_equal(out[0].avg, 302);
+
+    /* Saturated unsigned values */
+    eps_history_push(EPS2_PARAM_ID_RTD_0_TEMP, 0x12345UL, 101);
+
+    assert_return_code(eps_history_query(EPS2_PARAM_ID_RTD_0_TEMP, EPS_HISTORY_TIER_RAW, 101, 101, out, 2, &n), 0);
+    assert_int_equal(n, 1);
+    assert_int_equal(out[0].avg, 0xFFFF);
+}
+
+static void eps_history_cursor_test(void **state)
+{
+    eps_history_sample_t sample;
+
+    /* Two raw samples in the same second and a later one */
+    eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, (uint32_t)-120, EPS_HISTORY_TEST_T0);
+    eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, (uint32_t)-110, EPS_HISTORY_TEST_T0);
+    eps_history_push(EPS2_PARAM_ID_BAT_CURRENT, 80, EPS_HISTORY_TEST_T0 + 5U);
+
+    assert_return_code(eps_history_select(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_RAW, &sample), 0);
+    assert_int_equal(sample.time, EPS_HISTORY_TEST_T0);
+
+    /* Nothing is visible before the latch */
+    assert_int_equal(eps_history_read(EPS_HISTORY_FIELD_TIME), EPS_HISTORY_NO_SAMPLE);
+
+    eps_history_latch(&sample);
+    assert_int_equal(eps_history_read(EPS_HISTORY_FIELD_TIME), EPS_HISTORY_TEST_T0);
+    assert_int_equal((int32_t)eps_history_read(EPS_HISTORY_FIELD_AVG), -120);
+
+    /* The sample in the same second is skipped */
+    assert_return_code(eps_history_next(&sample), 0);
+    eps_history_latch(&sample);
+    assert_int_equal(eps_history_read(EPS_HISTORY_FIELD_TIME), EPS_HISTORY_TEST_T0 + 5U);
+    assert_int_equal(eps_history_read(EPS_HISTORY_FIELD_MIN), 80);
+
+    assert_int_equal(eps_history_next(&sample), -1);
+    eps_history_latch(&sample);
+    assert_int_equal(eps_history_read(EPS_HISTORY_FIELD_TIME), EPS_HISTORY_NO_SAMPLE);
+    assert_int_equal(eps_history_next(&sample), -1);
+    assert_int_equal(sample.time, EPS_HISTORY_NO_SAMPLE);
+
+    /* No history and invalid tier */
+    assert_int_equal(eps_history_select(EPS2_PARAM_ID_DEVICE_ID, EPS_HISTORY_TIER_RAW, &sample), -1);
+    assert_int_equal(sample.time, EPS_HISTORY_NO_SAMPLE);
+    assert_int_equal(eps_history_select(EPS2_PARAM_ID_BAT_CURRENT, EPS_HISTORY_TIER_QTY, &sample), -1);
+    assert_int_equal(sample.avg, 0);
+}
+
+int main(void)
+{
+    const struct CMUnitTest eps_history_tests[] = {
+        cmocka_unit_test_setup(eps_history_tracked_test, eps_history_test_setup),
+        cmocka_unit_test_setup(eps_history_raw_test, eps_history_test_setup),
+        cmocka_unit_test_setup(eps_history_buckets_test, eps_history_test_setup),
+        cmocka_unit_test_setup(eps_history_time_jump_test, eps_history_test_setup),
+        cmocka_unit_test_setup(eps_history_cursor_test, eps_history_test_setup),
+    };
+
+    return cmocka_run_group_tests(eps_history_tests, NULL, NULL);
+}
+
+/** \} End of eps2_history_test group */
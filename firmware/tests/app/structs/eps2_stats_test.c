@@ -0,0 +1,136 @@
+/*
+ * eps2_stats_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the EPS2 running statistics.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup eps2_stats_test EPS2 Stats
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <app/structs/eps2_data.h>
+#include <app/structs/eps2_stats.h>
+
+static int eps_stats_test_setup(void **state)
+{
+    return eps_stats_init();
+}
+
+static void eps_stats_tracked_test(void **state)
+{
+    assert_int_equal(eps_stats_is_tracked(EPS2_PARAM_ID_BAT_VOLTAGE), 1);
+    assert_int_equal(eps_stats_is_tracked(EPS2_PARAM_ID_DEVICE_ID), 0);
+
+    /* Not tracked parameters are ignored, and latched with no samples */
+    eps_stats_push(EPS2_PARAM_ID_DEVICE_ID, 0xEEE2);
+
+    assert_int_equal(eps_stats_latch(EPS2_PARAM_ID_DEVICE_ID), -1);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_PARAM_ID), EPS2_PARAM_ID_DEVICE_ID);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_COUNT), 0);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MEAN), 0);
+}
+
+static void eps_stats_unsigned_test(void **state)
+{
+    const uint32_t samples[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    uint8_t i = 0;
+
+    for(i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+    {
+        eps_stats_push(EPS2_PARAM_ID_RTD_0_TEMP, samples[i]);
+    }
+
+    assert_return_code(eps_stats_latch(EPS2_PARAM_ID_RTD_0_TEMP), 0);
+
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_PARAM_ID), EPS2_PARAM_ID_RTD_0_TEMP);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_COUNT), 8);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MIN), 2);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MAX), 9);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MEAN), 5);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_STDDEV), 2);
+
+    /* The latch restarted the accumulation */
+    eps_stats_push(EPS2_PARAM_ID_RTD_0_TEMP, 0x12345UL);
+
+    assert_return_code(eps_stats_latch(EPS2_PARAM_ID_RTD_0_TEMP), 0);
+
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_COUNT), 1);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MIN), 0xFFFF);     /* Saturated */
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MEAN), 0xFFFF);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_STDDEV), 0);
+}
+
+static void eps_stats_signed_test(void **state)
+{
+    const int16_t samples[] = {-300, -100, 100, 500};
+    uint8_t i = 0;
+
+    for(i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+    {
+        eps_stats_push(EPS2_PARAM_ID_BAT_CURRENT, (uint16_t)samples[i]);
+    }
+
+    assert_return_code(eps_stats_latch(EPS2_PARAM_ID_BAT_CURRENT), 0);
+
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_COUNT), 4);
+    assert_int_equal((int32_t)eps_stats_read(EPS_STATS_FIELD_MIN), -300);
+    assert_int_equal((int32_t)eps_stats_read(EPS_STATS_FIELD_MAX), 500);
+    assert_int_equal((int32_t)eps_stats_read(EPS_STATS_FIELD_MEAN), 50);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_STDDEV), 296);
+
+    /* Other parameters keep their statistics */
+    eps_stats_push(EPS2_PARAM_ID_BAT_VOLTAGE, 7000);
+    eps_stats_push(EPS2_PARAM_ID_BAT_VOLTAGE, 7001);
+
+    assert_return_code(eps_stats_latch(EPS2_PARAM_ID_BAT_VOLTAGE), 0);
+
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_COUNT), 2);
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_MEAN), 7001);      /* 7000.5, rounded half up */
+    assert_int_equal(eps_stats_read(EPS_STATS_FIELD_STDDEV), 1);       /* 0.5, rounded half up */
+}
+
+int main(void)
+{
+    const struct CMUnitTest eps_stats_tests[] = {
+        cmocka_unit_test_setup(eps_stats_tracked_test, eps_stats_test_setup),
+        cmocka_unit_test_setup(eps_stats_unsigned_test, eps_stats_test_setup),
+        cmocka_unit_test_setup(eps_stats_signed_test, eps_stats_test_setup),
+    };
+
+    return cmocka_run_group_tests(eps_stats_tests, NULL, NULL);
+}
+
+/** \} End of eps2_stats_test group */
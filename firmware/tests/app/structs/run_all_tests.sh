@@ -1,3 +1,5 @@
 #!/bin/bash
 
 ./eps2_data_unit_test
+./eps2_history_unit_test
+./eps2_stats_unit_test
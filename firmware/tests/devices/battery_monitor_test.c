@@ -26,9 +26,9 @@
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  * \author Ramon de Araujo Borba <ramonborba07@gmail.com>
  *
- * \version 0.4.0
+ * \version 0.4.2
  *
- * \date 2022/07/12
+ * \date 2026/10/17
  *
  * \defgroup battery_monitor_test Battery Monitor
  * \ingroup tests
@@ -58,6 +58,68 @@ static void battery_monitor_init_test(void **state)
     assert_return_code(battery_monitor_init(), 0);
 }
 
+static void bm_get_data_test(void **state)
+{
+    bm_data_t data = {0};
+    ds277Xg_snapshot_t snap = {.protection = 0x0C, .status = 0x80, .raac_raw = 100, .rsac_raw = 200, .rarc = 50, .rsrc = 60,
+                               .average_current_ma = -150, .temperature_kelvin = 298, .voltage_mv = {3700, 3800},
+                               .current_ma = -200, .acc_current_mah = 1500, .cycle_counter = 7};
+
+    /* First read */
+    will_return(xTaskGetTickCount, 1000);
+    will_return(__wrap_ds277Xg_read_snapshot, 0);
+    will_return(__wrap_ds277Xg_read_snapshot, &snap);
+
+    assert_return_code(bm_get_data(&data, 50), 0);
+    assert_int_equal(data.voltage, 7500);
+    assert_int_equal(data.current, -200);
+    assert_int_equal(data.average_current, -150);
+    assert_int_equal(data.temperature, 298);
+    assert_int_equal(data.acc_current, 1500);
+    assert_int_equal(data.status, 0x80);
+    assert_int_equal(data.protection, 0x0C);
+    assert_int_equal(data.raac, 160);
+    assert_int_equal(data.rsac, 320);
+    assert_int_equal(data.rarc, 50);
+    assert_int_equal(data.rsrc, 60);
+    assert_int_equal(data.cycle_counter, 7);
+
+    /* Young snapshot, no bus transaction */
+    snap.current_ma = 300;
+
+    will_return(xTaskGetTickCount, 1049);
+
+    assert_return_code(bm_get_data(&data, 50), 0);
+    assert_int_equal(data.current, -200);
+
+    /* Old snapshot */
+    will_return(xTaskGetTickCount, 1050);
+    will_return(__wrap_ds277Xg_read_snapshot, 0);
+    will_return(__wrap_ds277Xg_read_snapshot, &snap);
+
+    assert_return_code(bm_get_data(&data, 50), 0);
+    assert_int_equal(data.current, 300);
+
+    /* Always read with a zero maximum age */
+    will_return(xTaskGetTickCount, 1051);
+    will_return(__wrap_ds277Xg_read_snapshot, 0);
+    will_return(__wrap_ds277Xg_read_snapshot, &snap);
+
+    assert_return_code(bm_get_data(&data, 0), 0);
+
+    /* A read error invalidates the snapshot (read again even if young) */
+    will_return(xTaskGetTickCount, 1052);
+    will_return(__wrap_ds277Xg_read_snapshot, -1);
+
+    assert_int_equal(bm_get_data(&data, 0), -1);
+
+    will_return(xTaskGetTickCount, 1053);
+    will_return(__wrap_ds277Xg_read_snapshot, 0);
+    will_return(__wrap_ds277Xg_read_snapshot, &snap);
+
+    assert_return_code(bm_get_data(&data, 1000), 0);
+}
+
 static void bm_get_voltage_test(void **state)
 {
     uint16_t voltage = 0;
@@ -155,6 +217,13 @@ static void bm_get_rsrc_percent_test(void **state)
     assert_return_code(bm_get_rsrc_percent(&data), 0);
 }
 
+static void bm_get_cycle_counter_test(void **state)
+{
+    uint8_t data = 0;
+    will_return(__wrap_ds277Xg_read_data, 0);
+    assert_return_code(bm_get_cycle_counter(&data), 0);
+}
+
 static void bm_get_acc_current_mah_test(void **state)
 {
     uint16_t data = 0;
@@ -187,6 +256,7 @@ int main(void)
 {
     const struct CMUnitTest battery_monitor_tests[] = {
         cmocka_unit_test(battery_monitor_init_test),
+        cmocka_unit_test(bm_get_data_test),
         cmocka_unit_test(bm_get_voltage_test),
         cmocka_unit_test(bm_get_temperature_kelvin_test),
         cmocka_unit_test(bm_get_instantaneous_current_test),
@@ -197,6 +267,7 @@ int main(void)
         cmocka_unit_test(bm_get_rsac_mah_test),
         cmocka_unit_test(bm_get_rarc_percent_test),
         cmocka_unit_test(bm_get_rsrc_percent_test),
+        cmocka_unit_test(bm_get_cycle_counter_test),
         cmocka_unit_test(bm_get_acc_current_mah_test),
         cmocka_unit_test(bm_get_full_capacity_ppm_test),
         cmocka_unit_test(bm_get_active_empty_capacity_ppm_test),
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2021/08/23
+ * \date 2026/10/17
  *
  * \defgroup current_sensor_test Current Sensor
  * \ingroup tests
@@ -61,7 +61,8 @@
 
 static void current_sensor_init_test(void **state)
 {
-    will_return(__wrap_max9934_init, 0);
+    /* One initialization per current sensor */
+    will_return_count(__wrap_max9934_init, 0, 7);
     assert_return_code(current_sensor_init(), 0);
 
     will_return(__wrap_max9934_init, 1);
@@ -74,16 +75,17 @@ static void current_sensor_raw_to_ma_test(void **state)
     for (uint16_t i = CURRENT_SENSOR_RAW_READING_MIN; i <= CURRENT_SENSOR_RAW_READING_MAX; ++i)
     {
         int ma_value = current_sensor_raw_to_ma(port, i);
-        int expected_value = (uint16_t)(1000UL * (uint32_t)i * (ADC_VREF_MV / (ADC_RANGE * SP_CURRENT_SENSOR_RL_VALUE_KOHM * SP_CURRENT_SENSOR_GAIN * SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM)));
-        assert_int_equal(ma_value, expected_value);
+        double expected_value = 1000.0 * i * (ADC_VREF_MV / (ADC_RANGE * SP_CURRENT_SENSOR_RL_VALUE_KOHM * SP_CURRENT_SENSOR_GAIN * SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM));
+        /* Rounded to the nearest mA by the Q16 calibration */
+        assert_in_range(ma_value, (int)(expected_value - 0.5), (int)(expected_value + 0.5));
     }
     /* EPS current sensor test */
     adc_port_t eps_port = EPS_BEACON_CURRENT_SENSOR_ADC_PORT;
     for (uint16_t i = CURRENT_SENSOR_RAW_READING_MIN; i <= CURRENT_SENSOR_RAW_READING_MAX; ++i)
     {
         int ma_value = current_sensor_raw_to_ma(eps_port, i);
-        int expected_value = (uint16_t)(1000UL * (uint32_t)i * (ADC_VREF_MV / (ADC_RANGE * EPS_CURRENT_SENSOR_RL_VALUE_KOHM * EPS_CURRENT_SENSOR_GAIN * EPS_CURRENT_SENSOR_RSENSE_VALUE_MOHM)));
-        assert_int_equal(ma_value, expected_value);
+        double expected_value = 1000.0 * i * (ADC_VREF_MV / (ADC_RANGE * EPS_CURRENT_SENSOR_RL_VALUE_KOHM * EPS_CURRENT_SENSOR_GAIN * EPS_CURRENT_SENSOR_RSENSE_VALUE_MOHM));
+        assert_in_range(ma_value, (int)(expected_value - 0.5), (int)(expected_value + 0.5));
     }
 }
 
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.1
  *
- * \date 2022/05/09
+ * \date 2026/10/17
  *
  * \defgroup heater_test Heater
  * \ingroup tests
@@ -46,8 +46,8 @@
 #include <devices/temp_sensor/temp_sensor.h>
 #include <system/sys_log/sys_log.h>
 
-#define HEATER_SETPOINT 15.0
-#define HEATER_MESUREMENT 150.0
+#define HEATER_SETPOINT FIXEDPT_Q16_INT(15)
+#define HEATER_MESUREMENT FIXEDPT_Q16_INT(150)
 
 #define HEATER_TEMPERATURE_MIN 0
 #define HEATER_TEMPERATURE_MAX 500
@@ -98,7 +98,7 @@ static void heater_algorithm_test(void **state)
 
     for (int i = 0; i < 10; ++i)
     {
-        assert_in_range(heater_algorithm(HEATER_SETPOINT, HEATER_MESUREMENT), -1000.0, 1000.0);
+        assert_in_range(heater_algorithm(HEATER_SETPOINT, HEATER_MESUREMENT), FIXEDPT_Q16_INT(-1000), FIXEDPT_Q16_INT(1000));
     }
 }
 
@@ -129,7 +129,7 @@ static void heater_set_actuator_test(void **state)
     assert_return_code(heater_set_actuator(ch_0, 0), 0);
 
     will_return(__wrap_pwm_update, 0);
-    assert_return_code(heater_set_actuator(ch_0, 3.14), 0);
+    assert_return_code(heater_set_actuator(ch_0, 3), 0);
 
     expect_value(__wrap_pwm_stop, source, HEATER_CONTROL_LOOP_CH_SOURCE);
     expect_value(__wrap_pwm_stop, port, HEATER_ACTUATOR_CH_1);
@@ -140,7 +140,7 @@ static void heater_set_actuator_test(void **state)
 
     will_return(__wrap_pwm_update, 0);
 
-    assert_return_code(heater_set_actuator(ch_1, 3.14), 0);
+    assert_return_code(heater_set_actuator(ch_1, 3), 0);
 }
 
 int main(void)
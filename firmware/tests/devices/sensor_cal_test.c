@@ -0,0 +1,185 @@
+/*
+ * sensor_cal_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the Sensors Calibration device.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup sensor_cal_test Sensors Calibration
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <config/config.h>
+#include <devices/sensor_cal/sensor_cal.h>
+#include <devices/current_sensor/current_sensor.h>
+#include <devices/voltage_sensor/voltage_sensor.h>
+#include <devices/media/media.h>
+#include <drivers/adc/adc.h>
+
+#define SENSOR_CAL_TEST_TLV_GAIN_1      32768U      /* Unity TLV gain factor */
+#define SENSOR_CAL_TEST_TLV_GAIN        33096U      /* +1 % TLV gain factor */
+#define SENSOR_CAL_TEST_TLV_OFFSET      (-2)        /* TLV offset in counts */
+
+static void sensor_cal_test_tlv(uint16_t gain, int16_t offset, int err)
+{
+    will_return(__wrap_adc_get_tlv_cal, gain);
+    will_return(__wrap_adc_get_tlv_cal, offset);
+    will_return(__wrap_adc_get_tlv_cal, err);
+}
+
+static void sensor_cal_convert_test(void **state)
+{
+    /* Nominal coefficients before the initialization */
+    assert_int_equal(sensor_cal_convert(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, 0), 0);
+    assert_int_equal(sensor_cal_convert(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, 4095), 10000);
+    assert_int_equal(sensor_cal_convert(PANNELS_MINUS_Y_PLUS_X_VOLTAGE_SENSOR_ADC_PORT, 4095), 4825);
+    assert_int_equal(sensor_cal_convert(ADC_PORT_0, 1234), 1234);
+
+    /* Rounded to the nearest unit */
+    uint16_t raw = 0;
+    for(raw = 0; raw <= 4095; raw += 13)
+    {
+        double expected = 1000.0 * raw * ADC_VREF_MV / (ADC_RANGE * SP_CURRENT_SENSOR_RL_VALUE_KOHM * SP_CURRENT_SENSOR_GAIN * SP_CURRENT_SENSOR_RSENSE_VALUE_MOHM);
+
+        assert_in_range(sensor_cal_convert(PANNEL_MINUS_Y_CURRENT_SENSOR_ADC_PORT, raw), (uint16_t)(expected - 0.5), (uint16_t)(expected + 0.5));
+    }
+
+    /* Saturation */
+    sensor_cal_coef_t coef = {.gain = SENSOR_CAL_ONE * 100L, .offset = 0};
+
+    assert_return_code(sensor_cal_set(ADC_PORT_11, coef), 0);
+    assert_int_equal(sensor_cal_convert(ADC_PORT_11, 4095), UINT16_MAX);
+
+    coef.gain = SENSOR_CAL_ONE;
+    coef.offset = -100L * SENSOR_CAL_ONE;
+
+    assert_return_code(sensor_cal_set(ADC_PORT_11, coef), 0);
+    assert_int_equal(sensor_cal_convert(ADC_PORT_11, 50), 0);
+    assert_int_equal(sensor_cal_convert(ADC_PORT_11, 150), 50);
+
+    /* Invalid port */
+    assert_int_equal(sensor_cal_set((adc_port_t)SENSOR_CAL_PORTS_QTY, coef), -1);
+    assert_int_equal(sensor_cal_get((adc_port_t)SENSOR_CAL_PORTS_QTY, &coef), -1);
+}
+
+static void sensor_cal_init_test(void **state)
+{
+    sensor_cal_coef_t coef;
+
+    assert_return_code(media_init(MEDIA_INT_FLASH), 0);
+
+    /* Unity TLV calibration and no stored record: nominal coefficients */
+    sensor_cal_test_tlv(SENSOR_CAL_TEST_TLV_GAIN_1, 0, 0);
+    assert_return_code(sensor_cal_init(), 0);
+
+    assert_return_code(sensor_cal_get(MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT, &coef), 0);
+    assert_int_equal(coef.gain, VOLTAGE_SENSOR_DIV_1_GAIN_Q16);
+    assert_int_equal(coef.offset, 0);
+
+    assert_return_code(sensor_cal_get(ADC_PORT_11, &coef), 0);
+    assert_int_equal(coef.gain, SENSOR_CAL_ONE);
+
+    /* TLV gain and offset errors */
+    sensor_cal_test_tlv(SENSOR_CAL_TEST_TLV_GAIN, SENSOR_CAL_TEST_TLV_OFFSET, 0);
+    assert_return_code(sensor_cal_init(), 0);
+
+    uint16_t raw = 0;
+    for(raw = 100; raw <= 4095; raw += 97)
+    {
+        double expected = ((double)raw * SENSOR_CAL_TEST_TLV_GAIN / 32768.0 + SENSOR_CAL_TEST_TLV_OFFSET) * ADC_VREF_MV * VOLTAGE_SENSOR_DIV_1 / ADC_RANGE;
+
+        assert_in_range(sensor_cal_convert(MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT, raw), (uint16_t)(expected - 0.5), (uint16_t)(expected + 1.5));
+    }
+
+    /* No TLV calibration: nominal coefficients */
+    sensor_cal_test_tlv(0, 0, -1);
+    assert_int_equal(sensor_cal_init(), -1);
+
+    assert_return_code(sensor_cal_get(EPS_BEACON_CURRENT_SENSOR_ADC_PORT, &coef), 0);
+    assert_int_equal(coef.gain, EPS_CURRENT_SENSOR_GAIN_Q16);
+    assert_int_equal(coef.offset, 0);
+}
+
+static void sensor_cal_save_load_test(void **state)
+{
+    sensor_cal_coef_t coef = {.gain = 170000L, .offset = -3L * SENSOR_CAL_ONE};
+    sensor_cal_coef_t rd;
+
+    assert_return_code(media_init(MEDIA_INT_FLASH), 0);
+
+    /* Empty memory */
+    assert_int_equal(sensor_cal_load(), -1);
+
+    assert_return_code(sensor_cal_set(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, coef), 0);
+    assert_return_code(sensor_cal_save(), 0);
+
+    /* The system time (segment A) is not overwritten */
+    uint8_t seg_a = 0;
+    assert_return_code(media_read(MEDIA_INT_FLASH, CONFIG_MEM_ADR_SYS_TIME, &seg_a, 1U), 0);
+    assert_int_equal(seg_a, 0xFF);
+
+    /* The stored record replaces the seeded coefficients */
+    sensor_cal_test_tlv(SENSOR_CAL_TEST_TLV_GAIN_1, 0, 0);
+    assert_return_code(sensor_cal_reset(), 0);
+
+    assert_return_code(sensor_cal_get(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, &rd), 0);
+    assert_int_equal(rd.gain, VOLTAGE_SENSOR_DIV_1_GAIN_Q16);
+
+    sensor_cal_test_tlv(SENSOR_CAL_TEST_TLV_GAIN_1, 0, 0);
+    assert_return_code(sensor_cal_init(), 0);
+
+    assert_return_code(sensor_cal_get(TOTAL_SOLAR_PANNELS_VOLTAGE_SENSOR_ADC_PORT, &rd), 0);
+    assert_int_equal(rd.gain, coef.gain);
+    assert_int_equal(rd.offset, coef.offset);
+
+    assert_return_code(sensor_cal_get(MAIN_POWER_BUS_VOLTAGE_SENSOR_ADC_PORT, &rd), 0);
+    assert_int_equal(rd.gain, VOLTAGE_SENSOR_DIV_1_GAIN_Q16);
+
+    /* Corrupted record (clears the gain bits of the first channel) */
+    uint8_t corrupted = 0x00U;
+    assert_return_code(media_write(MEDIA_INT_FLASH, CONFIG_MEM_ADR_SENSOR_CAL + 3U, &corrupted, 1U), 0);
+    assert_int_equal(sensor_cal_load(), -1);
+}
+
+int main(void)
+{
+    const struct CMUnitTest sensor_cal_tests[] = {
+        cmocka_unit_test(sensor_cal_convert_test),
+        cmocka_unit_test(sensor_cal_init_test),
+        cmocka_unit_test(sensor_cal_save_load_test),
+    };
+
+    return cmocka_run_group_tests(sensor_cal_tests, NULL, NULL);
+}
+
+/** \} End of sensor_cal_test group */
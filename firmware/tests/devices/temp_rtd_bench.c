@@ -0,0 +1,160 @@
+/*
+ * temp_rtd_bench.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Host accuracy and speed benchmark of the RTD linearization.
+ *
+ * The lookup table conversion is compared with the float inverse of the
+ * Callendar-Van Dusen equation from -60 C to +120 C. The output is the
+ * maximum error in kelvin and the mean time per conversion of both.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup temp_rtd_bench RTD Linearization Benchmark
+ * \ingroup tests
+ * \{
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include <devices/temp_sensor/temp_sensor.h>
+
+#define TEMP_RTD_BENCH_MIN_C        (-60.0)
+#define TEMP_RTD_BENCH_MAX_C        120.0
+#define TEMP_RTD_BENCH_STEP_C       0.01
+#define TEMP_RTD_BENCH_POINTS       18001U      /* (MAX - MIN) / STEP + 1 */
+#define TEMP_RTD_BENCH_ROUNDS       100U
+
+static volatile double temp_rtd_bench_sink_f;
+
+static volatile uint32_t temp_rtd_bench_sink;
+
+static double temp_rtd_bench_ref_k(uint32_t raw);
+
+static double temp_rtd_bench_now_ns(void);
+
+int main(void)
+{
+    static uint32_t raws[TEMP_RTD_BENCH_POINTS];
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint32_t r = 0;
+    double max_err = 0.0;
+    double max_err_c = 0.0;
+
+    for(n = 0; n < (sizeof(raws) / sizeof(raws[0])); n++)
+    {
+        double t = TEMP_RTD_BENCH_MIN_C + ((double)n * TEMP_RTD_BENCH_STEP_C);
+
+        raws[n] = (uint32_t)((TEMP_SENSOR_CVD_R(t) / TEMP_SENSOR_RTD_OHM_PER_LSB) + 0.5);
+    }
+
+    /* Accuracy (the 0.1 K rounding included) */
+    for(i = 0; i < n; i++)
+    {
+        double err = fabs(((double)temp_rtd_raw_to_dk(raws[i]) / 10.0) - temp_rtd_bench_ref_k(raws[i]));
+
+        if (err > max_err)
+        {
+            max_err = err;
+            max_err_c = temp_rtd_bench_ref_k(raws[i]) - 273.15;
+        }
+    }
+
+    printf("RTD linearization, %u points from %.0f C to %.0f C:\n", (unsigned)n, TEMP_RTD_BENCH_MIN_C, TEMP_RTD_BENCH_MAX_C);
+    printf("    max. error      %8.4f K (at %.2f C)\n", max_err, max_err_c);
+
+    /* Speed */
+    double start = temp_rtd_bench_now_ns();
+
+    for(r = 0; r < TEMP_RTD_BENCH_ROUNDS; r++)
+    {
+        for(i = 0; i < n; i++)
+        {
+            temp_rtd_bench_sink += temp_rtd_raw_to_dk(raws[i]);
+        }
+    }
+
+    double ns_lut = (temp_rtd_bench_now_ns() - start) / ((double)n * TEMP_RTD_BENCH_ROUNDS);
+
+    start = temp_rtd_bench_now_ns();
+
+    for(r = 0; r < TEMP_RTD_BENCH_ROUNDS; r++)
+    {
+        for(i = 0; i < n; i++)
+        {
+            temp_rtd_bench_sink_f += temp_rtd_bench_ref_k(raws[i]);
+        }
+    }
+
+    double ns_ref = (temp_rtd_bench_now_ns() - start) / ((double)n * TEMP_RTD_BENCH_ROUNDS);
+
+    printf("    lookup table    %8.2f ns/conversion\n", ns_lut);
+    printf("    float reference %8.2f ns/conversion\n", ns_ref);
+
+    return (max_err < 0.06) ? 0 : -1;
+}
+
+static double temp_rtd_bench_ref_k(uint32_t raw)
+{
+    double res = (double)raw * TEMP_SENSOR_RTD_OHM_PER_LSB;
+    double a = TEMP_SENSOR_CVD_A;
+    double b = TEMP_SENSOR_CVD_B;
+
+    /* Quadratic above 0 C */
+    double t = (-a + sqrt((a * a) - (4.0 * b * (1.0 - (res / TEMP_SENSOR_PT1000_R0))))) / (2.0 * b);
+
+    /* Newton iterations with the C term below 0 C */
+    if (t < 0.0)
+    {
+        uint8_t k = 0;
+
+        for(k = 0; k < 4U; k++)
+        {
+            double c = TEMP_SENSOR_CVD_C;
+            double f = TEMP_SENSOR_CVD_R(t) - res;
+            double df = TEMP_SENSOR_PT1000_R0 * (a + (2.0 * b * t) + (c * ((4.0 * t * t * t) - (300.0 * t * t))));
+
+            t -= f / df;
+        }
+    }
+
+    return t + 273.15;
+}
+
+static double temp_rtd_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/** \} End of temp_rtd_bench group */
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.6
  *
- * \date 2021/09/06
+ * \date 2026/10/17
  *
  * \defgroup leds_unit_test LEDs
  * \ingroup tests
@@ -42,9 +42,11 @@
 #include <float.h>
 #include <cmocka.h>
 
+#include <config/config.h>
 #include <devices/temp_sensor/temp_sensor.h>
 #include <drivers/adc/adc.h>
 #include <drivers/ads1248/ads1248.h>
+#include <devices/media/media.h>
 
 #define ADS1248_POWER_DOWN_PIN 0
 #define ADS1248_POWER_DOWN_CMD 1
@@ -56,13 +58,19 @@
 
 #define TEMP_SENSOR_ADC_MIN_VAL 0
 #define TEMP_SENSOR_ADC_MAX_VAL 0xFFF /* 12-bit precision = 0xFFF */
-#define TEMP_SENSOR_ADC_MREF_VAL 6.5999999
-#define TEMP_SENSOR_ADC_NREF_VAL 1949.0
+#define TEMP_SENSOR_ADC_MREF_VAL FIXEDPT_Q16_CONST(6.6)
+#define TEMP_SENSOR_ADC_NREF_VAL FIXEDPT_Q16_INT(1949)
 #define TEMP_SENSOR_MIN_VAL_C (-273)
 #define TEMP_SENSOR_MAX_VAL_C 358
 #define TEMP_SENSOR_MIN_VAL_K 0
 #define TEMP_SENSOR_MAX_VAL_K (TEMP_SENSOR_MAX_VAL_C + 273)
 
+#define TEMP_SENSOR_RTD_MIN_VAL_C (-60)
+#define TEMP_SENSOR_RTD_MAX_VAL_C 120
+
+/* Raw value of a RTD at a temperature (float reference) */
+#define TEMP_SENSOR_RTD_RAW(T) ((uint32_t)((TEMP_SENSOR_CVD_R((double)(T)) / TEMP_SENSOR_RTD_OHM_PER_LSB) + 0.5))
+
 static void temp_sensor_init_test(void **state)
 {
     // ads1248_init
@@ -93,9 +101,34 @@ static void temp_sensor_init_test(void **state)
     will_return(__wrap_adc_temp_get_nref, TEMP_SENSOR_ADC_NREF_VAL);
     /* --- */
 
+    /* No stored ADS1248 calibration: self offset calibration, saved in the flash memory */
+    assert_return_code(media_init(MEDIA_INT_FLASH), 0);
+
     expect_value(__wrap_adc_init, port, TEMP_SENSOR_ADC_PORT);
     will_return(__wrap_adc_init, 0);
     will_return(__wrap_ads1248_init, 0);
+    expect_value(__wrap_ads1248_calibrate, cal, ADS1248_CMD_SELFOCAL);
+    will_return(__wrap_ads1248_calibrate, 0);
+    will_return(__wrap_ads1248_get_cal, -1200);
+    will_return(__wrap_ads1248_get_cal, 0x404000);
+    will_return(__wrap_ads1248_get_cal, 0);
+    assert_return_code(temp_sensor_init(), 0);
+
+    /* Calls to temp_mcu_read_c mock function */
+    expect_value(__wrap_adc_read, port, TEMP_SENSOR_ADC_PORT);
+    will_return(__wrap_adc_read, 0);
+    will_return(__wrap_adc_read, 0);
+    will_return(__wrap_adc_temp_get_mref, TEMP_SENSOR_ADC_MREF_VAL);
+    will_return(__wrap_adc_temp_get_nref, TEMP_SENSOR_ADC_NREF_VAL);
+    /* --- */
+
+    /* The stored calibration is restored instead of calibrating again */
+    expect_value(__wrap_adc_init, port, TEMP_SENSOR_ADC_PORT);
+    will_return(__wrap_adc_init, 0);
+    will_return(__wrap_ads1248_init, 0);
+    expect_value(__wrap_ads1248_set_cal, offset, (uint32_t)-1200);
+    expect_value(__wrap_ads1248_set_cal, full_scale, 0x404000);
+    will_return(__wrap_ads1248_set_cal, 0);
     assert_return_code(temp_sensor_init(), 0);
 }
 
@@ -228,27 +261,165 @@ static void temp_mcu_read_k_test(void **state)
 
 static void temp_rtd_read_raw_test(void **state)
 {
-    // TODO
+    uint32_t raw = 0;
+
+    expect_value(__wrap_ads1248_write_cmd, cmd, ADS1248_CMD_RDATA);
+    expect_value(__wrap_ads1248_write_cmd, positive_channel, TEMP_SENSOR_RTD_CH_2);
+    will_return(__wrap_ads1248_write_cmd, 0x4D9A3C);
+    will_return(__wrap_ads1248_write_cmd, 0);
+
+    assert_return_code(temp_rtd_read_raw(TEMP_SENSOR_RTD_CH_2, &raw), 0);
+    assert_int_equal(raw, 0x4D9A3C);
+
+    expect_value(__wrap_ads1248_write_cmd, cmd, ADS1248_CMD_RDATA);
+    expect_value(__wrap_ads1248_write_cmd, positive_channel, TEMP_SENSOR_RTD_CH_2);
+    will_return(__wrap_ads1248_write_cmd, 0);
+    will_return(__wrap_ads1248_write_cmd, -1);
+
+    assert_int_equal(temp_rtd_read_raw(TEMP_SENSOR_RTD_CH_2, &raw), -1);
+}
+
+static void temp_rtd_scan_read_raw_test(void **state)
+{
+    uint32_t raw = 0;
+
+    /* The settling conversions after the channel switch are discarded */
+    expect_value(__wrap_ads1248_select_channel, positive_channel, TEMP_SENSOR_RTD_CH_3);
+    will_return(__wrap_ads1248_select_channel, 0);
+
+    for (uint8_t i = 0; i < TEMP_SENSOR_SCAN_DISCARD; i++)
+    {
+        will_return(__wrap_ads1248_read_continuous, 0xFFFFFF);
+        will_return(__wrap_ads1248_read_continuous, 0);
+    }
+
+    will_return(__wrap_ads1248_read_continuous, 0x123456);
+    will_return(__wrap_ads1248_read_continuous, 0);
+
+    assert_return_code(temp_rtd_scan_read_raw(TEMP_SENSOR_RTD_CH_3, &raw), 0);
+    assert_int_equal(raw, 0x123456);
+
+    /* Error selecting the channel */
+    expect_value(__wrap_ads1248_select_channel, positive_channel, TEMP_SENSOR_RTD_CH_0);
+    will_return(__wrap_ads1248_select_channel, -1);
+
+    assert_int_equal(temp_rtd_scan_read_raw(TEMP_SENSOR_RTD_CH_0, &raw), -1);
+
+    /* DRDY timeout on the settling conversion */
+    expect_value(__wrap_ads1248_select_channel, positive_channel, TEMP_SENSOR_RTD_CH_6);
+    will_return(__wrap_ads1248_select_channel, 0);
+    will_return(__wrap_ads1248_read_continuous, 0);
+    will_return(__wrap_ads1248_read_continuous, -1);
+
+    assert_int_equal(temp_rtd_scan_read_raw(TEMP_SENSOR_RTD_CH_6, &raw), -1);
 }
 
 static void temp_rtd_raw_to_c_test(void **state)
 {
-    // TODO: fix magic number TEMP_SENSOR_CONV
+    int16_t t = 0;
+
+    for (t = TEMP_SENSOR_RTD_MIN_VAL_C; t <= TEMP_SENSOR_RTD_MAX_VAL_C; t++)
+    {
+        assert_int_equal(temp_rtd_raw_to_c(TEMP_SENSOR_RTD_RAW(t)), t);
+    }
+
+    /* Out of the lookup table */
+    assert_int_equal(temp_rtd_raw_to_c(0), -100);
+
+    /* Negative bipolar codes */
+    assert_int_equal(temp_rtd_raw_to_c(0xFFFFFF), -100);
+    assert_int_equal(temp_rtd_raw_to_c(0x800000), -100);
+
+    /* Positive full scale (1650 ohms) */
+    assert_int_equal(temp_rtd_raw_to_c(0x7FFFFF), 171);
 }
 
 static void temp_rtd_raw_to_k_test(void **state)
 {
-    // TODO: fix magic number TEMP_SENSOR_CONV
+    int16_t t = 0;
+
+    for (t = TEMP_SENSOR_RTD_MIN_VAL_C; t <= TEMP_SENSOR_RTD_MAX_VAL_C; t++)
+    {
+        assert_int_equal(temp_rtd_raw_to_k(TEMP_SENSOR_RTD_RAW(t)), t + 273);
+
+        /* 0.1 K resolution (+0.25 C) */
+        uint16_t dk = temp_rtd_raw_to_dk(TEMP_SENSOR_RTD_RAW(t + 0.25));
+
+        assert_in_range(dk, ((t + 273) * 10) + 3, ((t + 273) * 10) + 4);
+    }
 }
 
 static void temp_rtd_read_c_test(void **state)
 {
-    // TODO: fix magic number TEMP_SENSOR_CONV
+    int16_t temp = 0;
+
+    expect_value(__wrap_ads1248_write_cmd, cmd, ADS1248_CMD_RDATA);
+    expect_value(__wrap_ads1248_write_cmd, positive_channel, TEMP_SENSOR_RTD_CH_1);
+    will_return(__wrap_ads1248_write_cmd, TEMP_SENSOR_RTD_RAW(-40));
+    will_return(__wrap_ads1248_write_cmd, 0);
+
+    assert_return_code(temp_rtd_read_c(TEMP_SENSOR_RTD_CH_1, &temp), 0);
+    assert_int_equal(temp, -40);
 }
 
 static void temp_rtd_read_k_test(void **state)
 {
-    // TODO: fix magic number TEMP_SENSOR_CONV
+    uint16_t temp = 0;
+
+    expect_value(__wrap_ads1248_write_cmd, cmd, ADS1248_CMD_RDATA);
+    expect_value(__wrap_ads1248_write_cmd, positive_channel, TEMP_SENSOR_RTD_CH_0);
+    will_return(__wrap_ads1248_write_cmd, TEMP_SENSOR_RTD_RAW(25));
+    will_return(__wrap_ads1248_write_cmd, 0);
+
+    assert_return_code(temp_rtd_read_k(TEMP_SENSOR_RTD_CH_0, &temp), 0);
+    assert_int_equal(temp, 298);
+
+    expect_value(__wrap_ads1248_write_cmd, cmd, ADS1248_CMD_RDATA);
+    expect_value(__wrap_ads1248_write_cmd, positive_channel, TEMP_SENSOR_RTD_CH_0);
+    will_return(__wrap_ads1248_write_cmd, TEMP_SENSOR_RTD_RAW(25.45));
+    will_return(__wrap_ads1248_write_cmd, 0);
+
+    assert_return_code(temp_rtd_read_dk(TEMP_SENSOR_RTD_CH_0, &temp), 0);
+    assert_int_equal(temp, 2986);
+}
+
+static void temp_rtd_cal_test(void **state)
+{
+    assert_return_code(media_init(MEDIA_INT_FLASH), 0);
+
+    /* Empty memory */
+    assert_int_equal(temp_rtd_cal_load(), -1);
+
+    expect_value(__wrap_ads1248_calibrate, cal, ADS1248_CMD_SELFOCAL);
+    will_return(__wrap_ads1248_calibrate, -1);
+    assert_int_equal(temp_rtd_calibrate(290), -1);
+
+    expect_value(__wrap_ads1248_calibrate, cal, ADS1248_CMD_SELFOCAL);
+    will_return(__wrap_ads1248_calibrate, 0);
+    assert_return_code(temp_rtd_calibrate(310), 0);
+    assert_int_equal(temp_rtd_get_cal_temp(), 310);
+    assert_true(temp_rtd_is_calibrated());
+
+    will_return(__wrap_ads1248_get_cal, -8388608L);
+    will_return(__wrap_ads1248_get_cal, 0xFFFFFF);
+    will_return(__wrap_ads1248_get_cal, 0);
+    assert_return_code(temp_rtd_cal_save(), 0);
+
+    expect_value(__wrap_ads1248_calibrate, cal, ADS1248_CMD_SELFOCAL);
+    will_return(__wrap_ads1248_calibrate, 0);
+    assert_return_code(temp_rtd_calibrate(250), 0);
+
+    /* Restored coefficients and board temperature */
+    expect_value(__wrap_ads1248_set_cal, offset, (uint32_t)-8388608L);
+    expect_value(__wrap_ads1248_set_cal, full_scale, 0xFFFFFF);
+    will_return(__wrap_ads1248_set_cal, 0);
+    assert_return_code(temp_rtd_cal_load(), 0);
+    assert_int_equal(temp_rtd_get_cal_temp(), 310);
+
+    /* Corrupted record */
+    uint8_t buf = 0x00;
+    assert_return_code(media_write(MEDIA_INT_FLASH, CONFIG_MEM_ADR_RTD_CAL + 4U, &buf, 1), 0);
+    assert_int_equal(temp_rtd_cal_load(), -1);
 }
 
 int main(void)
@@ -262,10 +433,12 @@ int main(void)
         cmocka_unit_test(temp_mcu_read_c_test),
         cmocka_unit_test(temp_mcu_read_k_test),
         cmocka_unit_test(temp_rtd_read_raw_test),
+        cmocka_unit_test(temp_rtd_scan_read_raw_test),
         cmocka_unit_test(temp_rtd_raw_to_c_test),
         cmocka_unit_test(temp_rtd_raw_to_k_test),
         cmocka_unit_test(temp_rtd_read_c_test),
-        cmocka_unit_test(temp_rtd_read_k_test)};
+        cmocka_unit_test(temp_rtd_read_k_test),
+        cmocka_unit_test(temp_rtd_cal_test)};
 
     return cmocka_run_group_tests(temp_sensor_tests, NULL, NULL);
 }
@@ -0,0 +1,333 @@
+/*
+ * ads1248_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the ADS1248 register shadow copy.
+ *
+ * The SPI transfers are decoded by a fake register file, to check which
+ * registers are written and how many WREG commands are sent.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup ads1248_test ADS1248
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <drivers/ads1248/ads1248.h>
+
+int __wrap_spi_init(spi_port_t port, spi_config_t config);
+int __wrap_spi_select_slave(spi_port_t port, spi_cs_t cs, bool active);
+int __wrap_spi_write(spi_port_t port, spi_cs_t cs, uint8_t *data, uint16_t len);
+int __wrap_spi_transfer_no_cs(spi_port_t port, uint8_t *wd, uint8_t *rd, uint16_t len);
+int __wrap_gpio_init(gpio_pin_t pin, gpio_config_t config);
+int __wrap_gpio_set_state(gpio_pin_t pin, bool level);
+int __wrap_gpio_get_state(gpio_pin_t pin);
+int __wrap_gpio_enable_interrupt(gpio_pin_t pin, uint8_t edge, gpio_isr_t isr);
+void __wrap_ads1248_delay(uint8_t ms);
+void __wrap_ads1248_notify_prepare(ads1248_config_t *config);
+int __wrap_ads1248_notify_wait(uint16_t timeout_ms);
+void __wrap_ads1248_notify_from_isr(void);
+
+/* Register file of the fake device */
+static uint8_t dev_regs[ADS1248_REG_QTY];
+
+static uint16_t dev_wregs = 0;
+static uint16_t dev_wreg_bytes = 0;
+
+static ads1248_config_t dev_config;
+
+/* Offset loaded in the OFC registers by a self offset calibration of the fake device */
+#define DEV_SELFOCAL_OFFSET     (-12345L)
+
+/* Values after a reset (the ID in IDAC0 and the full-scale calibration are device specific) */
+static const uint8_t dev_reset_regs[ADS1248_REG_QTY] = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x40, 0x90, 0xFF, 0x00, 0xFF, 0x00};
+
+static int ads1248_test_setup(void **state)
+{
+    memcpy(dev_regs, dev_reset_regs, sizeof(dev_regs));
+    memcpy(dev_config.regs, dev_reset_regs, sizeof(dev_config.regs));
+
+    dev_config.drdy_pin = ADS1248_DRDY_PIN_NONE;
+    dev_config.data_rate = ADS1248_DR_40SPS;
+
+    dev_wregs = 0;
+    dev_wreg_bytes = 0;
+
+    return 0;
+}
+
+static void ads1248_write_regs_test(void **state)
+{
+    uint8_t regs[ADS1248_REG_QTY];
+
+    memcpy(regs, dev_reset_regs, sizeof(regs));
+
+    /* Nothing changed */
+    assert_return_code(ads1248_write_regs(&dev_config, ADS1248_REG_MUX0, regs, ADS1248_REG_QTY), 0);
+    assert_int_equal(dev_wregs, 0);
+
+    /* Only the read-only bits changed (ID of IDAC0) */
+    regs[ADS1248_REG_IDAC0] = 0x00;
+    assert_return_code(ads1248_write_regs(&dev_config, ADS1248_REG_MUX0, regs, ADS1248_REG_QTY), 0);
+    assert_int_equal(dev_wregs, 0);
+
+    /* Adjacent registers in a single WREG */
+    regs[ADS1248_REG_IDAC0] = 0x0A;
+    regs[ADS1248_REG_IDAC1] = 0x06;
+    regs[ADS1248_REG_GPIOCFG] = 0x01;
+    assert_return_code(ads1248_write_regs(&dev_config, ADS1248_REG_MUX0, regs, ADS1248_REG_QTY), 0);
+    assert_int_equal(dev_wregs, 1);
+    assert_int_equal(dev_wreg_bytes, 3);
+
+    /* Separated registers in a WREG each */
+    regs[ADS1248_REG_MUX0] = 0x37;
+    regs[ADS1248_REG_SYS0] = 0x03;
+    assert_return_code(ads1248_write_regs(&dev_config, ADS1248_REG_MUX0, regs, ADS1248_REG_QTY), 0);
+    assert_int_equal(dev_wregs, 3);
+    assert_int_equal(dev_wreg_bytes, 5);
+
+    assert_memory_equal(dev_regs, dev_config.regs, ADS1248_REG_QTY);
+    assert_int_equal(dev_regs[ADS1248_REG_MUX0], 0x37);
+    assert_int_equal(dev_regs[ADS1248_REG_IDAC0], 0x0A);
+
+    /* Out of the register bank */
+    assert_int_equal(ads1248_write_regs(&dev_config, ADS1248_REG_GPIODAT, regs, 2), -1);
+    assert_int_equal(ads1248_write_regs(&dev_config, ADS1248_REG_QTY, regs, 1), -1);
+    assert_int_equal(ads1248_write_regs(&dev_config, ADS1248_REG_MUX0, regs, 0), -1);
+}
+
+static void ads1248_config_regs_test(void **state)
+{
+    assert_return_code(ads1248_config_regs(&dev_config), 0);
+
+    /* MUX0, MUX1 and SYS0, IDAC0 and IDAC1, GPIODIR (the calibration registers are kept) */
+    assert_int_equal(dev_wregs, 4);
+    assert_int_equal(dev_regs[ADS1248_REG_SYS0], ADS1248_DR_40SPS);
+    assert_int_equal(dev_regs[ADS1248_REG_FSC0], 0x5A);
+
+    /* The device is already configured */
+    assert_return_code(ads1248_config_regs(&dev_config), 0);
+    assert_int_equal(dev_wregs, 4);
+}
+
+static void ads1248_read_data_test(void **state)
+{
+    uint8_t rd[4];
+
+    ads1248_config_regs(&dev_config);
+    dev_wregs = 0;
+    dev_wreg_bytes = 0;
+
+    /* MUX0 and IDAC1 are only written when the channel changes */
+    assert_return_code(ads1248_read_data(&dev_config, rd, 2), 0);
+    assert_int_equal(dev_wregs, 2);
+    assert_int_equal(dev_regs[ADS1248_REG_IDAC1], 0x22);
+
+    assert_return_code(ads1248_read_data(&dev_config, rd, 2), 0);
+    assert_int_equal(dev_wregs, 2);
+}
+
+static void ads1248_verify_regs_test(void **state)
+{
+    ads1248_config_regs(&dev_config);
+    dev_wregs = 0;
+    dev_wreg_bytes = 0;
+
+    assert_return_code(ads1248_verify_regs(&dev_config), 0);
+    assert_int_equal(dev_wregs, 0);
+
+    /* The level of the GPIO pins is not verified */
+    dev_regs[ADS1248_REG_GPIODAT] = 0xFF;
+    assert_return_code(ads1248_verify_regs(&dev_config), 0);
+    assert_int_equal(dev_wregs, 0);
+
+    /* Upset of SYS0 and MUX1: only them are written again (single WREG) */
+    dev_regs[ADS1248_REG_MUX1] = 0x00;
+    dev_regs[ADS1248_REG_SYS0] = 0x00;
+    assert_int_equal(ads1248_verify_regs(&dev_config), -1);
+    assert_int_equal(dev_wregs, 1);
+    assert_int_equal(dev_wreg_bytes, 2);
+    assert_int_equal(dev_regs[ADS1248_REG_SYS0], ADS1248_DR_40SPS);
+
+    assert_return_code(ads1248_verify_regs(&dev_config), 0);
+    assert_int_equal(dev_wregs, 1);
+}
+
+static void ads1248_calibrate_test(void **state)
+{
+    ads1248_cal_t cal;
+
+    assert_return_code(ads1248_calibrate(&dev_config, ADS1248_CMD_SELFOCAL), 0);
+
+    /* The shadow copy is updated with the result of the calibration */
+    assert_memory_equal(dev_regs, dev_config.regs, ADS1248_REG_QTY);
+
+    assert_return_code(ads1248_get_cal(&dev_config, &cal), 0);
+    assert_int_equal(cal.offset, DEV_SELFOCAL_OFFSET);
+    assert_int_equal(cal.full_scale, 0x40405AUL);
+
+    /* Not a calibration command */
+    assert_int_equal(ads1248_calibrate(&dev_config, ADS1248_CMD_SYNC), -1);
+}
+
+static void ads1248_set_cal_test(void **state)
+{
+    ads1248_cal_t cal = {.offset = DEV_SELFOCAL_OFFSET, .full_scale = 0x40405AUL};
+    ads1248_cal_t rd;
+
+    /* Only the OFC registers are written (the FSC registers have the same value) */
+    assert_return_code(ads1248_set_cal(&dev_config, cal), 0);
+    assert_int_equal(dev_wregs, 1);
+    assert_int_equal(dev_wreg_bytes, 3);
+    assert_int_equal(dev_regs[ADS1248_REG_OFC0], 0xC7);
+    assert_int_equal(dev_regs[ADS1248_REG_OFC1], 0xCF);
+    assert_int_equal(dev_regs[ADS1248_REG_OFC2], 0xFF);
+
+    assert_return_code(ads1248_get_cal(&dev_config, &rd), 0);
+    assert_int_equal(rd.offset, cal.offset);
+    assert_int_equal(rd.full_scale, cal.full_scale);
+
+    /* Out of the 24-bit range */
+    cal.offset = 8388608L;
+    assert_int_equal(ads1248_set_cal(&dev_config, cal), -1);
+
+    cal.offset = 0;
+    cal.full_scale = 0x01000000UL;
+    assert_int_equal(ads1248_set_cal(&dev_config, cal), -1);
+    assert_int_equal(dev_wregs, 1);
+}
+
+int main(void)
+{
+    const struct CMUnitTest ads1248_tests[] = {
+        cmocka_unit_test_setup(ads1248_write_regs_test, ads1248_test_setup),
+        cmocka_unit_test_setup(ads1248_config_regs_test, ads1248_test_setup),
+        cmocka_unit_test_setup(ads1248_read_data_test, ads1248_test_setup),
+        cmocka_unit_test_setup(ads1248_verify_regs_test, ads1248_test_setup),
+        cmocka_unit_test_setup(ads1248_calibrate_test, ads1248_test_setup),
+        cmocka_unit_test_setup(ads1248_set_cal_test, ads1248_test_setup),
+    };
+
+    return cmocka_run_group_tests(ads1248_tests, NULL, NULL);
+}
+
+int __wrap_spi_init(spi_port_t port, spi_config_t config)
+{
+    return 0;
+}
+
+int __wrap_spi_select_slave(spi_port_t port, spi_cs_t cs, bool active)
+{
+    return 0;
+}
+
+int __wrap_spi_write(spi_port_t port, spi_cs_t cs, uint8_t *data, uint16_t len)
+{
+    return 0;
+}
+
+int __wrap_spi_transfer_no_cs(spi_port_t port, uint8_t *wd, uint8_t *rd, uint16_t len)
+{
+    uint8_t first = wd[0] & 0x0FU;
+
+    if ((wd[0] & 0xF0U) == ADS1248_CMD_WREG)
+    {
+        assert_int_equal(len, wd[1] + 3U);
+        assert_true((first + wd[1]) < ADS1248_REG_QTY);
+
+        memcpy(&dev_regs[first], &wd[2], wd[1] + 1U);
+
+        dev_wregs++;
+        dev_wreg_bytes += wd[1] + 1U;
+    }
+    else if ((wd[0] & 0xF0U) == ADS1248_CMD_RREG)
+    {
+        assert_int_equal(len, wd[1] + 3U);
+        assert_true((first + wd[1]) < ADS1248_REG_QTY);
+
+        memcpy(&rd[2], &dev_regs[first], wd[1] + 1U);
+    }
+    else if (wd[0] == ADS1248_CMD_SELFOCAL)
+    {
+        dev_regs[ADS1248_REG_OFC0] = (uint32_t)DEV_SELFOCAL_OFFSET & 0xFFU;
+        dev_regs[ADS1248_REG_OFC1] = ((uint32_t)DEV_SELFOCAL_OFFSET >> 8) & 0xFFU;
+        dev_regs[ADS1248_REG_OFC2] = ((uint32_t)DEV_SELFOCAL_OFFSET >> 16) & 0xFFU;
+
+        memset(rd, 0, len);
+    }
+    else
+    {
+        memset(rd, 0, len);
+    }
+
+    return 0;
+}
+
+int __wrap_gpio_init(gpio_pin_t pin, gpio_config_t config)
+{
+    return 0;
+}
+
+int __wrap_gpio_set_state(gpio_pin_t pin, bool level)
+{
+    return 0;
+}
+
+int __wrap_gpio_get_state(gpio_pin_t pin)
+{
+    return 1;
+}
+
+int __wrap_gpio_enable_interrupt(gpio_pin_t pin, uint8_t edge, gpio_isr_t isr)
+{
+    return 0;
+}
+
+void __wrap_ads1248_delay(uint8_t ms)
+{
+}
+
+void __wrap_ads1248_notify_prepare(ads1248_config_t *config)
+{
+}
+
+int __wrap_ads1248_notify_wait(uint16_t timeout_ms)
+{
+    return 0;
+}
+
+void __wrap_ads1248_notify_from_isr(void)
+{
+}
+
+/** \} End of ads1248_test group */
@@ -0,0 +1,149 @@
+/*
+ * mpy_bench.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Host benchmark of the MPY32 driver kernels (portable implementation).
+ *
+ * Each kernel is compared with the floating point computation it replaces.
+ * The output is the mean time per call in nanoseconds and the largest
+ * difference between both results.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup mpy_bench MPY32 Benchmark
+ * \ingroup tests
+ * \{
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <drivers/mpy/mpy.h>
+
+#define MPY_BENCH_ROUNDS        200000UL
+#define MPY_BENCH_TAPS          16U
+
+static int16_t mpy_bench_coefs[MPY_BENCH_TAPS];
+static int16_t mpy_bench_samples[MPY_BENCH_ROUNDS + MPY_BENCH_TAPS];
+
+static volatile int32_t mpy_bench_sink;
+
+static double mpy_bench_now_ns(void);
+
+static int16_t mpy_bench_fir_float(const int16_t *samples);
+
+int main(void)
+{
+    uint32_t i = 0;
+    double start = 0;
+    int32_t diff = 0;
+    int32_t max_diff = 0;
+
+    /* Low-pass taps summing to ~1.0 (Q15) */
+    for(i = 0; i < MPY_BENCH_TAPS; i++)
+    {
+        mpy_bench_coefs[i] = (int16_t)(32767 / MPY_BENCH_TAPS);
+    }
+
+    for(i = 0; i < (MPY_BENCH_ROUNDS + MPY_BENCH_TAPS); i++)
+    {
+        mpy_bench_samples[i] = (int16_t)(2048 + (rand() % 256));
+    }
+
+    start = mpy_bench_now_ns();
+    for(i = 0; i < MPY_BENCH_ROUNDS; i++)
+    {
+        mpy_bench_sink += mpy_bench_fir_float(&mpy_bench_samples[i]);
+    }
+    double fir_float = (mpy_bench_now_ns() - start) / (double)MPY_BENCH_ROUNDS;
+
+    start = mpy_bench_now_ns();
+    for(i = 0; i < MPY_BENCH_ROUNDS; i++)
+    {
+        mpy_bench_sink += mpy_fir_q15(mpy_bench_coefs, &mpy_bench_samples[i], MPY_BENCH_TAPS);
+    }
+    double fir_q15 = (mpy_bench_now_ns() - start) / (double)MPY_BENCH_ROUNDS;
+
+    for(i = 0; i < MPY_BENCH_ROUNDS; i++)
+    {
+        diff = mpy_fir_q15(mpy_bench_coefs, &mpy_bench_samples[i], MPY_BENCH_TAPS) - mpy_bench_fir_float(&mpy_bench_samples[i]);
+
+        max_diff = (abs(diff) > max_diff) ? abs(diff) : max_diff;
+    }
+
+    printf("FIR filter (%lu rounds x %u taps):\n", MPY_BENCH_ROUNDS, MPY_BENCH_TAPS);
+    printf("    float %8.2f ns, Q15 MAC %8.2f ns, max. diff. %ld LSB\n", fir_float, fir_q15, (long)max_diff);
+
+    float avg_float = 0.0f;
+    int32_t avg_q = 0;
+
+    start = mpy_bench_now_ns();
+    for(i = 0; i < MPY_BENCH_ROUNDS; i++)
+    {
+        avg_float += 0.125f * ((float)mpy_bench_samples[i] - avg_float);
+        mpy_bench_sink += (int32_t)avg_float;
+    }
+    double ema_float = (mpy_bench_now_ns() - start) / (double)MPY_BENCH_ROUNDS;
+
+    start = mpy_bench_now_ns();
+    for(i = 0; i < MPY_BENCH_ROUNDS; i++)
+    {
+        avg_q = mpy_ema_s32(avg_q, mpy_bench_samples[i], 0x1000);
+        mpy_bench_sink += avg_q;
+    }
+    double ema_q15 = (mpy_bench_now_ns() - start) / (double)MPY_BENCH_ROUNDS;
+
+    printf("EMA filter (%lu rounds):\n", MPY_BENCH_ROUNDS);
+    printf("    float %8.2f ns, Q15 MAC %8.2f ns, final diff. %ld LSB\n", ema_float, ema_q15, (long)(avg_q - (int32_t)(avg_float + 0.5f)));
+
+    return 0;
+}
+
+static double mpy_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static int16_t mpy_bench_fir_float(const int16_t *samples)
+{
+    float acc = 0.0f;
+    uint16_t i = 0;
+
+    for(i = 0; i < MPY_BENCH_TAPS; i++)
+    {
+        acc += ((float)mpy_bench_coefs[i] / 32768.0f) * (float)samples[i];
+    }
+
+    return (int16_t)(acc + 0.5f);
+}
+
+/** \} End of mpy_bench group */
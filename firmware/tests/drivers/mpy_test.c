@@ -0,0 +1,159 @@
+/*
+ * mpy_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the MPY32 driver kernels (portable implementation).
+ *
+ * The kernels are compared with straightforward 64-bit references, the same
+ * results are expected from the MPY32 implementation on target.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup mpy_test MPY32
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <drivers/mpy/mpy.h>
+
+#define MPY_TEST_LEN        64U
+
+static void mpy_mul_test(void **state)
+{
+    assert_true(mpy_mul_s32(INT32_MIN, INT32_MIN) == 0x4000000000000000LL);
+    assert_true(mpy_mul_s32(INT32_MIN, INT32_MAX) == -0x3FFFFFFF80000000LL);
+    assert_true(mpy_mul_s32(-7, 6) == -42LL);
+    assert_true(mpy_mul_u32(UINT32_MAX, UINT32_MAX) == 0xFFFFFFFE00000001ULL);
+
+    /* Solar panel power: 2x 1.2 A at 8 V, in uW */
+    assert_true(mpy_mul_u32(2400UL, 8000UL) == 19200000ULL);
+}
+
+static void mpy_mac_test(void **state)
+{
+    assert_true(mpy_mac_s32(100LL, -7, 6) == 58LL);
+    assert_true(mpy_mac_s32(-0x4000000000000000LL, INT32_MIN, INT32_MIN) == 0LL);
+    assert_true(mpy_mac_u32(1ULL, UINT32_MAX, UINT32_MAX) == 0xFFFFFFFE00000002ULL);
+
+    /* 64-bit wrap around */
+    assert_true(mpy_mac_u32(UINT64_MAX, 1UL, 1UL) == 0ULL);
+}
+
+static void mpy_dot_test(void **state)
+{
+    int16_t a16[MPY_TEST_LEN];
+    int16_t b16[MPY_TEST_LEN];
+    int32_t a32[MPY_TEST_LEN];
+    int32_t b32[MPY_TEST_LEN];
+    int64_t ref16 = 0;
+    int64_t ref32 = 0;
+    uint16_t i = 0;
+
+    for(i = 0; i < MPY_TEST_LEN; i++)
+    {
+        a16[i] = (int16_t)(rand() - (RAND_MAX / 2));
+        b16[i] = (int16_t)(rand() - (RAND_MAX / 2));
+        a32[i] = (int32_t)((rand() & 0xFFFF) << 14) - 0x20000000L;
+        b32[i] = (int32_t)((rand() & 0xFFFF) << 14) - 0x20000000L;
+
+        ref16 += (int64_t)a16[i] * (int64_t)b16[i];
+        ref32 += (int64_t)a32[i] * (int64_t)b32[i];
+    }
+
+    assert_true(mpy_dot_s16(a16, b16, MPY_TEST_LEN) == ref16);
+    assert_true(mpy_dot_s32(a32, b32, MPY_TEST_LEN) == ref32);
+    assert_true(mpy_dot_s16(a16, b16, 0) == 0LL);
+
+    /* More than 32 bits of 16x16 products */
+    for(i = 0; i < MPY_TEST_LEN; i++)
+    {
+        a16[i] = INT16_MIN;
+        b16[i] = INT16_MIN;
+    }
+
+    assert_true(mpy_dot_s16(a16, b16, MPY_TEST_LEN) == (int64_t)MPY_TEST_LEN * 0x40000000LL);
+}
+
+static void mpy_q15_test(void **state)
+{
+    assert_int_equal(mpy_mul_q15(0x4000, 0x4000), 0x2000);
+    assert_int_equal(mpy_mul_q15(0x4000, -0x4000), -0x2000);
+    assert_int_equal(mpy_mul_q15(INT16_MIN, INT16_MIN), INT16_MAX);
+    assert_int_equal(mpy_mul_q15(INT16_MIN, INT16_MAX), -INT16_MAX);
+
+    /* Moving average of 4 taps */
+    const int16_t coefs[] = {0x2000, 0x2000, 0x2000, 0x2000};
+    const int16_t samples[] = {1000, 1002, 1004, 1007};
+
+    assert_int_equal(mpy_fir_q15(coefs, samples, 4), 1003);
+
+    /* Output saturation */
+    const int16_t gain[] = {INT16_MAX, INT16_MAX};
+    const int16_t high[] = {30000, 30000};
+    const int16_t low[] = {-30000, -30000};
+
+    assert_int_equal(mpy_fir_q15(gain, high, 2), INT16_MAX);
+    assert_int_equal(mpy_fir_q15(gain, low, 2), INT16_MIN);
+}
+
+static void mpy_ema_test(void **state)
+{
+    assert_int_equal(mpy_ema_s32(1000, 2000, 0x4000), 1500);
+    assert_int_equal(mpy_ema_s32(1000, 0, 0x4000), 500);
+    assert_int_equal(mpy_ema_s32(-1000, -1001, 0x4000), -1000);
+    assert_int_equal(mpy_ema_s32(1000, 5000, 0), 1000);
+
+    /* Converges to a constant input, up to the rounding dead band of alpha */
+    int32_t avg = 0;
+    uint16_t i = 0;
+
+    for(i = 0; i < 200; i++)
+    {
+        avg = mpy_ema_s32(avg, 123456, 0x1000);
+    }
+
+    assert_in_range(avg, 123456 - 3, 123456);
+}
+
+int main(void)
+{
+    const struct CMUnitTest mpy_tests[] = {
+        cmocka_unit_test(mpy_mul_test),
+        cmocka_unit_test(mpy_mac_test),
+        cmocka_unit_test(mpy_dot_test),
+        cmocka_unit_test(mpy_q15_test),
+        cmocka_unit_test(mpy_ema_test),
+    };
+
+    return cmocka_run_group_tests(mpy_tests, NULL, NULL);
+}
+
+/** \} End of mpy_test group */
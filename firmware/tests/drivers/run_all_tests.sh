@@ -0,0 +1,4 @@
+#!/bin/bash
+
+./mpy_unit_test
+./ads1248_unit_test
@@ -0,0 +1,132 @@
+/*
+ * media_wrap.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Media device wrap implementation.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup media_wrap
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include "media_wrap.h"
+
+#define MEDIA_WRAP_SEG_SIZE         128U
+#define MEDIA_WRAP_SIZE             (4U * MEDIA_WRAP_SEG_SIZE)
+
+/**
+ * \brief Info segments D to A (an erased flash memory reads as 0xFF).
+ */
+static uint8_t media_wrap_mem[MEDIA_WRAP_SIZE];
+
+static bool media_wrap_is_ready = false;
+
+/**
+ * \brief Converts a media address (absolute flash address) to an index of the emulated memory.
+ *
+ * \param[in] adr is the media address.
+ *
+ * \param[in] len is the number of bytes to access.
+ *
+ * \param[in,out] idx is a pointer to store the index.
+ *
+ * \return The status/error code.
+ */
+static int media_wrap_index(uint32_t adr, uint16_t len, uint32_t *idx)
+{
+    if ((adr < FLASH_SEG_D_ADR) || ((adr - FLASH_SEG_D_ADR + len) > MEDIA_WRAP_SIZE))
+    {
+        return -1;
+    }
+
+    *idx = adr - FLASH_SEG_D_ADR;
+
+    return 0;
+}
+
+int __wrap_media_init(media_t med)
+{
+    memset(media_wrap_mem, 0xFF, sizeof(media_wrap_mem));
+
+    media_wrap_is_ready = true;
+
+    return 0;
+}
+
+int __wrap_media_write(media_t med, uint32_t adr, uint8_t *data, uint16_t len)
+{
+    uint32_t idx = 0;
+
+    if (!media_wrap_is_ready || (media_wrap_index(adr, len, &idx) != 0))
+    {
+        return -1;
+    }
+
+    uint16_t i = 0;
+    for(i = 0; i < len; i++)
+    {
+        /* The flash memory can only clear bits */
+        media_wrap_mem[idx + i] &= data[i];
+    }
+
+    return 0;
+}
+
+int __wrap_media_read(media_t med, uint32_t adr, uint8_t *data, uint16_t len)
+{
+    uint32_t idx = 0;
+
+    if (!media_wrap_is_ready || (media_wrap_index(adr, len, &idx) != 0))
+    {
+        return -1;
+    }
+
+    memcpy(data, &media_wrap_mem[idx], len);
+
+    return 0;
+}
+
+int __wrap_media_erase(media_t med, uint32_t sector)
+{
+    if (!media_wrap_is_ready || (sector < FLASH_SEG_D_ADR) || (sector > FLASH_SEG_A_ADR))
+    {
+        return -1;
+    }
+
+    memset(&media_wrap_mem[sector - FLASH_SEG_D_ADR], 0xFF, MEDIA_WRAP_SEG_SIZE);
+
+    return 0;
+}
+
+/** \} End of media_wrap group */
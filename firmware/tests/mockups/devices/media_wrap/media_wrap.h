@@ -0,0 +1,54 @@
+/*
+ * media_wrap.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Media device wrap definition.
+ *
+ * The internal flash memory is emulated in RAM (info segments D to A).
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup media_wrap Media Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef MEDIA_WRAP_H_
+#define MEDIA_WRAP_H_
+
+#include <stdint.h>
+
+#include <devices/media/media.h>
+
+int __wrap_media_init(media_t med);
+
+int __wrap_media_write(media_t med, uint32_t adr, uint8_t *data, uint16_t len);
+
+int __wrap_media_read(media_t med, uint32_t adr, uint8_t *data, uint16_t len);
+
+int __wrap_media_erase(media_t med, uint32_t sector);
+
+#endif /* MEDIA_WRAP_H_ */
+
+/** \} End of media_wrap group */
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.1
  *
- * \date 2022/05/17
+ * \date 2026/10/17
  *
  * \defgroup temp_sensor_wrap Temp Sensor Wrap
  * \ingroup tests
@@ -104,7 +104,7 @@ uint16_t __wrap_temp_rtd_raw_to_k(uint32_t raw)
     return mock_type(uint16_t);
 }
 
-int __wrap_temp_rtd_read_c(uint8_t channel, uint16_t *temp)
+int __wrap_temp_rtd_read_c(uint8_t channel, int16_t *temp)
 {
     check_expected(channel);
     check_expected(temp);
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2021/08/23
+ * \date 2026/10/17
  *
  * \defgroup adc_wrap ADC Wrap
  * \ingroup tests
@@ -64,14 +64,32 @@ int __wrap_adc_read(adc_port_t port, uint16_t *val)
     return mock_type(int);
 }
 
-float __wrap_adc_temp_get_mref(void)
+q16_t __wrap_adc_temp_get_mref(void)
 {
-    return mock_type(float);
+    return mock_type(q16_t);
 }
 
-float __wrap_adc_temp_get_nref(void)
+q16_t __wrap_adc_temp_get_nref(void)
 {
-    return mock_type(float);
+    return mock_type(q16_t);
+}
+
+int __wrap_adc_get_tlv_cal(uint16_t *gain, int16_t *offset)
+{
+    uint16_t tlv_gain = mock_type(uint16_t);
+    int16_t tlv_offset = mock_type(int16_t);
+
+    if (gain != NULL)
+    {
+        *gain = tlv_gain;
+    }
+
+    if (offset != NULL)
+    {
+        *offset = tlv_offset;
+    }
+
+    return mock_type(int);
 }
 
 bool __wrap_adc_mutex_create(void)
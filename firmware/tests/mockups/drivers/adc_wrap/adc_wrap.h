@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2021/08/23
+ * \date 2026/10/17
  *
  * \defgroup adc_wrap ADC Wrap
  * \ingroup tests
@@ -47,9 +47,11 @@ int __wrap_adc_read(adc_port_t port, uint16_t *val);
 
 void __wrap_adc_delay_ms(uint16_t ms);
 
-float __wrap_adc_temp_get_mref(void);
+q16_t __wrap_adc_temp_get_mref(void);
 
-float __wrap_adc_temp_get_nref(void);
+q16_t __wrap_adc_temp_get_nref(void);
+
+int __wrap_adc_get_tlv_cal(uint16_t *gain, int16_t *offset);
 
 bool __wrap_adc_mutex_create(void);
 
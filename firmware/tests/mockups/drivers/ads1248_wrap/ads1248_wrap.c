@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2021/09/06
+ * \date 2026/10/17
  *
  * \defgroup ads1248_wrap ADS1248 Wrap
  * \ingroup tests
@@ -79,12 +79,14 @@ int __wrap_ads1248_write_cmd(ads1248_config_t *config, ads1248_cmd_t cmd, uint8_
     check_expected(cmd);
     check_expected(positive_channel);
 
-    if (config != NULL)
+    /* Conversion result after the RDATA command byte */
+    if ((cmd == ADS1248_CMD_RDATA) && (rd != NULL))
     {
-        if (cmd == ADS1248_CMD_RDATA)
-        {
-            config = 0;
-        }
+        uint32_t val = mock_type(uint32_t);
+
+        rd[1] = (uint8_t)(val >> 16);
+        rd[2] = (uint8_t)(val >> 8);
+        rd[3] = (uint8_t)val;
     }
 
     return mock_type(int);
@@ -101,4 +103,71 @@ int __wrap_ads1248_set_powerdown_mode(ads1248_config_t *config, ads1248_power_do
     return mock_type(int);
 }
 
+int __wrap_ads1248_start_continuous(ads1248_config_t *config)
+{
+    return mock_type(int);
+}
+
+int __wrap_ads1248_select_channel(ads1248_config_t *config, uint8_t positive_channel)
+{
+    check_expected(positive_channel);
+
+    return mock_type(int);
+}
+
+int __wrap_ads1248_read_continuous(ads1248_config_t *config, uint8_t *rd)
+{
+    uint32_t val = mock_type(uint32_t);
+
+    rd[0] = (uint8_t)(val >> 16);
+    rd[1] = (uint8_t)(val >> 8);
+    rd[2] = (uint8_t)val;
+
+    return mock_type(int);
+}
+
+int __wrap_ads1248_stop_continuous(ads1248_config_t *config)
+{
+    return mock_type(int);
+}
+
+int __wrap_ads1248_write_regs(ads1248_config_t *config, uint8_t first, const uint8_t *val, uint8_t n)
+{
+    check_expected(first);
+    check_expected(n);
+
+    return mock_type(int);
+}
+
+int __wrap_ads1248_verify_regs(ads1248_config_t *config)
+{
+    return mock_type(int);
+}
+
+int __wrap_ads1248_calibrate(ads1248_config_t *config, ads1248_cmd_t cal)
+{
+    check_expected(cal);
+
+    return mock_type(int);
+}
+
+int __wrap_ads1248_get_cal(ads1248_config_t *config, ads1248_cal_t *cal)
+{
+    cal->offset = mock_type(int32_t);
+    cal->full_scale = mock_type(uint32_t);
+
+    return mock_type(int);
+}
+
+int __wrap_ads1248_set_cal(ads1248_config_t *config, ads1248_cal_t cal)
+{
+    uint32_t offset = (uint32_t)cal.offset;
+    uint32_t full_scale = cal.full_scale;
+
+    check_expected(offset);
+    check_expected(full_scale);
+
+    return mock_type(int);
+}
+
 /** \} End of ads1248_wrap group */
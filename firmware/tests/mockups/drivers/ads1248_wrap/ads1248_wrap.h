@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi de Medeiros <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2021/09/06
+ * \date 2026/10/17
  *
  * \defgroup ads1248_wrap ADS1248 Wrap
  * \ingroup tests
@@ -54,5 +54,23 @@ int __wrap_ads1248_write_cmd(ads1248_config_t *config, ads1248_cmd_t cmd, uint8_
 
 int __wrap_ads1248_set_powerdown_mode(ads1248_config_t *config, ads1248_power_down_t mode);
 
+int __wrap_ads1248_start_continuous(ads1248_config_t *config);
+
+int __wrap_ads1248_select_channel(ads1248_config_t *config, uint8_t positive_channel);
+
+int __wrap_ads1248_read_continuous(ads1248_config_t *config, uint8_t *rd);
+
+int __wrap_ads1248_stop_continuous(ads1248_config_t *config);
+
+int __wrap_ads1248_write_regs(ads1248_config_t *config, uint8_t first, const uint8_t *val, uint8_t n);
+
+int __wrap_ads1248_verify_regs(ads1248_config_t *config);
+
+int __wrap_ads1248_calibrate(ads1248_config_t *config, ads1248_cmd_t cal);
+
+int __wrap_ads1248_get_cal(ads1248_config_t *config, ads1248_cal_t *cal);
+
+int __wrap_ads1248_set_cal(ads1248_config_t *config, ads1248_cal_t cal);
+
 #endif /* ADS1248_WRAP_H_ */
 /** \} End of ads1248_wrap group */
@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2022/07/12
+ * \date 2026/10/17
  *
  * \addtogroup ds277xg_wrap
  * \{
@@ -178,4 +178,31 @@ int __wrap_ds277Xg_read_data(ds277Xg_config_t *config, uint8_t target_reg, uint8
     return mock_type(int);
 }
 
+int __wrap_ds277Xg_read_snapshot(ds277Xg_config_t *config, ds277Xg_snapshot_t *snap)
+{
+    int err = mock_type(int);
+
+    if (err == 0)
+    {
+        *snap = *mock_ptr_type(ds277Xg_snapshot_t*);
+    }
+
+    return err;
+}
+
+bool __wrap_ds277Xg_mutex_create(void)
+{
+    return true;
+}
+
+bool __wrap_ds277Xg_mutex_take(void)
+{
+    return true;
+}
+
+bool __wrap_ds277Xg_mutex_give(void)
+{
+    return true;
+}
+
 /** \} End of ds277xg_wrap group */
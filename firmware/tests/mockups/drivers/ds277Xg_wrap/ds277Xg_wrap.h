@@ -25,9 +25,9 @@
  *
  * \author Lucas Zacchi <lucas.zacchi@spacelab.ufsc.br>
  *
- * \version 0.1.0
+ * \version 0.1.2
  *
- * \date 2022/07/12
+ * \date 2026/10/17
  *
  * \defgroup ds277Xg_wrap DS277Xg Wrap
  * \ingroup tests
@@ -93,6 +93,14 @@ int __wrap_ds277Xg_write_data(ds277Xg_config_t *config, uint8_t *data, uint16_t
 
 int __wrap_ds277Xg_read_data(ds277Xg_config_t *config, uint8_t target_reg, uint8_t *data, uint16_t len);
 
+int __wrap_ds277Xg_read_snapshot(ds277Xg_config_t *config, ds277Xg_snapshot_t *snap);
+
+bool __wrap_ds277Xg_mutex_create(void);
+
+bool __wrap_ds277Xg_mutex_take(void);
+
+bool __wrap_ds277Xg_mutex_give(void);
+
 #endif /* DS277XG_WRAP_H_ */
 
 /** \} End of ds277xg group */
@@ -0,0 +1,51 @@
+/*
+ * mpy_wrap.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief MPY32 driver wrap implementation.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup mpy_wrap
+ * \{
+ */
+
+#include "mpy_wrap.h"
+
+int64_t __wrap_mpy_mul_s32(int32_t a, int32_t b)
+{
+    return (int64_t)a * (int64_t)b;
+}
+
+uint64_t __wrap_mpy_mul_u32(uint32_t a, uint32_t b)
+{
+    return (uint64_t)a * (uint64_t)b;
+}
+
+uint64_t __wrap_mpy_mac_u32(uint64_t acc, uint32_t a, uint32_t b)
+{
+    return acc + ((uint64_t)a * (uint64_t)b);
+}
+
+/** \} End of mpy_wrap group */
@@ -0,0 +1,81 @@
+/*
+ * mpy_wrap.h
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief MPY32 driver wrap definition.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup mpy_wrap MPY32 Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef MPY_WRAP_H_
+#define MPY_WRAP_H_
+
+#include <stdint.h>
+
+#include <drivers/mpy/mpy.h>
+
+/**
+ * \brief Mockup of the signed 32x32 bits multiplication implemented as an wrap function.
+ *
+ * The product is computed by the host, so the users of the driver can be tested with real values.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b.
+ */
+int64_t __wrap_mpy_mul_s32(int32_t a, int32_t b);
+
+/**
+ * \brief Mockup of the unsigned 32x32 bits multiplication implemented as an wrap function.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The product a*b.
+ */
+uint64_t __wrap_mpy_mul_u32(uint32_t a, uint32_t b);
+
+/**
+ * \brief Mockup of the unsigned multiply-accumulate implemented as an wrap function.
+ *
+ * \param[in] acc is the accumulator value.
+ *
+ * \param[in] a is the first operand.
+ *
+ * \param[in] b is the second operand.
+ *
+ * \return The accumulator acc+a*b.
+ */
+uint64_t __wrap_mpy_mac_u32(uint64_t acc, uint32_t a, uint32_t b);
+
+#endif /* MPY_WRAP_H_ */
+
+/** \} End of mpy_wrap group */
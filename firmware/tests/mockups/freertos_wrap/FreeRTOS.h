@@ -0,0 +1,58 @@
+/*
+ * FreeRTOS.h
+ *
+ * Copyright (C) 2021, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief FreeRTOS host stub (kernel types used by the units under test).
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup freertos_wrap FreeRTOS Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef FREERTOS_WRAP_H_
+#define FREERTOS_WRAP_H_
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#define pdFALSE                         ((BaseType_t)0)
+#define pdTRUE                          ((BaseType_t)1)
+#define pdPASS                          pdTRUE
+#define pdFAIL                          pdFALSE
+
+#define portMAX_DELAY                   ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS              ((TickType_t)1)
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+
+#define portENTER_CRITICAL()
+#define portEXIT_CRITICAL()
+
+#endif /* FREERTOS_WRAP_H_ */
+
+/** \} End of freertos_wrap group */
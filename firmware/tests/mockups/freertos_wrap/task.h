@@ -0,0 +1,61 @@
+/*
+ * task.h
+ *
+ * Copyright (C) 2021, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief FreeRTOS task API host stub.
+ *
+ * \version 0.1.1
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup freertos_wrap
+ * \{
+ */
+
+#ifndef TASK_WRAP_H_
+#define TASK_WRAP_H_
+
+#include "FreeRTOS.h"
+
+#define taskENTER_CRITICAL()            portENTER_CRITICAL()
+#define taskEXIT_CRITICAL()             portEXIT_CRITICAL()
+
+typedef struct tskTaskControlBlock* TaskHandle_t;
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+TickType_t xTaskGetTickCount(void);
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+
+#endif /* TASK_WRAP_H_ */
+
+/** \} End of freertos_wrap group */
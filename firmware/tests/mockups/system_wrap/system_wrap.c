@@ -0,0 +1,54 @@
+/*
+ * system_wrap.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief System module wrap implementation.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \addtogroup system_wrap
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include "system_wrap.h"
+
+static sys_time_t system_wrap_time = 0;
+
+void __wrap_system_set_time(sys_time_t tm)
+{
+    system_wrap_time = tm;
+}
+
+sys_time_t __wrap_system_get_time(void)
+{
+    return system_wrap_time;
+}
+
+/** \} End of system_wrap group */
@@ -0,0 +1,77 @@
+/*
+ * crc8_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the CRC-8.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup crc8_test CRC-8
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <system/crc8/crc8.h>
+
+static void crc8_check_test(void **state)
+{
+    const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    /* CRC-8 (polynomial 0x07) check value */
+    assert_int_equal(crc8(data, sizeof(data)), 0xF4);
+
+    assert_int_equal(crc8(data, 0), CRC8_INITIAL_VAL);
+}
+
+static void crc8_record_test(void **state)
+{
+    uint8_t buf[6] = {0x12, 0x00, 0x01, 0x02, 0x03, 0x00};
+
+    /* A record with its CRC-8 appended has a CRC-8 of zero */
+    buf[5] = crc8(buf, 5U);
+
+    assert_int_equal(crc8(buf, 6U), 0);
+
+    buf[2] ^= 0x10U;
+
+    assert_int_not_equal(crc8(buf, 5U), buf[5]);
+}
+
+int main(void)
+{
+    const struct CMUnitTest crc8_tests[] = {
+        cmocka_unit_test(crc8_check_test),
+        cmocka_unit_test(crc8_record_test),
+    };
+
+    return cmocka_run_group_tests(crc8_tests, NULL, NULL);
+}
+
+/** \} End of crc8_test group */
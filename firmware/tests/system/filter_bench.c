@@ -0,0 +1,111 @@
+/*
+ * filter_bench.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Host throughput benchmark of the sensor stream filters.
+ *
+ * The output is the mean time per sample in nanoseconds of each filter type,
+ * and the number of samples per second of a single instance.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup filter_bench Filters Benchmark
+ * \ingroup tests
+ * \{
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <system/filter/filter.h>
+
+#define FILTER_BENCH_SAMPLES        1000000UL
+
+static const filter_config_t filter_bench_configs[] = {
+    FILTER_EMA(0.25),
+    FILTER_MEDIAN(3),
+    FILTER_MEDIAN(7),
+    FILTER_BIQUAD(0.067455273889, 0.134910547778, 0.067455273889, -1.142980502540, 0.412801598096),
+};
+
+static const char *filter_bench_names[] = {"EMA", "median (3)", "median (7)", "biquad"};
+
+static int16_t filter_bench_samples[FILTER_BENCH_SAMPLES];
+
+static volatile int32_t filter_bench_sink;
+
+static double filter_bench_now_ns(void);
+
+int main(void)
+{
+    uint32_t i = 0;
+    uint8_t f = 0;
+
+    for(i = 0; i < FILTER_BENCH_SAMPLES; i++)
+    {
+        filter_bench_samples[i] = (int16_t)(2048 + (rand() % 256) - ((i % 97U) == 0U ? 1500 : 0));
+    }
+
+    printf("Filters throughput (%lu samples):\n", FILTER_BENCH_SAMPLES);
+
+    for(f = 0; f < (sizeof(filter_bench_configs) / sizeof(filter_bench_configs[0])); f++)
+    {
+        filter_t filter;
+
+        if (filter_init(&filter, &filter_bench_configs[f]) != 0)
+        {
+            printf("    %-12s invalid configuration!\n", filter_bench_names[f]);
+
+            return -1;
+        }
+
+        double start = filter_bench_now_ns();
+
+        for(i = 0; i < FILTER_BENCH_SAMPLES; i++)
+        {
+            filter_bench_sink += filter_update(&filter, filter_bench_samples[i]);
+        }
+
+        double ns = (filter_bench_now_ns() - start) / (double)FILTER_BENCH_SAMPLES;
+
+        printf("    %-12s %8.2f ns/sample, %10.0f samples/s\n", filter_bench_names[f], ns, 1e9 / ns);
+    }
+
+    return 0;
+}
+
+static double filter_bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/** \} End of filter_bench group */
@@ -0,0 +1,182 @@
+/*
+ * filter_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the sensor stream filters.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup filter_test Filters
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <system/filter/filter.h>
+
+static const filter_config_t ema_config = FILTER_EMA(0.25);
+static const filter_config_t median_config = FILTER_MEDIAN(5);
+static const filter_config_t biquad_config = FILTER_BIQUAD(0.067455273889, 0.134910547778, 0.067455273889, -1.142980502540, 0.412801598096);
+
+static void filter_init_test(void **state)
+{
+    filter_t filter;
+
+    const filter_config_t no_alpha = FILTER_EMA(0);
+    const filter_config_t even_window = FILTER_MEDIAN(4);
+    const filter_config_t large_window = FILTER_MEDIAN(9);
+    const filter_config_t no_window = FILTER_MEDIAN(0);
+    const filter_config_t invalid_type = {.type = 0xFF};
+
+    assert_return_code(filter_init(&filter, &ema_config), 0);
+    assert_return_code(filter_init(&filter, &median_config), 0);
+    assert_return_code(filter_init(&filter, &biquad_config), 0);
+
+    assert_int_equal(filter_init(NULL, &ema_config), -1);
+    assert_int_equal(filter_init(&filter, NULL), -1);
+    assert_int_equal(filter_init(&filter, &no_alpha), -1);
+    assert_int_equal(filter_init(&filter, &even_window), -1);
+    assert_int_equal(filter_init(&filter, &large_window), -1);
+    assert_int_equal(filter_init(&filter, &no_window), -1);
+    assert_int_equal(filter_init(&filter, &invalid_type), -1);
+}
+
+static void filter_ema_test(void **state)
+{
+    filter_t filter;
+    double ref = 1000.0;
+    uint16_t i = 0;
+
+    assert_return_code(filter_init(&filter, &ema_config), 0);
+
+    /* Primed with the first sample */
+    assert_int_equal(filter_update(&filter, 1000), 1000);
+
+    /* Step response, compared with the exact average */
+    for(i = 0; i < 40; i++)
+    {
+        ref += 0.25 * (2000.0 - ref);
+
+        int32_t y = filter_update(&filter, 2000);
+
+        assert_in_range(y, (int32_t)ref - 1, (int32_t)ref + 1);
+    }
+
+    assert_int_equal(filter_update(&filter, 2000), 2000);
+
+    /* Negative values */
+    filter_reset(&filter);
+
+    assert_int_equal(filter_update(&filter, -100), -100);
+    assert_int_equal(filter_update(&filter, -300), -150);
+}
+
+static void filter_median_test(void **state)
+{
+    filter_t filter;
+
+    assert_return_code(filter_init(&filter, &median_config), 0);
+
+    /* Lower median of the available samples until the window is full */
+    assert_int_equal(filter_update(&filter, 300), 300);
+    assert_int_equal(filter_update(&filter, 100), 100);
+    assert_int_equal(filter_update(&filter, 200), 200);
+
+    /* Spike rejection */
+    assert_int_equal(filter_update(&filter, 30000), 200);
+    assert_int_equal(filter_update(&filter, 250), 250);
+    assert_int_equal(filter_update(&filter, -30000), 200);
+    assert_int_equal(filter_update(&filter, 260), 250);
+    assert_int_equal(filter_update(&filter, 270), 260);
+
+    filter_reset(&filter);
+
+    assert_int_equal(filter_update(&filter, -5), -5);
+    assert_int_equal(filter_update(&filter, -7), -7);
+    assert_int_equal(filter_update(&filter, -6), -6);
+}
+
+static void filter_biquad_test(void **state)
+{
+    const double b[] = {0.067455273889, 0.134910547778, 0.067455273889};
+    const double a[] = {-1.142980502540, 0.412801598096};
+
+    filter_t filter;
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    uint16_t i = 0;
+
+    assert_return_code(filter_init(&filter, &biquad_config), 0);
+
+    /* Primed with the first sample, a constant input has a constant output */
+    for(i = 0; i < 20; i++)
+    {
+        assert_int_equal(filter_update(&filter, 8000), 8000);
+    }
+
+    x1 = x2 = y1 = y2 = 8000.0;
+
+    /* Noisy input, compared with the floating point filter */
+    for(i = 0; i < 1000; i++)
+    {
+        int32_t x = 7000 + (rand() % 2000);
+        double y = (b[0] * x) + (b[1] * x1) + (b[2] * x2) - (a[0] * y1) - (a[1] * y2);
+
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+
+        int32_t out = filter_update(&filter, x);
+
+        assert_in_range(out, (int32_t)(y + 0.5) - 1, (int32_t)(y + 0.5) + 1);
+    }
+
+    /* Step response settles to the input (unity DC gain) */
+    for(i = 0; i < 100; i++)
+    {
+        filter_update(&filter, -4000);
+    }
+
+    assert_int_equal(filter_update(&filter, -4000), -4000);
+}
+
+int main(void)
+{
+    const struct CMUnitTest filter_tests[] = {
+        cmocka_unit_test(filter_init_test),
+        cmocka_unit_test(filter_ema_test),
+        cmocka_unit_test(filter_median_test),
+        cmocka_unit_test(filter_biquad_test),
+    };
+
+    return cmocka_run_group_tests(filter_tests, NULL, NULL);
+}
+
+/** \} End of filter_test group */
@@ -0,0 +1,176 @@
+/*
+ * fixedpt_test.c
+ *
+ * Copyright (C) 2022, SpaceLab.
+ *
+ * This file is part of EPS 2.0.
+ *
+ * EPS 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EPS 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EPS 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the fixed-point math library.
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/17
+ *
+ * \defgroup fixedpt_test Fixed-Point Math
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <system/fixedpt/fixedpt.h>
+
+static void fixedpt_q16_add_sub_test(void **state)
+{
+    assert_int_equal(fixedpt_q16_add(FIXEDPT_Q16_CONST(1.5), FIXEDPT_Q16_CONST(-2.25)), FIXEDPT_Q16_CONST(-0.75));
+    assert_int_equal(fixedpt_q16_sub(FIXEDPT_Q16_CONST(1.5), FIXEDPT_Q16_CONST(-2.25)), FIXEDPT_Q16_CONST(3.75));
+
+    /* Saturation */
+    assert_int_equal(fixedpt_q16_add(FIXEDPT_Q16_MAX, FIXEDPT_Q16_ONE), FIXEDPT_Q16_MAX);
+    assert_int_equal(fixedpt_q16_add(FIXEDPT_Q16_MIN, -FIXEDPT_Q16_ONE), FIXEDPT_Q16_MIN);
+    assert_int_equal(fixedpt_q16_sub(FIXEDPT_Q16_MIN, FIXEDPT_Q16_ONE), FIXEDPT_Q16_MIN);
+    assert_int_equal(fixedpt_q16_sub(FIXEDPT_Q16_ONE, FIXEDPT_Q16_MIN), FIXEDPT_Q16_MAX);
+    assert_int_equal(fixedpt_q16_sub(0, FIXEDPT_Q16_MIN), FIXEDPT_Q16_MAX);
+}
+
+static void fixedpt_q16_mul_test(void **state)
+{
+    assert_int_equal(fixedpt_q16_mul(FIXEDPT_Q16_CONST(1.5), FIXEDPT_Q16_CONST(-2.25)), FIXEDPT_Q16_CONST(-3.375));
+    assert_int_equal(fixedpt_q16_mul(FIXEDPT_Q16_INT(-100), FIXEDPT_Q16_INT(-300)), FIXEDPT_Q16_INT(30000));
+
+    /* Rounding to the nearest LSB */
+    assert_int_equal(fixedpt_q16_mul(3, FIXEDPT_Q16_CONST(0.5)), 2);
+    assert_int_equal(fixedpt_q16_mul(1, FIXEDPT_Q16_CONST(0.25)), 0);
+
+    /* Saturation */
+    assert_int_equal(fixedpt_q16_mul(FIXEDPT_Q16_INT(300), FIXEDPT_Q16_INT(300)), FIXEDPT_Q16_MAX);
+    assert_int_equal(fixedpt_q16_mul(FIXEDPT_Q16_INT(-300), FIXEDPT_Q16_INT(300)), FIXEDPT_Q16_MIN);
+
+    /* Integer scaling */
+    assert_int_equal(fixedpt_q16_scale(1000, FIXEDPT_Q16_CONST(1.6)), 1600);
+    assert_int_equal(fixedpt_q16_scale(-8, FIXEDPT_Q16_CONST(0.125)), -1);
+}
+
+static void fixedpt_q16_div_test(void **state)
+{
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_CONST(-3.375), FIXEDPT_Q16_CONST(1.5)), FIXEDPT_Q16_CONST(-2.25));
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(1), FIXEDPT_Q16_INT(3)), 21845);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(2), FIXEDPT_Q16_INT(3)), 43691);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(-2), FIXEDPT_Q16_INT(3)), -43691);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_MAX, FIXEDPT_Q16_MAX), FIXEDPT_Q16_ONE);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_MIN, FIXEDPT_Q16_ONE), FIXEDPT_Q16_MIN);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(-32768), FIXEDPT_Q16_INT(1)), FIXEDPT_Q16_MIN);
+
+    /* Saturation */
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(30000), FIXEDPT_Q16_CONST(0.5)), FIXEDPT_Q16_MAX);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_INT(-30000), FIXEDPT_Q16_CONST(0.5)), FIXEDPT_Q16_MIN);
+    assert_int_equal(fixedpt_q16_div(FIXEDPT_Q16_ONE, 0), FIXEDPT_Q16_MAX);
+    assert_int_equal(fixedpt_q16_div(-FIXEDPT_Q16_ONE, 0), FIXEDPT_Q16_MIN);
+
+    /* Compared with the exact quotient */
+    int32_t a = 0;
+    for(a = -2000000; a <= 2000000; a += 12347)
+    {
+        int32_t b = 0;
+        for(b = -700000; b <= 700000; b += 9973)
+        {
+            if (b == 0)
+            {
+                continue;
+            }
+
+            int64_t num = (int64_t)a * 65536;
+            int64_t exact = (num >= 0) == (b >= 0) ? (num + ((b >= 0 ? b : -b) / 2)) / b : (num - ((b >= 0 ? b : -b) / 2)) / b;
+
+            if ((exact > INT32_MAX) || (exact < INT32_MIN))
+            {
+                continue;
+            }
+
+            assert_in_range(fixedpt_q16_div(a, b), exact - 1, exact + 1);
+        }
+    }
+}
+
+static void fixedpt_q16_to_int_test(void **state)
+{
+    assert_int_equal(fixedpt_q16_to_int(FIXEDPT_Q16_CONST(2.49)), 2);
+    assert_int_equal(fixedpt_q16_to_int(FIXEDPT_Q16_CONST(2.5)), 3);
+    assert_int_equal(fixedpt_q16_to_int(FIXEDPT_Q16_CONST(-2.49)), -2);
+    assert_int_equal(fixedpt_q16_to_int(FIXEDPT_Q16_CONST(-2.51)), -3);
+    assert_int_equal(fixedpt_q16_to_int(FIXEDPT_Q16_INT(-273)), -273);
+}
+
+static void fixedpt_q16_interp_test(void **state)
+{
+    assert_int_equal(fixedpt_q16_interp(FIXEDPT_Q16_INT(0), FIXEDPT_Q16_INT(10), FIXEDPT_Q16_INT(4), FIXEDPT_Q16_INT(30), FIXEDPT_Q16_INT(1)), FIXEDPT_Q16_INT(15));
+    assert_int_equal(fixedpt_q16_interp(FIXEDPT_Q16_INT(0), FIXEDPT_Q16_INT(10), FIXEDPT_Q16_INT(4), FIXEDPT_Q16_INT(30), FIXEDPT_Q16_INT(-2)), FIXEDPT_Q16_INT(0));
+    assert_int_equal(fixedpt_q16_interp(FIXEDPT_Q16_INT(4), FIXEDPT_Q16_INT(10), FIXEDPT_Q16_INT(4), FIXEDPT_Q16_INT(30), FIXEDPT_Q16_INT(7)), FIXEDPT_Q16_INT(10));
+
+    const q16_t xs[] = {FIXEDPT_Q16_INT(-10), FIXEDPT_Q16_INT(0), FIXEDPT_Q16_INT(10), FIXEDPT_Q16_INT(50)};
+    const q16_t ys[] = {FIXEDPT_Q16_INT(100), FIXEDPT_Q16_INT(0), FIXEDPT_Q16_INT(20), FIXEDPT_Q16_INT(-20)};
+
+    /* Clamped to the ends of the table */
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_INT(-100)), FIXEDPT_Q16_INT(100));
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_INT(100)), FIXEDPT_Q16_INT(-20));
+
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_INT(-5)), FIXEDPT_Q16_INT(50));
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_INT(0)), FIXEDPT_Q16_INT(0));
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_CONST(2.5)), FIXEDPT_Q16_INT(5));
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 4, FIXEDPT_Q16_INT(40)), FIXEDPT_Q16_INT(-10));
+    assert_int_equal(fixedpt_q16_interp_table(xs, ys, 1, FIXEDPT_Q16_INT(40)), FIXEDPT_Q16_INT(100));
+}
+
+static void fixedpt_q15_test(void **state)
+{
+    assert_int_equal(fixedpt_q15_mul(FIXEDPT_Q15_CONST(0.5), FIXEDPT_Q15_CONST(-0.5)), FIXEDPT_Q15_CONST(-0.25));
+    assert_int_equal(fixedpt_q15_mul(FIXEDPT_Q15_MIN, FIXEDPT_Q15_MIN), FIXEDPT_Q15_MAX);
+    assert_int_equal(fixedpt_q15_mul(FIXEDPT_Q15_MIN, FIXEDPT_Q15_MAX), -FIXEDPT_Q15_MAX);
+
+    assert_int_equal(fixedpt_q15_div(FIXEDPT_Q15_CONST(0.25), FIXEDPT_Q15_CONST(0.5)), FIXEDPT_Q15_CONST(0.5));
+    assert_int_equal(fixedpt_q15_div(FIXEDPT_Q15_CONST(-0.25), FIXEDPT_Q15_CONST(0.5)), FIXEDPT_Q15_CONST(-0.5));
+    assert_int_equal(fixedpt_q15_div(1000, 3000), 10923);
+
+    /* Saturation */
+    assert_int_equal(fixedpt_q15_div(FIXEDPT_Q15_CONST(0.5), FIXEDPT_Q15_CONST(0.5)), FIXEDPT_Q15_MAX);
+    assert_int_equal(fixedpt_q15_div(FIXEDPT_Q15_CONST(-0.5), FIXEDPT_Q15_CONST(0.5)), FIXEDPT_Q15_MIN);
+    assert_int_equal(fixedpt_q15_div(FIXEDPT_Q15_CONST(0.5), 0), FIXEDPT_Q15_MAX);
+    assert_int_equal(fixedpt_q15_sat(40000), FIXEDPT_Q15_MAX);
+    assert_int_equal(fixedpt_q15_sat(-40000), FIXEDPT_Q15_MIN);
+}
+
+int main(void)
+{
+    const struct CMUnitTest fixedpt_tests[] = {
+        cmocka_unit_test(fixedpt_q16_add_sub_test),
+        cmocka_unit_test(fixedpt_q16_mul_test),
+        cmocka_unit_test(fixedpt_q16_div_test),
+        cmocka_unit_test(fixedpt_q16_to_int_test),
+        cmocka_unit_test(fixedpt_q16_interp_test),
+        cmocka_unit_test(fixedpt_q15_test),
+    };
+
+    return cmocka_run_group_tests(fixedpt_tests, NULL, NULL);
+}
+
+/** \} End of fixedpt_test group */
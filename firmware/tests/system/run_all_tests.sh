@@ -0,0 +1,5 @@
+#!/bin/bash
+
+./fixedpt_unit_test
+./filter_unit_test
+./crc8_unit_test